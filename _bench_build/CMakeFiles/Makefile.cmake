@@ -0,0 +1,142 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindcJSON.cmake"
+  "/root/repo/cmake/Findlinenoise.cmake"
+  "/root/repo/cmake/Findmsgpack.cmake"
+  "/root/repo/rbusConfig.cmake.in"
+  "/root/repo/sampleapps/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/rbus/CMakeLists.txt"
+  "/root/repo/src/rtmessage/CMakeLists.txt"
+  "/root/repo/src/session_manager/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/core/CMakeLists.txt"
+  "/root/repo/test/core/benchmark_test/CMakeLists.txt"
+  "/root/repo/test/rbus/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/root/repo/utils/rbuscli/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "rbusConfig.cmake"
+  "rbusConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/rtmessage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/session_manager/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/rbus/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/rbuscli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/rbus/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/core/benchmark_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "sampleapps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/rtmessage/CMakeFiles/rtMessage.dir/DependInfo.cmake"
+  "src/rtmessage/CMakeFiles/rtrouted.dir/DependInfo.cmake"
+  "src/rtmessage/CMakeFiles/rtrouted_diag.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/rbuscore.dir/DependInfo.cmake"
+  "src/session_manager/CMakeFiles/rbus_session_mgr.dir/DependInfo.cmake"
+  "src/rbus/CMakeFiles/rbus.dir/DependInfo.cmake"
+  "utils/rbuscli/CMakeFiles/rbuscli.dir/DependInfo.cmake"
+  "test/rbus/CMakeFiles/rbusTestProvider.dir/DependInfo.cmake"
+  "test/rbus/CMakeFiles/rbusTestConsumer.dir/DependInfo.cmake"
+  "test/rbus/CMakeFiles/rbusTestMultiProvider.dir/DependInfo.cmake"
+  "test/rbus/CMakeFiles/rbusTestMultiConsumer.dir/DependInfo.cmake"
+  "test/rbus/CMakeFiles/rbusRecoveryConsumer.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/sample_server.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/sample_client.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/bin_client.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/bin_server.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_sample_event_server.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_sample_event_client.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_sample_wildcard_server.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_sample_wildcard_server2.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_sample_wildcard_client.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_every_client.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_nested_test_server.dir/DependInfo.cmake"
+  "test/core/CMakeFiles/rbus_obj_lookup.dir/DependInfo.cmake"
+  "test/core/benchmark_test/CMakeFiles/rbus_benchmark_test_app.dir/DependInfo.cmake"
+  "test/core/benchmark_test/CMakeFiles/rtmessage_benchmark_test_app.dir/DependInfo.cmake"
+  "test/core/benchmark_test/CMakeFiles/rbus_property_benchmark_test_app.dir/DependInfo.cmake"
+  "test/core/benchmark_test/CMakeFiles/rbus_event_benchmark_test_app.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusSampleProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusSampleConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusCSIProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusCSIConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusDirectConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusTableProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusSampleTableProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusTableConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusEventProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusEventConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusGeneralEventProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusGeneralEventConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusValueChangeProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusValueChangeConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusIntervalProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusIntervalConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusMethodProvider.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusMethodConsumer.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusMessageListener.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusMessageSender.dir/DependInfo.cmake"
+  "sampleapps/CMakeFiles/rbusOpenTelemetry.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,35 @@
+set(rBus_VERSION 1.1.1)
+
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was rbusConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+
+include(CMakeFindDependencyMacro)
+
+find_library(RBUS_LIBRARIES NAMES rbus)
+find_path(RBUS_INCLUDE_DIRS NAMES rbus.h PATH_SUFFIXES rbus)
+
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(rbus RBUS_INCLUDE_DIRS RBUS_LIBRARIES)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusCSIConsumer.dir/consumer/rbusCSIEventConsumer.c.o"
+  "CMakeFiles/rbusCSIConsumer.dir/consumer/rbusCSIEventConsumer.c.o.d"
+  "rbusCSIConsumer"
+  "rbusCSIConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusCSIConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusCSIProvider.dir/provider/rbusCSIEventProvider.c.o"
+  "CMakeFiles/rbusCSIProvider.dir/provider/rbusCSIEventProvider.c.o.d"
+  "rbusCSIProvider"
+  "rbusCSIProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusCSIProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
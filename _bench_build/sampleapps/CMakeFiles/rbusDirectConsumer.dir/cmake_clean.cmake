@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusDirectConsumer.dir/consumer/rbusDirectConsumer.c.o"
+  "CMakeFiles/rbusDirectConsumer.dir/consumer/rbusDirectConsumer.c.o.d"
+  "rbusDirectConsumer"
+  "rbusDirectConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusDirectConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/sampleapps/consumer/rbusEventConsumer.c" "sampleapps/CMakeFiles/rbusEventConsumer.dir/consumer/rbusEventConsumer.c.o" "gcc" "sampleapps/CMakeFiles/rbusEventConsumer.dir/consumer/rbusEventConsumer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/rbus/CMakeFiles/rbus.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/core/CMakeFiles/rbuscore.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/rtmessage/CMakeFiles/rtMessage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusEventConsumer.dir/consumer/rbusEventConsumer.c.o"
+  "CMakeFiles/rbusEventConsumer.dir/consumer/rbusEventConsumer.c.o.d"
+  "rbusEventConsumer"
+  "rbusEventConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusEventConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
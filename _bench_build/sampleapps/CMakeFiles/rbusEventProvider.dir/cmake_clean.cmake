@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusEventProvider.dir/provider/rbusEventProvider.c.o"
+  "CMakeFiles/rbusEventProvider.dir/provider/rbusEventProvider.c.o.d"
+  "rbusEventProvider"
+  "rbusEventProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusEventProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
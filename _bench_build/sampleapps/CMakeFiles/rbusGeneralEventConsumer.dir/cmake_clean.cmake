@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusGeneralEventConsumer.dir/consumer/rbusGeneralEventConsumer.c.o"
+  "CMakeFiles/rbusGeneralEventConsumer.dir/consumer/rbusGeneralEventConsumer.c.o.d"
+  "rbusGeneralEventConsumer"
+  "rbusGeneralEventConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusGeneralEventConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
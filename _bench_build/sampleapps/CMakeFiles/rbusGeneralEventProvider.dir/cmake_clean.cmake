@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusGeneralEventProvider.dir/provider/rbusGeneralEventProvider.c.o"
+  "CMakeFiles/rbusGeneralEventProvider.dir/provider/rbusGeneralEventProvider.c.o.d"
+  "rbusGeneralEventProvider"
+  "rbusGeneralEventProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusGeneralEventProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusIntervalConsumer.dir/consumer/rbusIntervalConsumer.c.o"
+  "CMakeFiles/rbusIntervalConsumer.dir/consumer/rbusIntervalConsumer.c.o.d"
+  "rbusIntervalConsumer"
+  "rbusIntervalConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusIntervalConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusIntervalProvider.dir/provider/rbusIntervalProvider.c.o"
+  "CMakeFiles/rbusIntervalProvider.dir/provider/rbusIntervalProvider.c.o.d"
+  "rbusIntervalProvider"
+  "rbusIntervalProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusIntervalProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusMessageListener.dir/message/rbusMessageListener.c.o"
+  "CMakeFiles/rbusMessageListener.dir/message/rbusMessageListener.c.o.d"
+  "rbusMessageListener"
+  "rbusMessageListener.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusMessageListener.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusMessageSender.dir/message/rbusMessageSender.c.o"
+  "CMakeFiles/rbusMessageSender.dir/message/rbusMessageSender.c.o.d"
+  "rbusMessageSender"
+  "rbusMessageSender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusMessageSender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusMethodConsumer.dir/consumer/rbusMethodConsumer.c.o"
+  "CMakeFiles/rbusMethodConsumer.dir/consumer/rbusMethodConsumer.c.o.d"
+  "rbusMethodConsumer"
+  "rbusMethodConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusMethodConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusMethodProvider.dir/provider/rbusMethodProvider.c.o"
+  "CMakeFiles/rbusMethodProvider.dir/provider/rbusMethodProvider.c.o.d"
+  "rbusMethodProvider"
+  "rbusMethodProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusMethodProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
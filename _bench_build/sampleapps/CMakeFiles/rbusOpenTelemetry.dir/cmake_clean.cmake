@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusOpenTelemetry.dir/consumer/rbusOpenTelemetry.c.o"
+  "CMakeFiles/rbusOpenTelemetry.dir/consumer/rbusOpenTelemetry.c.o.d"
+  "rbusOpenTelemetry"
+  "rbusOpenTelemetry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusOpenTelemetry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusSampleConsumer.dir/consumer/rbusSampleConsumer.c.o"
+  "CMakeFiles/rbusSampleConsumer.dir/consumer/rbusSampleConsumer.c.o.d"
+  "rbusSampleConsumer"
+  "rbusSampleConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusSampleConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
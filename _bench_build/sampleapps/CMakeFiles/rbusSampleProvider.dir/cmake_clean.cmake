@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusSampleProvider.dir/provider/rbusSampleProvider.c.o"
+  "CMakeFiles/rbusSampleProvider.dir/provider/rbusSampleProvider.c.o.d"
+  "rbusSampleProvider"
+  "rbusSampleProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusSampleProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusSampleTableProvider.dir/provider/rbusSampleTableProvider.c.o"
+  "CMakeFiles/rbusSampleTableProvider.dir/provider/rbusSampleTableProvider.c.o.d"
+  "rbusSampleTableProvider"
+  "rbusSampleTableProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusSampleTableProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusTableConsumer.dir/consumer/rbusTableConsumer.c.o"
+  "CMakeFiles/rbusTableConsumer.dir/consumer/rbusTableConsumer.c.o.d"
+  "rbusTableConsumer"
+  "rbusTableConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusTableConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusTableProvider.dir/provider/rbusTableProvider.c.o"
+  "CMakeFiles/rbusTableProvider.dir/provider/rbusTableProvider.c.o.d"
+  "CMakeFiles/rbusTableProvider.dir/provider/utilities.c.o"
+  "CMakeFiles/rbusTableProvider.dir/provider/utilities.c.o.d"
+  "rbusTableProvider"
+  "rbusTableProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusTableProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusValueChangeConsumer.dir/consumer/rbusValueChangeConsumer.c.o"
+  "CMakeFiles/rbusValueChangeConsumer.dir/consumer/rbusValueChangeConsumer.c.o.d"
+  "rbusValueChangeConsumer"
+  "rbusValueChangeConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusValueChangeConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusValueChangeProvider.dir/provider/rbusValueChangeProvider.c.o"
+  "CMakeFiles/rbusValueChangeProvider.dir/provider/rbusValueChangeProvider.c.o.d"
+  "rbusValueChangeProvider"
+  "rbusValueChangeProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusValueChangeProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
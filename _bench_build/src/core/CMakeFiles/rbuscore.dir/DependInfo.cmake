@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/rbuscore.c" "src/core/CMakeFiles/rbuscore.dir/rbuscore.c.o" "gcc" "src/core/CMakeFiles/rbuscore.dir/rbuscore.c.o.d"
+  "/root/repo/src/core/rbuscore_message.c" "src/core/CMakeFiles/rbuscore.dir/rbuscore_message.c.o" "gcc" "src/core/CMakeFiles/rbuscore.dir/rbuscore_message.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_bench_build/src/core/librbuscore.so" "/root/repo/_bench_build/src/core/librbuscore.so.2.0.5"
+  "/root/repo/_bench_build/src/core/librbuscore.so.0" "/root/repo/_bench_build/src/core/librbuscore.so.2.0.5"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/rtmessage/CMakeFiles/rtMessage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbuscore.dir/rbuscore.c.o"
+  "CMakeFiles/rbuscore.dir/rbuscore.c.o.d"
+  "CMakeFiles/rbuscore.dir/rbuscore_message.c.o"
+  "CMakeFiles/rbuscore.dir/rbuscore_message.c.o.d"
+  "librbuscore.pdb"
+  "librbuscore.so"
+  "librbuscore.so.0"
+  "librbuscore.so.2.0.5"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbuscore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
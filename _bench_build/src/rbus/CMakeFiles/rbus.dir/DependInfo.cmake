@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rbus/rbus.c" "src/rbus/CMakeFiles/rbus.dir/rbus.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus.c.o.d"
+  "/root/repo/src/rbus/rbus_asyncsubscribe.c" "src/rbus/CMakeFiles/rbus.dir/rbus_asyncsubscribe.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_asyncsubscribe.c.o.d"
+  "/root/repo/src/rbus/rbus_buffer.c" "src/rbus/CMakeFiles/rbus.dir/rbus_buffer.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_buffer.c.o.d"
+  "/root/repo/src/rbus/rbus_config.c" "src/rbus/CMakeFiles/rbus.dir/rbus_config.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_config.c.o.d"
+  "/root/repo/src/rbus/rbus_discoverycache.c" "src/rbus/CMakeFiles/rbus.dir/rbus_discoverycache.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_discoverycache.c.o.d"
+  "/root/repo/src/rbus/rbus_element.c" "src/rbus/CMakeFiles/rbus.dir/rbus_element.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_element.c.o.d"
+  "/root/repo/src/rbus/rbus_executor.c" "src/rbus/CMakeFiles/rbus.dir/rbus_executor.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_executor.c.o.d"
+  "/root/repo/src/rbus/rbus_filter.c" "src/rbus/CMakeFiles/rbus.dir/rbus_filter.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_filter.c.o.d"
+  "/root/repo/src/rbus/rbus_handle.c" "src/rbus/CMakeFiles/rbus.dir/rbus_handle.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_handle.c.o.d"
+  "/root/repo/src/rbus/rbus_intervalsubscription.c" "src/rbus/CMakeFiles/rbus.dir/rbus_intervalsubscription.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_intervalsubscription.c.o.d"
+  "/root/repo/src/rbus/rbus_message.c" "src/rbus/CMakeFiles/rbus.dir/rbus_message.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_message.c.o.d"
+  "/root/repo/src/rbus/rbus_object.c" "src/rbus/CMakeFiles/rbus.dir/rbus_object.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_object.c.o.d"
+  "/root/repo/src/rbus/rbus_property.c" "src/rbus/CMakeFiles/rbus.dir/rbus_property.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_property.c.o.d"
+  "/root/repo/src/rbus/rbus_subscriptions.c" "src/rbus/CMakeFiles/rbus.dir/rbus_subscriptions.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_subscriptions.c.o.d"
+  "/root/repo/src/rbus/rbus_tokenchain.c" "src/rbus/CMakeFiles/rbus.dir/rbus_tokenchain.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_tokenchain.c.o.d"
+  "/root/repo/src/rbus/rbus_value.c" "src/rbus/CMakeFiles/rbus.dir/rbus_value.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_value.c.o.d"
+  "/root/repo/src/rbus/rbus_valuechange.c" "src/rbus/CMakeFiles/rbus.dir/rbus_valuechange.c.o" "gcc" "src/rbus/CMakeFiles/rbus.dir/rbus_valuechange.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_bench_build/src/rbus/librbus.so" "/root/repo/_bench_build/src/rbus/librbus.so.2.0.5"
+  "/root/repo/_bench_build/src/rbus/librbus.so.0" "/root/repo/_bench_build/src/rbus/librbus.so.2.0.5"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/core/CMakeFiles/rbuscore.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/rtmessage/CMakeFiles/rtMessage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rtmessage/local_benchmarking.c" "src/rtmessage/CMakeFiles/rtMessage.dir/local_benchmarking.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/local_benchmarking.c.o.d"
+  "/root/repo/src/rtmessage/rtBase64.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtBase64.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtBase64.c.o.d"
+  "/root/repo/src/rtmessage/rtCipher.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtCipher.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtCipher.c.o.d"
+  "/root/repo/src/rtmessage/rtConnection.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtConnection.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtConnection.c.o.d"
+  "/root/repo/src/rtmessage/rtEncoder.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtEncoder.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtEncoder.c.o.d"
+  "/root/repo/src/rtmessage/rtError.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtError.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtError.c.o.d"
+  "/root/repo/src/rtmessage/rtHashMap.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtHashMap.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtHashMap.c.o.d"
+  "/root/repo/src/rtmessage/rtList.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtList.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtList.c.o.d"
+  "/root/repo/src/rtmessage/rtLog.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtLog.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtLog.c.o.d"
+  "/root/repo/src/rtmessage/rtMemory.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtMemory.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtMemory.c.o.d"
+  "/root/repo/src/rtmessage/rtMessage.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtMessage.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtMessage.c.o.d"
+  "/root/repo/src/rtmessage/rtMessageHeader.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtMessageHeader.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtMessageHeader.c.o.d"
+  "/root/repo/src/rtmessage/rtRetainable.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtRetainable.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtRetainable.c.o.d"
+  "/root/repo/src/rtmessage/rtSemaphore.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtSemaphore.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtSemaphore.c.o.d"
+  "/root/repo/src/rtmessage/rtSocket.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtSocket.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtSocket.c.o.d"
+  "/root/repo/src/rtmessage/rtThreadPool.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtThreadPool.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtThreadPool.c.o.d"
+  "/root/repo/src/rtmessage/rtTime.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtTime.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtTime.c.o.d"
+  "/root/repo/src/rtmessage/rtVector.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtVector.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtVector.c.o.d"
+  "/root/repo/src/rtmessage/rtrouteBase.c" "src/rtmessage/CMakeFiles/rtMessage.dir/rtrouteBase.c.o" "gcc" "src/rtmessage/CMakeFiles/rtMessage.dir/rtrouteBase.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_bench_build/src/rtmessage/librtMessage.so" "/root/repo/_bench_build/src/rtmessage/librtMessage.so.2.0.5"
+  "/root/repo/_bench_build/src/rtmessage/librtMessage.so.0" "/root/repo/_bench_build/src/rtmessage/librtMessage.so.2.0.5"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
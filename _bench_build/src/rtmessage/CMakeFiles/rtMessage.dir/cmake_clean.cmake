@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtMessage.dir/local_benchmarking.c.o"
+  "CMakeFiles/rtMessage.dir/local_benchmarking.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtBase64.c.o"
+  "CMakeFiles/rtMessage.dir/rtBase64.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtCipher.c.o"
+  "CMakeFiles/rtMessage.dir/rtCipher.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtConnection.c.o"
+  "CMakeFiles/rtMessage.dir/rtConnection.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtEncoder.c.o"
+  "CMakeFiles/rtMessage.dir/rtEncoder.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtError.c.o"
+  "CMakeFiles/rtMessage.dir/rtError.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtHashMap.c.o"
+  "CMakeFiles/rtMessage.dir/rtHashMap.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtList.c.o"
+  "CMakeFiles/rtMessage.dir/rtList.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtLog.c.o"
+  "CMakeFiles/rtMessage.dir/rtLog.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtMemory.c.o"
+  "CMakeFiles/rtMessage.dir/rtMemory.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtMessage.c.o"
+  "CMakeFiles/rtMessage.dir/rtMessage.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtMessageHeader.c.o"
+  "CMakeFiles/rtMessage.dir/rtMessageHeader.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtRetainable.c.o"
+  "CMakeFiles/rtMessage.dir/rtRetainable.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtSemaphore.c.o"
+  "CMakeFiles/rtMessage.dir/rtSemaphore.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtSocket.c.o"
+  "CMakeFiles/rtMessage.dir/rtSocket.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtThreadPool.c.o"
+  "CMakeFiles/rtMessage.dir/rtThreadPool.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtTime.c.o"
+  "CMakeFiles/rtMessage.dir/rtTime.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtVector.c.o"
+  "CMakeFiles/rtMessage.dir/rtVector.c.o.d"
+  "CMakeFiles/rtMessage.dir/rtrouteBase.c.o"
+  "CMakeFiles/rtMessage.dir/rtrouteBase.c.o.d"
+  "librtMessage.pdb"
+  "librtMessage.so"
+  "librtMessage.so.0"
+  "librtMessage.so.2.0.5"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rtMessage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
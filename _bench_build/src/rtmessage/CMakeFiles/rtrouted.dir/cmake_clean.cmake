@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtrouted.dir/rtRoutingTree.c.o"
+  "CMakeFiles/rtrouted.dir/rtRoutingTree.c.o.d"
+  "CMakeFiles/rtrouted.dir/rtrouted.c.o"
+  "CMakeFiles/rtrouted.dir/rtrouted.c.o.d"
+  "rtrouted"
+  "rtrouted.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rtrouted.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtrouted_diag.dir/diag_probe.c.o"
+  "CMakeFiles/rtrouted_diag.dir/diag_probe.c.o.d"
+  "rtrouted_diag"
+  "rtrouted_diag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rtrouted_diag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_session_mgr.dir/session_manager.c.o"
+  "CMakeFiles/rbus_session_mgr.dir/session_manager.c.o.d"
+  "rbus_session_mgr"
+  "rbus_session_mgr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_session_mgr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bin_client.dir/bin_client.c.o"
+  "CMakeFiles/bin_client.dir/bin_client.c.o.d"
+  "bin_client"
+  "bin_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bin_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
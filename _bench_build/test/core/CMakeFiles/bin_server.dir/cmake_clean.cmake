@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bin_server.dir/bin_server.c.o"
+  "CMakeFiles/bin_server.dir/bin_server.c.o.d"
+  "bin_server"
+  "bin_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bin_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
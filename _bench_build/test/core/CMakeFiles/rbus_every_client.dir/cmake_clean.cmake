@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_every_client.dir/every_client.c.o"
+  "CMakeFiles/rbus_every_client.dir/every_client.c.o.d"
+  "rbus_every_client"
+  "rbus_every_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_every_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_nested_test_server.dir/nested_server.c.o"
+  "CMakeFiles/rbus_nested_test_server.dir/nested_server.c.o.d"
+  "rbus_nested_test_server"
+  "rbus_nested_test_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_nested_test_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_obj_lookup.dir/test_obj_lookup.c.o"
+  "CMakeFiles/rbus_obj_lookup.dir/test_obj_lookup.c.o.d"
+  "rbus_obj_lookup"
+  "rbus_obj_lookup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_obj_lookup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
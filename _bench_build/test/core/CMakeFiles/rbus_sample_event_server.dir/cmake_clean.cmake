@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_sample_event_server.dir/sample_event_server.c.o"
+  "CMakeFiles/rbus_sample_event_server.dir/sample_event_server.c.o.d"
+  "rbus_sample_event_server"
+  "rbus_sample_event_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_sample_event_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_sample_wildcard_client.dir/sample_wildcard_client.c.o"
+  "CMakeFiles/rbus_sample_wildcard_client.dir/sample_wildcard_client.c.o.d"
+  "rbus_sample_wildcard_client"
+  "rbus_sample_wildcard_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_sample_wildcard_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_sample_wildcard_server.dir/sample_wildcard_server.c.o"
+  "CMakeFiles/rbus_sample_wildcard_server.dir/sample_wildcard_server.c.o.d"
+  "rbus_sample_wildcard_server"
+  "rbus_sample_wildcard_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_sample_wildcard_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
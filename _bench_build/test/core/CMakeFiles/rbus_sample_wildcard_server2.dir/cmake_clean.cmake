@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_sample_wildcard_server2.dir/sample_wildcard_server2.c.o"
+  "CMakeFiles/rbus_sample_wildcard_server2.dir/sample_wildcard_server2.c.o.d"
+  "rbus_sample_wildcard_server2"
+  "rbus_sample_wildcard_server2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbus_sample_wildcard_server2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
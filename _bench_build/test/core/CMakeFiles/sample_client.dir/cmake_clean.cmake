@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sample_client.dir/sample_client.c.o"
+  "CMakeFiles/sample_client.dir/sample_client.c.o.d"
+  "sample_client"
+  "sample_client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sample_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
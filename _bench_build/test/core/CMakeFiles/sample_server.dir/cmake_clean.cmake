@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sample_server.dir/sample_server.c.o"
+  "CMakeFiles/sample_server.dir/sample_server.c.o.d"
+  "sample_server"
+  "sample_server.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sample_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/core/benchmark_test/rbus_test_util.c" "test/core/benchmark_test/CMakeFiles/rbus_benchmark_test_app.dir/rbus_test_util.c.o" "gcc" "test/core/benchmark_test/CMakeFiles/rbus_benchmark_test_app.dir/rbus_test_util.c.o.d"
+  "/root/repo/test/core/benchmark_test/rbus_benchmark_test_app.cpp" "test/core/benchmark_test/CMakeFiles/rbus_benchmark_test_app.dir/rbus_benchmark_test_app.cpp.o" "gcc" "test/core/benchmark_test/CMakeFiles/rbus_benchmark_test_app.dir/rbus_benchmark_test_app.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/core/CMakeFiles/rbuscore.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/rtmessage/CMakeFiles/rtMessage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_benchmark_test_app.dir/rbus_benchmark_test_app.cpp.o"
+  "CMakeFiles/rbus_benchmark_test_app.dir/rbus_benchmark_test_app.cpp.o.d"
+  "CMakeFiles/rbus_benchmark_test_app.dir/rbus_test_util.c.o"
+  "CMakeFiles/rbus_benchmark_test_app.dir/rbus_test_util.c.o.d"
+  "rbus_benchmark_test_app"
+  "rbus_benchmark_test_app.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/rbus_benchmark_test_app.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
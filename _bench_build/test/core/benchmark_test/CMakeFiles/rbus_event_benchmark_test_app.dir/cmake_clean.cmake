@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbus_event_benchmark_test_app.dir/rbus_event_benchmark_test_app.cpp.o"
+  "CMakeFiles/rbus_event_benchmark_test_app.dir/rbus_event_benchmark_test_app.cpp.o.d"
+  "rbus_event_benchmark_test_app"
+  "rbus_event_benchmark_test_app.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rbus_event_benchmark_test_app.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
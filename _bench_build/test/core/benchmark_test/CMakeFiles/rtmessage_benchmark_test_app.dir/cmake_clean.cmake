@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rtmessage_benchmark_test_app.dir/rtmessage_benchmark_test_app.cpp.o"
+  "CMakeFiles/rtmessage_benchmark_test_app.dir/rtmessage_benchmark_test_app.cpp.o.d"
+  "rtmessage_benchmark_test_app"
+  "rtmessage_benchmark_test_app.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtmessage_benchmark_test_app.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/core/benchmark_test
+# Build directory: /root/repo/_bench_build/test/core/benchmark_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rbus_benchmark_test "rbus_benchmark_test_app" "--benchmark_min_time=0.01")
+set_tests_properties(rbus_benchmark_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/core/benchmark_test/CMakeLists.txt;33;add_test;/root/repo/test/core/benchmark_test/CMakeLists.txt;0;")
+add_test(rtmessage_benchmark_test "rtmessage_benchmark_test_app" "--benchmark_min_time=0.01")
+set_tests_properties(rtmessage_benchmark_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/core/benchmark_test/CMakeLists.txt;39;add_test;/root/repo/test/core/benchmark_test/CMakeLists.txt;0;")
+add_test(rbus_property_benchmark_test "rbus_property_benchmark_test_app" "--benchmark_min_time=0.01")
+set_tests_properties(rbus_property_benchmark_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/core/benchmark_test/CMakeLists.txt;45;add_test;/root/repo/test/core/benchmark_test/CMakeLists.txt;0;")
+add_test(rbus_event_benchmark_test "rbus_event_benchmark_test_app" "--benchmark_min_time=0.01")
+set_tests_properties(rbus_event_benchmark_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/core/benchmark_test/CMakeLists.txt;51;add_test;/root/repo/test/core/benchmark_test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusRecoveryConsumer.dir/common/runningParamHelper.c.o"
+  "CMakeFiles/rbusRecoveryConsumer.dir/common/runningParamHelper.c.o.d"
+  "CMakeFiles/rbusRecoveryConsumer.dir/consumer/rbusRecoveryConsumer.c.o"
+  "CMakeFiles/rbusRecoveryConsumer.dir/consumer/rbusRecoveryConsumer.c.o.d"
+  "rbusRecoveryConsumer"
+  "rbusRecoveryConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusRecoveryConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
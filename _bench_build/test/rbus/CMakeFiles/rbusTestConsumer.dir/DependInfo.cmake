@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/rbus/common/runningParamHelper.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/common/runningParamHelper.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/common/runningParamHelper.c.o.d"
+  "/root/repo/test/rbus/common/testValueHelper.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/common/testValueHelper.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/common/testValueHelper.c.o.d"
+  "/root/repo/test/rbus/consumer/elementTree.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/elementTree.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/elementTree.c.o.d"
+  "/root/repo/test/rbus/consumer/events.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/events.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/events.c.o.d"
+  "/root/repo/test/rbus/consumer/filter.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/filter.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/filter.c.o.d"
+  "/root/repo/test/rbus/consumer/methods.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/methods.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/methods.c.o.d"
+  "/root/repo/test/rbus/consumer/objectAPI.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/objectAPI.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/objectAPI.c.o.d"
+  "/root/repo/test/rbus/consumer/partialPath.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/partialPath.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/partialPath.c.o.d"
+  "/root/repo/test/rbus/consumer/propertyAPI.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/propertyAPI.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/propertyAPI.c.o.d"
+  "/root/repo/test/rbus/consumer/rbusTestConsumer.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/rbusTestConsumer.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/rbusTestConsumer.c.o.d"
+  "/root/repo/test/rbus/consumer/subscribe.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/subscribe.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/subscribe.c.o.d"
+  "/root/repo/test/rbus/consumer/subscribeEx.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/subscribeEx.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/subscribeEx.c.o.d"
+  "/root/repo/test/rbus/consumer/tables.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/tables.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/tables.c.o.d"
+  "/root/repo/test/rbus/consumer/value.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/value.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/value.c.o.d"
+  "/root/repo/test/rbus/consumer/valueAPI.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/valueAPI.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/valueAPI.c.o.d"
+  "/root/repo/test/rbus/consumer/valueChange.c" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/valueChange.c.o" "gcc" "test/rbus/CMakeFiles/rbusTestConsumer.dir/consumer/valueChange.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/rbus/CMakeFiles/rbus.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/core/CMakeFiles/rbuscore.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/rtmessage/CMakeFiles/rtMessage.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
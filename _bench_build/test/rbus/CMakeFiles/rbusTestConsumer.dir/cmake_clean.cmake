@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusTestConsumer.dir/common/runningParamHelper.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/common/runningParamHelper.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/common/testValueHelper.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/common/testValueHelper.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/elementTree.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/elementTree.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/events.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/events.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/filter.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/filter.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/methods.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/methods.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/objectAPI.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/objectAPI.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/partialPath.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/partialPath.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/propertyAPI.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/propertyAPI.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/rbusTestConsumer.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/rbusTestConsumer.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/subscribe.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/subscribe.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/subscribeEx.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/subscribeEx.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/tables.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/tables.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/value.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/value.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/valueAPI.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/valueAPI.c.o.d"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/valueChange.c.o"
+  "CMakeFiles/rbusTestConsumer.dir/consumer/valueChange.c.o.d"
+  "rbusTestConsumer"
+  "rbusTestConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusTestConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusTestMultiConsumer.dir/common/runningParamHelper.c.o"
+  "CMakeFiles/rbusTestMultiConsumer.dir/common/runningParamHelper.c.o.d"
+  "CMakeFiles/rbusTestMultiConsumer.dir/consumer/rbusTestMultiConsumer.c.o"
+  "CMakeFiles/rbusTestMultiConsumer.dir/consumer/rbusTestMultiConsumer.c.o.d"
+  "rbusTestMultiConsumer"
+  "rbusTestMultiConsumer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusTestMultiConsumer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
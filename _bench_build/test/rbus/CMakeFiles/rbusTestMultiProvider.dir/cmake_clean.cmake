@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusTestMultiProvider.dir/common/runningParamHelper.c.o"
+  "CMakeFiles/rbusTestMultiProvider.dir/common/runningParamHelper.c.o.d"
+  "CMakeFiles/rbusTestMultiProvider.dir/provider/rbusTestMultiProvider.c.o"
+  "CMakeFiles/rbusTestMultiProvider.dir/provider/rbusTestMultiProvider.c.o.d"
+  "rbusTestMultiProvider"
+  "rbusTestMultiProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusTestMultiProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
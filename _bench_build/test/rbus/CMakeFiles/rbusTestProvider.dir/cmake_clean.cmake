@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbusTestProvider.dir/common/runningParamHelper.c.o"
+  "CMakeFiles/rbusTestProvider.dir/common/runningParamHelper.c.o.d"
+  "CMakeFiles/rbusTestProvider.dir/common/testValueHelper.c.o"
+  "CMakeFiles/rbusTestProvider.dir/common/testValueHelper.c.o.d"
+  "CMakeFiles/rbusTestProvider.dir/provider/rbusTestProvider.c.o"
+  "CMakeFiles/rbusTestProvider.dir/provider/rbusTestProvider.c.o.d"
+  "rbusTestProvider"
+  "rbusTestProvider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbusTestProvider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
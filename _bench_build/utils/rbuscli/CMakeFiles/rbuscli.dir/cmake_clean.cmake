@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rbuscli.dir/rbuscli.c.o"
+  "CMakeFiles/rbuscli.dir/rbuscli.c.o.d"
+  "rbuscli"
+  "rbuscli.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rbuscli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -327,6 +327,54 @@ typedef void (*rbusMethodAsyncRespHandler_t)(
     rbusObject_t params
 );
 
+/** @fn typedef void (* rbusGetAsyncRespHandler_t)(
+ *          rbusHandle_t handle,
+ *          char const* name,
+ *          rbusError_t error,
+ *          rbusValue_t value,
+ *          void* userData)
+ *  @brief A component will receive this API callback when the result of
+ *  a get started with rbus_getAsync is ready.\n
+ *  Used by: Any component that calls rbus_getAsync.
+ *  @param handle     Bus Handle
+ *  @param name       The parameter name
+ *  @param error      Any error that occured
+ *  @param value      The value of the parameter, NULL on error. Released when
+ *                    the handler returns; call rbusValue_Retain to keep it.
+ *  @param userData   The userData passed to rbus_getAsync
+ *  @return void
+ *  @ingroup Consumers
+ */
+typedef void (*rbusGetAsyncRespHandler_t)(
+    rbusHandle_t handle,
+    char const* name,
+    rbusError_t error,
+    rbusValue_t value,
+    void* userData
+);
+
+/** @fn typedef void (* rbusSetAsyncRespHandler_t)(
+ *          rbusHandle_t handle,
+ *          char const* name,
+ *          rbusError_t error,
+ *          void* userData)
+ *  @brief A component will receive this API callback when the result of
+ *  a set started with rbus_setAsync is ready.\n
+ *  Used by: Any component that calls rbus_setAsync.
+ *  @param handle     Bus Handle
+ *  @param name       The parameter name
+ *  @param error      Any error that occured
+ *  @param userData   The userData passed to rbus_setAsync
+ *  @return void
+ *  @ingroup Consumers
+ */
+typedef void (*rbusSetAsyncRespHandler_t)(
+    rbusHandle_t handle,
+    char const* name,
+    rbusError_t error,
+    void* userData
+);
+
 /** @addtogroup Providers
   * @{ 
   */
@@ -742,6 +790,34 @@ rbusError_t rbusHandle_GetTraceContextAsString(
 /** @addtogroup Discovery
  *  @{
  */
+
+/** @struct rbusDiscoveryCacheStats_t
+ *  @brief Counters of the handle's cache of element name to component name
+ *  resolutions used by rbus_getExt and rbus_setMulti
+ */
+typedef struct _rbusDiscoveryCacheStats
+{
+    uint64_t hits;          /**< batches resolved from the cache */
+    uint64_t misses;        /**< batches resolved by asking the bus broker */
+    uint64_t invalidations; /**< entries dropped on expiry, disconnect or delivery failure */
+    uint32_t entries;       /**< entries currently cached */
+} rbusDiscoveryCacheStats_t;
+
+/** @fn rbusError_t rbusHandle_GetDiscoveryCacheStats(
+ *          rbusHandle_t handle,
+ *          rbusDiscoveryCacheStats_t* stats)
+ *  @brief Get the hit and miss counters of the handle's component discovery cache.
+ *  Entries live for RBUS_DISCOVERY_CACHE_TTL miliseconds (default 30000, 0 disables
+ *  the cache) and are dropped early when their component disconnects.  \n
+ *  Used by: Client
+ *  @param      handle          Bus Handle
+ *  @param      stats           The counters
+ *  @return RBus error code as defined by rbusError_t.
+ */
+rbusError_t rbusHandle_GetDiscoveryCacheStats(
+    rbusHandle_t handle,
+    rbusDiscoveryCacheStats_t* stats);
+
 /** @fn rbusError_t rbus_discoverComponentName (
  *          rbusHandle_t handle,
  *          int numElements, 
@@ -874,6 +950,32 @@ rbusError_t rbus_get(
     char const* name,
     rbusValue_t* value);
 
+/** @fn rbusError_t rbus_getAsync(
+ *          rbusHandle_t handle,
+ *          char const* name,
+ *          rbusGetAsyncRespHandler_t callback,
+ *          void* userData)
+ *  @brief Get the value of a single parameter without waiting for it.\n
+ *  Used by: Components that keep many gets in flight from one thread
+ *
+ * The request is sent before this returns and the callback receives the
+ * result, so a single thread can pipeline any number of gets instead of
+ * needing a thread per outstanding call. The callback runs on an rbus
+ * internal thread and should return quickly, as no other response is read
+ * while it runs. Gets still in flight when the handle is closed complete
+ * with an error.
+ *  @param      handle          Bus Handle
+ *  @param      name            The name of the parameter to get the value of
+ *  @param      callback        Called once with the result, only if this returns RBUS_ERROR_SUCCESS
+ *  @param      userData        Passed to callback
+ *  @return RBus error code as defined by rbusError_t.
+ */
+rbusError_t rbus_getAsync(
+    rbusHandle_t handle,
+    char const* name,
+    rbusGetAsyncRespHandler_t callback,
+    void* userData);
+
 /** @fn rbusError_t rbus_getExt(
  *          rbusHandle_t handle,
  *          int paramCount,
@@ -912,6 +1014,10 @@ rbusError_t rbus_get(
                           response.                                           \n
  *      numValues       : n                                                   \n
  *      values          : Array of parameter values (caller to free memory)   \n
+ *  A wild card query spanning several components queries them all at once
+ *  within a single get timeout. If some of them fail, the error of the first
+ *  failing one is returned and properties still holds the values of those
+ *  that responded (caller to free memory).                                   \n
  *  Used by: All components that need to get one or more parameters
  *  @param      handle          Bus Handle
  *  @param      paramCount      The number (count) of input elements (parameters)
@@ -1031,6 +1137,34 @@ rbusError_t rbus_set(
     rbusValue_t value,
     rbusSetOptions_t* opts);
 
+/** @fn rbusError_t rbus_setAsync(
+ *          rbusHandle_t handle,
+ *          char const* name,
+ *          rbusValue_t value,
+ *          rbusSetOptions_t* opts,
+ *          rbusSetAsyncRespHandler_t callback,
+ *          void* userData)
+ *  @brief Set a single parameter without waiting for the result.\n
+ *  Used by: Components that keep many sets in flight from one thread
+ *
+ * Behaves as rbus_set, with the result delivered to callback as
+ * described for rbus_getAsync.
+ *  @param      handle          Bus Handle
+ *  @param      name            The name of the parameter to set.
+ *  @param      value           The value to set the parameter to.
+ *  @param      opts            Extra options such as session info, as for rbus_set.
+ *  @param      callback        Called once with the result, only if this returns RBUS_ERROR_SUCCESS
+ *  @param      userData        Passed to callback
+ *  @return RBus error code as defined by rbusError_t.
+ */
+rbusError_t rbus_setAsync(
+    rbusHandle_t handle,
+    char const* name,
+    rbusValue_t value,
+    rbusSetOptions_t* opts,
+    rbusSetAsyncRespHandler_t callback,
+    void* userData);
+
 /** @fn rbusError_t rbus_setMulti(
  *          rbusHandle_t handle,
  *          int numProps,
@@ -1185,6 +1319,57 @@ rbusError_t rbusTable_removeRow(
     rbusHandle_t handle,
     char const* rowName); 
 
+/** @fn rbusError_t rbusTable_addRows(
+ *          busHandle handle, 
+ *          char const* tableName,
+ *          int numRows,
+ *          char const** aliasNames,
+ *          uint32_t* instNums)
+ *  @brief Add several new rows to a table
+ *
+ * This API adds numRows new rows to a table in a single request to the provider.
+ * It behaves as numRows calls to rbusTable_addRow, except that either all the rows
+ * are added or, if the provider fails to add any of them, none are.
+ * Used by:  Any component that needs to add many table rows in another component.
+ *  @param  handle          Bus Handle
+ *  @param  tableName       The name of a table (e.g. "Device.IP.Interface.")
+ *  @param  numRows         The number of rows to add
+ *  @param  aliasNames      An optional array of numRows names for the new rows.  Can be NULL, as can any entry.
+ *  @param  instNums        Optional output array of numRows where the instance numbers of the new rows are returned
+ *  @return RBus error code as defined by rbusError_t.
+ *  Possible values are: RBUS_ERROR_INVALID_INPUT
+ *  @ingroup Tables
+ */
+rbusError_t rbusTable_addRows(
+    rbusHandle_t handle,
+    char const* tableName,
+    int numRows,
+    char const** aliasNames,
+    uint32_t* instNums);
+
+/** @fn rbusError_t rbusTable_removeRows(
+ *          busHandle handle, 
+ *          int numRows,
+ *          char const** rowNames)
+ *  @brief Remove several rows from tables owned by one provider
+ *
+ * This API removes numRows rows in a single request to the provider.  Each name
+ * must be a fully qualified row name as for rbusTable_removeRow, and all rows must
+ * belong to the same provider.  Removal stops at the first row the provider fails to
+ * remove; the rows before it stay removed.
+ * Used by:  Any component that needs to remove many table rows in another component.
+ *  @param  handle          Bus Handle
+ *  @param  numRows         The number of rows to remove
+ *  @param  rowNames        The names of the table rows (e.g. "Device.IP.Interface.1")
+ *  @return RBus error code as defined by rbusError_t.
+ *  Possible values are: RBUS_ERROR_INVALID_INPUT
+ *  @ingroup Tables
+ */
+rbusError_t rbusTable_removeRows(
+    rbusHandle_t handle,
+    int numRows,
+    char const** rowNames);
+
 /** @fn rbusError_t rbusTable_getRowNames(
  *          busHandle handle, 
  *          char const* tableName,
@@ -1317,6 +1502,56 @@ rbusError_t rbusTable_unregisterRow(
     rbusHandle_t handle,
     char const* rowName);
 
+/** @fn rbusError_t rbusTable_registerRows(
+ *          busHandle handle, 
+ *          char const* tableName,
+ *          int numRows,
+ *          uint32_t const* instNums,
+ *          char const** aliasNames)
+ *  @brief Register several rows that the provider has added to its own table.
+ *
+ * This method is the batch form of rbusTable_registerRow.  Subscriptions are matched
+ * against all the new rows in one pass, and the ObjectCreated events for the rows are
+ * published once every row is registered.  No row is registered if any of them is invalid.
+ * Used by:  Any provider that adds many rows to its own table, such as when repopulating it.
+ *  @param  handle          Bus Handle
+ *  @param  tableName       The name of a table (e.g. "Device.IP.Interface.")
+ *  @param  numRows         The number of rows to register
+ *  @param  instNums        The unique instance numbers the provider has assigned the rows.
+ *  @param  aliasNames      An optional array of numRows names for the rows.  Can be NULL, as can any entry.
+ *  @return RBus error code as defined by rbusError_t.
+ *  Possible values are: RBUS_ERROR_INVALID_INPUT
+ *  @ingroup Tables
+ */
+rbusError_t rbusTable_registerRows(
+    rbusHandle_t handle,
+    char const* tableName,
+    int numRows,
+    uint32_t const* instNums,
+    char const** aliasNames);
+
+/** @fn rbusError_t rbusTable_unregisterRows(
+ *          busHandle handle, 
+ *          int numRows,
+ *          char const** rowNames)
+ *  @brief Unregister several rows that the provider has removed from its own tables.
+ *
+ * This method is the batch form of rbusTable_unregisterRow.  The ObjectDeleted events
+ * for the rows are published once every row is unregistered.  No row is unregistered
+ * if any of them does not exist.
+ * Used by:  Any provider that removes many rows from its own tables.
+ *  @param  handle          Bus Handle
+ *  @param  numRows         The number of rows to unregister
+ *  @param  rowNames        The names of the table rows (e.g. "Device.IP.Interface.1")
+ *  @return RBus error code as defined by rbusError_t.
+ *  Possible values are: RBUS_ERROR_INVALID_INPUT
+ *  @ingroup Tables
+ */
+rbusError_t rbusTable_unregisterRows(
+    rbusHandle_t handle,
+    int numRows,
+    char const** rowNames);
+
 /** @} */
 
 /** @addtogroup Consumers
@@ -1532,6 +1767,30 @@ rbusError_t  rbusEvent_Publish(
     rbusHandle_t handle,
     rbusEvent_t* eventData);
 
+/** @fn rbusError_t rbus_setValueChanged(
+ *          rbusHandle_t handle,
+ *          char const* name,
+ *          rbusValue_t value)
+ *  @brief Report that the value of a property has changed.
+ *
+ *  Lets a provider tell rbus a property it owns has a new value, so value-change
+ *  subscribers are notified right away instead of waiting for the next poll.
+ *  Once a provider has reported a property this way, rbus only polls it
+ *  occasionally as a safety net.  Nothing is done if nobody watches the property.
+ *  This call does not block on the getHandler and can be made from any thread.\n
+ *  Used by: Components that provide properties
+ *  @param      handle  Bus Handle
+ *  @param      name    The name of the property
+ *  @param      value   The new value, or NULL to have rbus call the getHandler
+ *  @return RBus error code as defined by rbusError_t.
+ *  Possible values are: RBUS_ERROR_SUCCESS, RBUS_ERROR_INVALID_INPUT, RBUS_ERROR_ELEMENT_DOES_NOT_EXIST
+ *  @ingroup Events
+ */
+rbusError_t rbus_setValueChanged(
+    rbusHandle_t handle,
+    char const* name,
+    rbusValue_t value);
+
 /** @} */
 
 /** @addtogroup Consumers
@@ -1579,6 +1838,8 @@ rbusError_t rbusMethod_Invoke(
  * The return params of the method will be received asynchronously by the callback provided.
  * inParams will be retained and used to invoke the method on a background thread; therefore,
  * inParams should not be altered by the calling program until the callback complete.
+ * The call runs on the shared rbus executor (see rbus_getExecutorStats); when its queue is full
+ * this blocks until there is room.
  *  @param      handle      Bus Handle
  *  @param      methodName  Method name
  *  @param      inParams    Input params
@@ -1595,6 +1856,34 @@ rbusError_t rbusMethod_InvokeAsync(
     rbusMethodAsyncRespHandler_t callback, 
     int timeout);
 
+/// @brief rbusExecutorStats_t counters of the executor running rbus background work
+typedef struct _rbusExecutorStats
+{
+    uint32_t threads;           /** Max threads the executor runs tasks on */
+    uint32_t queueLength;       /** Tasks waiting for a thread */
+    uint32_t queueLengthMax;    /** Highest queueLength seen */
+    uint32_t tasksRun;          /** Tasks started */
+    uint32_t tasksRejected;     /** Tasks refused because the queue was full */
+    uint32_t latencyAvg;        /** Average time in microseconds a task waited before it started */
+    uint32_t latencyMax;        /** Longest time in microseconds a task waited before it started */
+} rbusExecutorStats_t;
+
+/** @fn rbusError_t rbus_getExecutorStats(
+ *          rbusExecutorStats_t* stats)
+ *  @brief Get the counters of the executor.
+ *
+ *  rbus runs async method invokes, async subscribe retries and interval
+ *  subscription events on one bounded thread pool per process.  The pool is
+ *  created on first use and destroyed by the last rbus_close, which resets the counters.
+ *  All counters are 0 while no executor exists.
+ *  @param      stats   Receives the counters
+ *  @return RBus error code as defined by rbusError_t.
+ *  Possible values are: RBUS_ERROR_SUCCESS, RBUS_ERROR_INVALID_INPUT
+ *  @ingroup Methods
+ */
+rbusError_t rbus_getExecutorStats(
+    rbusExecutorStats_t* stats);
+
 /** @} */
 
 /** @addtogroup Providers
@@ -29,6 +29,7 @@
 #include "rbuscore.h"
 #include "rbuscore_logger.h"
 #include "rtVector.h"
+#include "rtHashMap.h"
 #include "rtAdvisory.h"
 #include "rtMemory.h"
 
@@ -37,6 +38,7 @@ void rbusMessage_BeginMetaSectionWrite(rbusMessage message);
 void rbusMessage_EndMetaSectionWrite(rbusMessage message);
 void rbusMessage_BeginMetaSectionRead(rbusMessage message);
 void rbusMessage_EndMetaSectionRead(rbusMessage message);
+int rbusMessage_MetaSectionHasMore(rbusMessage message);
 
 /* Begin constant definitions.*/
 static const unsigned int TIMEOUT_VALUE_FIRE_AND_FORGET = 1000;
@@ -322,12 +324,14 @@ void client_subscription_destroy(void* p)
 static char g_daemon_address[MAX_DAEMON_ADDRESS_LEN] = "unix:///tmp/rtrouted";
 static rtConnection g_connection = NULL;
 static rtVector g_server_objects; /*server_object_t list*/
+static rtHashMap g_server_objects_by_name; /*the same server_object_t keyed by name*/
 static pthread_mutex_t g_mutex;
 static pthread_mutex_t g_directCliMutex;
 static pthread_mutex_t g_directServMutex;
 static int g_mutex_init = 0;
 static bool g_run_event_client_dispatch = false;
 static rtVector g_event_subscriptions_for_client; /*client_subscription_t list. Used by the subscriber to track all active subscriptions. */
+static rtHashMap g_event_subscriptions_by_object; /*the same client_subscription_t keyed by object name, for event dispatch*/
 static rtVector g_queued_requests; /*list of queued_request */
 
 /*client disconnect detection*/
@@ -376,7 +380,9 @@ static void perform_init()
 {
     RBUSCORELOG_DEBUG("Performing init");
     rtVector_Create(&g_server_objects);
+    rtHashMap_Create(&g_server_objects_by_name);
     rtVector_Create(&g_event_subscriptions_for_client);
+    rtHashMap_Create(&g_event_subscriptions_by_object);
     rtVector_Create(&gListOfServerDirectDMLs);
     rtVector_Create(&gListOfClientDirectDMLs);
     _rbuscore_directconnection_load_from_cache();
@@ -390,6 +396,7 @@ static void perform_cleanup()
 
     lock();
 
+    rtHashMap_Destroy(g_server_objects_by_name);
     rtVector_Destroy(g_server_objects, server_object_destroy);
 
     rtVector_Destroy(gListOfServerDirectDMLs, _freePrivateServer);
@@ -415,6 +422,7 @@ static void perform_cleanup()
         }
         lock();
     }
+    rtHashMap_Destroy(g_event_subscriptions_by_object);
     rtVector_Destroy(g_event_subscriptions_for_client, client_subscription_destroy);
 
     unlock();
@@ -430,6 +438,9 @@ void _rbusMessage_SetMetaInfo(rbusMessage m,
   rbusMessage_SetString(m, method_name);
   rbusMessage_SetString(m, ot_parent);
   rbusMessage_SetString(m, ot_state);
+  /*older readers stop after the third string, so capabilities are only appended when there are some*/
+  if(rbusMessage_GetCaps(m))
+    rbusMessage_SetInt32(m, (int32_t)rbusMessage_GetCaps(m));
   rbusMessage_EndMetaSectionWrite(m);
 
   #if 0
@@ -449,6 +460,12 @@ void _rbusMessage_GetMetaInfo(rbusMessage m,
   rbusMessage_GetString(m, method_name);
   rbusMessage_GetString(m, ot_parent);
   rbusMessage_GetString(m, ot_state);
+  if(rbusMessage_MetaSectionHasMore(m))
+  {
+    uint32_t caps = 0;
+    if(rbusMessage_GetUInt32(m, &caps) == RT_OK)
+      rbusMessage_SetCaps(m, caps);
+  }
   rbusMessage_EndMetaSectionRead(m);
 
   #if 0
@@ -461,7 +478,7 @@ void _rbusMessage_GetMetaInfo(rbusMessage m,
 
 static server_object_t get_object(const char * object_name)
 {
-    return rtVector_Find(g_server_objects, object_name, server_object_compare);
+    return rtHashMap_Get(g_server_objects_by_name, object_name);
 }
 
 static rbusCoreError_t translate_rt_error(rtError err)
@@ -710,6 +727,8 @@ static rbusCoreError_t send_subscription_request(const char * object_name, const
     rbusMessage request, internal_response;
     rbusMessage_Init(&request);
 
+    /*the payload is nested as bytes, so its capabilities ride on the request's meta section*/
+    rbusMessage_SetCaps(request, payload ? rbusMessage_GetCaps(payload) : 0);
     rbusMessage_SetString(request, event_name);
     rbusMessage_SetString(request, rtConnection_GetReturnAddress(g_connection));
     rbusMessage_SetInt32(request, payload ? 1 : 0);
@@ -797,7 +816,7 @@ rbusCoreError_t rbus_registerObj(const char * object_name, rbus_callback_t handl
     }
 
     lock();
-    obj = rtVector_Find(g_server_objects, object_name, server_object_compare);
+    obj = get_object(object_name);
     unlock();
     if(obj)
     {
@@ -816,6 +835,7 @@ rbusCoreError_t rbus_registerObj(const char * object_name, rbus_callback_t handl
 
         lock();
         rtVector_PushBack(g_server_objects, obj);
+        rtHashMap_Set(g_server_objects_by_name, obj->name, obj);
         sz = rtVector_Size(g_server_objects);
         unlock();
         RBUSCORELOG_DEBUG("Registered object %s", object_name);
@@ -965,6 +985,7 @@ rbusCoreError_t rbus_unregisterObj(const char * object_name)
     server_object_t obj = get_object(object_name);
     if(NULL != obj)
     {
+        rtHashMap_Remove(g_server_objects_by_name, obj->name);
         rtVector_RemoveItem(g_server_objects, obj, server_object_destroy);
         RBUSCORELOG_INFO("Unregistered object %s.", object_name);
     }
@@ -1019,6 +1040,64 @@ rbusCoreError_t rbus_addElement(const char * object_name, const char * element)
     return RBUSCORE_SUCCESS;
 }
 
+rbusCoreError_t rbus_addElements(const char * object_name, const char** elements, int num_elements, int* failed_index)
+{
+    rtError err = RT_OK;
+    int32_t index = -1;
+    int i;
+
+    if(failed_index)
+        *failed_index = -1;
+
+    if(NULL == g_connection)
+    {
+        RBUSCORELOG_ERROR("Not connected.");
+        return RBUSCORE_ERROR_INVALID_STATE;
+    }
+
+    if((NULL == object_name) || (NULL == elements) || (0 > num_elements))
+    {
+        RBUSCORELOG_ERROR("Object/element name is NULL");
+        return RBUSCORE_ERROR_INVALID_PARAM;
+    }
+
+    int object_name_len = strlen(object_name);
+    if((MAX_OBJECT_NAME_LENGTH <= object_name_len) || (0 == object_name_len))
+    {
+        RBUSCORELOG_ERROR("object name is too long/short.");
+        return RBUSCORE_ERROR_INVALID_PARAM;
+    }
+
+    for(i = 0; i < num_elements; i++)
+    {
+        int element_name_len = elements[i] ? strlen(elements[i]) : 0;
+        if((MAX_OBJECT_NAME_LENGTH <= element_name_len) || (0 == element_name_len))
+        {
+            RBUSCORELOG_ERROR("element name is too long/short.");
+            if(failed_index)
+                *failed_index = i;
+            return RBUSCORE_ERROR_INVALID_PARAM;
+        }
+    }
+
+    err = rtConnection_AddAliases(g_connection, object_name, elements, (uint32_t)num_elements, &index);
+    if(failed_index)
+        *failed_index = index;
+    if(RT_OK != err)
+    {
+        RBUSCORELOG_ERROR("Failed to add %d elements. Error: 0x%x", num_elements, err);
+        if (RT_ERROR_DUPLICATE_ENTRY == err)
+            return RBUSCORE_ERROR_DUPLICATE_ENTRY;
+        else if (RT_ERROR_PROTOCOL_ERROR == err)
+            return RBUSCORE_ERROR_UNSUPPORTED_ENTRY;
+        else
+            return RBUSCORE_ERROR_GENERAL;
+    }
+
+    RBUSCORELOG_DEBUG("Added %d aliases for object %s.", num_elements, object_name);
+    return RBUSCORE_SUCCESS;
+}
+
 rbusCoreError_t rbus_removeElement(const char * object, const char * element)
 {
     if(NULL == g_connection)
@@ -1096,40 +1175,12 @@ static rtError rbus_sendRequest(rtConnection con, rbusMessage req, char const* t
     return err;
 }
 
-rbusCoreError_t rbus_invokeRemoteMethod(const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbusMessage *in)
+/*map the outcome of a request to the rbuscore error, releasing the response unless it is a valid one*/
+static rbusCoreError_t rbus_checkResponse(rtError err, const char * object_name, rbusMessage *in)
 {
-    return rbus_invokeRemoteMethod2(g_connection, object_name, method, out, timeout_millisecs, in);
-}
-
-rbusCoreError_t rbus_invokeRemoteMethod2(rtConnection myConn, const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbusMessage *in)
-{
-    rtError err = RT_OK;
     rbusCoreError_t ret = RBUSCORE_SUCCESS;
+    const char * method = NULL;
 
-    char const *traceParent = NULL;
-    char const *traceState = NULL;
-
-    rbus_getOpenTelemetryContext(&traceParent, &traceState);
-
-    if(NULL == myConn)
-    {
-        RBUSCORELOG_ERROR("Not connected.");
-        return RBUSCORE_ERROR_INVALID_STATE;
-    }
-
-    if(MAX_OBJECT_NAME_LENGTH <= strnlen(object_name, MAX_OBJECT_NAME_LENGTH))
-    {
-        RBUSCORELOG_ERROR("Object name is too long.");
-        return RBUSCORE_ERROR_INVALID_PARAM;
-    }
-
-    *in = NULL;
-    if(NULL == out)
-        rbusMessage_Init(&out);
-
-    _rbusMessage_SetMetaInfo(out, method, traceParent, traceState);
-
-    err = rbus_sendRequest(myConn, out, object_name, in, timeout_millisecs);
     if(RT_OK != err)
     {
         if(RT_OBJECT_NO_LONGER_AVAILABLE == err)
@@ -1150,9 +1201,8 @@ rbusCoreError_t rbus_invokeRemoteMethod2(rtConnection myConn, const char * objec
     }
     else
     {
-        method = NULL;
         rbusMessage_BeginMetaSectionRead(*in);
-		    rbusMessage_GetString(*in, &method);
+        rbusMessage_GetString(*in, &method);
         rbusMessage_EndMetaSectionRead(*in);
         if(NULL != method)
         {
@@ -1169,7 +1219,6 @@ rbusCoreError_t rbus_invokeRemoteMethod2(rtConnection myConn, const char * objec
         }
     }
 
-    rbusMessage_Release(out);
     if((RBUSCORE_SUCCESS != ret) && (NULL != *in))
     {
         rbusMessage_Release(*in);
@@ -1178,6 +1227,190 @@ rbusCoreError_t rbus_invokeRemoteMethod2(rtConnection myConn, const char * objec
     return ret;
 }
 
+rbusCoreError_t rbus_invokeRemoteMethod(const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbusMessage *in)
+{
+    return rbus_invokeRemoteMethod2(g_connection, object_name, method, out, timeout_millisecs, in);
+}
+
+rbusCoreError_t rbus_invokeRemoteMethod2(rtConnection myConn, const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbusMessage *in)
+{
+    rtError err = RT_OK;
+    rbusCoreError_t ret = RBUSCORE_SUCCESS;
+
+    char const *traceParent = NULL;
+    char const *traceState = NULL;
+
+    rbus_getOpenTelemetryContext(&traceParent, &traceState);
+
+    if(NULL == myConn)
+    {
+        RBUSCORELOG_ERROR("Not connected.");
+        return RBUSCORE_ERROR_INVALID_STATE;
+    }
+
+    if(MAX_OBJECT_NAME_LENGTH <= strnlen(object_name, MAX_OBJECT_NAME_LENGTH))
+    {
+        RBUSCORELOG_ERROR("Object name is too long.");
+        return RBUSCORE_ERROR_INVALID_PARAM;
+    }
+
+    *in = NULL;
+    if(NULL == out)
+        rbusMessage_Init(&out);
+
+    _rbusMessage_SetMetaInfo(out, method, traceParent, traceState);
+
+    err = rbus_sendRequest(myConn, out, object_name, in, timeout_millisecs);
+    ret = rbus_checkResponse(err, object_name, in);
+
+    rbusMessage_Release(out);
+    return ret;
+}
+
+typedef struct
+{
+    rbus_async_response_callback_t callback;
+    void* user_data;
+    char object_name[MAX_OBJECT_NAME_LENGTH];
+} rbus_async_request_t;
+
+static void rbus_onAsyncResponse(rtError err, uint8_t const* p, uint32_t n, void* closure)
+{
+    rbus_async_request_t* request = (rbus_async_request_t*)closure;
+    rbusMessage in = NULL;
+    rbusCoreError_t ret;
+
+    if(RT_OK == err)
+        rbusMessage_FromBytes(&in, p, n);
+    ret = rbus_checkResponse(err, request->object_name, &in);
+    request->callback(ret, in, request->user_data);
+
+    if(in)
+        rbusMessage_Release(in);
+    free(request);
+}
+
+rbusCoreError_t rbus_invokeRemoteMethodAsync(const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbus_async_response_callback_t callback, void * user_data)
+{
+    return rbus_invokeRemoteMethodAsync2(g_connection, object_name, method, out, timeout_millisecs, callback, user_data);
+}
+
+rbusCoreError_t rbus_invokeRemoteMethodAsync2(rtConnection myConn, const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbus_async_response_callback_t callback, void * user_data)
+{
+    rtError err = RT_OK;
+    char const *traceParent = NULL;
+    char const *traceState = NULL;
+    uint8_t* data = NULL;
+    uint32_t dataLength = 0;
+    rbus_async_request_t* request;
+
+    if(NULL == myConn)
+    {
+        RBUSCORELOG_ERROR("Not connected.");
+        return RBUSCORE_ERROR_INVALID_STATE;
+    }
+
+    if(NULL == callback || MAX_OBJECT_NAME_LENGTH <= strnlen(object_name, MAX_OBJECT_NAME_LENGTH))
+    {
+        RBUSCORELOG_ERROR("Invalid parameter.");
+        return RBUSCORE_ERROR_INVALID_PARAM;
+    }
+
+    request = rt_malloc(sizeof(rbus_async_request_t));
+    request->callback = callback;
+    request->user_data = user_data;
+    strcpy(request->object_name, object_name);
+
+    rbus_getOpenTelemetryContext(&traceParent, &traceState);
+
+    if(NULL == out)
+        rbusMessage_Init(&out);
+    _rbusMessage_SetMetaInfo(out, method, traceParent, traceState);
+    rbusMessage_ToBytes(out, &data, &dataLength);
+
+    err = rtConnection_SendBinaryRequestAsync(myConn, data, dataLength, object_name, rbus_onAsyncResponse, request, timeout_millisecs);
+    rbusMessage_Release(out);
+    if(RT_OK != err)
+    {
+        RBUSCORELOG_ERROR("Failed to send message. Error code: 0x%x", err);
+        free(request);
+        return translate_rt_error(err);
+    }
+    return RBUSCORE_SUCCESS;
+}
+
+rbusCoreError_t rbus_invokeRemoteMethods(int count, const char ** object_names, const char *method, rbusMessage* out, int timeout_millisecs, rbusMessage *in, rbusCoreError_t* errors)
+{
+    rtError err = RT_OK;
+    char const *traceParent = NULL;
+    char const *traceState = NULL;
+    uint8_t const** reqs;
+    uint32_t* reqLengths;
+    uint8_t** rsps;
+    uint32_t* rspLengths;
+    rtError* rtErrors;
+    int i;
+
+    if(NULL == g_connection)
+    {
+        RBUSCORELOG_ERROR("Not connected.");
+        return RBUSCORE_ERROR_INVALID_STATE;
+    }
+
+    if(count < 1 || NULL == object_names || NULL == out || NULL == in || NULL == errors)
+        return RBUSCORE_ERROR_INVALID_PARAM;
+
+    for(i = 0; i < count; ++i)
+    {
+        if(MAX_OBJECT_NAME_LENGTH <= strnlen(object_names[i], MAX_OBJECT_NAME_LENGTH))
+        {
+            RBUSCORELOG_ERROR("Object name is too long.");
+            return RBUSCORE_ERROR_INVALID_PARAM;
+        }
+    }
+
+    reqs = rt_malloc(count * sizeof(uint8_t const*));
+    reqLengths = rt_malloc(count * sizeof(uint32_t));
+    rsps = rt_malloc(count * sizeof(uint8_t*));
+    rspLengths = rt_malloc(count * sizeof(uint32_t));
+    rtErrors = rt_malloc(count * sizeof(rtError));
+
+    rbus_getOpenTelemetryContext(&traceParent, &traceState);
+
+    for(i = 0; i < count; ++i)
+    {
+        uint8_t* data = NULL;
+
+        in[i] = NULL;
+        if(NULL == out[i])
+            rbusMessage_Init(&out[i]);
+        _rbusMessage_SetMetaInfo(out[i], method, traceParent, traceState);
+        rbusMessage_ToBytes(out[i], &data, &reqLengths[i]);
+        reqs[i] = data;
+    }
+
+    err = rtConnection_SendBinaryRequests(g_connection, count, reqs, reqLengths, object_names, rsps, rspLengths, rtErrors, timeout_millisecs);
+
+    for(i = 0; i < count; ++i)
+    {
+        if(RT_OK != err)
+            rtErrors[i] = err;
+        else if(RT_OK == rtErrors[i])
+            rbusMessage_FromBytes(&in[i], rsps[i], rspLengths[i]);
+        rtMessage_FreeByteArray(rsps[i]);
+        errors[i] = rbus_checkResponse(rtErrors[i], object_names[i], &in[i]);
+        rbusMessage_Release(out[i]);
+        out[i] = NULL;
+    }
+
+    free(reqs);
+    free(reqLengths);
+    free(rsps);
+    free(rspLengths);
+    free(rtErrors);
+    return translate_rt_error(err);
+}
+
 
 /*TODO: make this really fire and forget.*/
 rbusCoreError_t rbus_pushObjNoAck(const char * object_name, rbusMessage message)
@@ -1257,7 +1490,10 @@ static int subscription_handler(const char *not_used, const char * method_name,
         {
             rbusMessage_GetInt32(in, &has_payload);
             if(has_payload)
-                rbusMessage_GetMessage(in, &payload);
+            {
+                if(rbusMessage_GetMessage(in, &payload) == RT_OK)
+                    rbusMessage_SetCaps(payload, rbusMessage_GetCaps(in));
+            }
             int added = strncmp(method_name, METHOD_SUBSCRIBE, MAX_METHOD_NAME_LENGTH) == 0 ? 1 : 0;
             rbusCoreError_t ret = server_object_subscription_handler(obj, event_name, sender, added, payload);
             if(payload)
@@ -1437,7 +1673,6 @@ static void master_event_callback(rtMessageHeader const* hdr, uint8_t const* dat
     const char * object_name = NULL;
     int32_t is_rbus_flag = 1;
     rtError err;
-    size_t subs_len;
     size_t i;
     (void)closure;
 
@@ -1480,13 +1715,12 @@ static void master_event_callback(rtMessageHeader const* hdr, uint8_t const* dat
     }
 
     lock();
-    subs_len = rtVector_Size(g_event_subscriptions_for_client);
-    for(i = 0; i < subs_len; ++i)
+    /* support rbus events being elements : the object name will be the event name */
+    for(i = 0; i < 2; ++i)
     {
-        client_subscription_t sub = rtVector_At(g_event_subscriptions_for_client, i);
+        client_subscription_t sub = rtHashMap_Get(g_event_subscriptions_by_object, i == 0 ? sender : event_name);
 
-        if( strncmp(sub->object, sender, MAX_OBJECT_NAME_LENGTH) == 0 ||
-            strncmp(sub->object, event_name, MAX_OBJECT_NAME_LENGTH) == 0 ) /* support rbus events being elements : the object name will be the event name */
+        if(sub)
         {
             client_event_t evt = rtVector_Find(sub->events, event_name, client_event_compare);
 
@@ -1514,7 +1748,7 @@ static rbusCoreError_t remove_subscription_callback(const char * object_name,  c
     rbusCoreError_t ret = RBUSCORE_ERROR_INVALID_PARAM;
 
     lock();
-    sub = rtVector_Find(g_event_subscriptions_for_client, object_name, client_subscription_compare);
+    sub = rtHashMap_Get(g_event_subscriptions_by_object, object_name);
     if(sub)
     {
         client_event_t evt = rtVector_Find(sub->events, event_name, client_event_compare);
@@ -1527,6 +1761,7 @@ static rbusCoreError_t remove_subscription_callback(const char * object_name,  c
             if(rtVector_Size(sub->events) == 0)
             {
                 RBUSCORELOG_DEBUG("Zero event subscriptions remaining for object %s. Cleaning up.", object_name);
+                rtHashMap_Remove(g_event_subscriptions_by_object, sub->object);
                 rtVector_RemoveItem(g_event_subscriptions_for_client, sub, client_subscription_destroy);
             }
         }
@@ -1586,7 +1821,7 @@ static rbusCoreError_t rbus_subscribeToEventInternal(const char * object_name,
 
     if(g_master_event_callback == NULL)
     {
-        sub = rtVector_Find(g_event_subscriptions_for_client, object_name, client_subscription_compare);
+        sub = rtHashMap_Get(g_event_subscriptions_by_object, object_name);
         if(sub)
         {
             if(rtVector_Find(sub->events, event_name, client_event_compare))
@@ -1602,6 +1837,7 @@ static rbusCoreError_t rbus_subscribeToEventInternal(const char * object_name,
             /*sub didn't exist so create it*/
             client_subscription_create(&sub, object_name);
             rtVector_PushBack(g_event_subscriptions_for_client, sub);
+            rtHashMap_Set(g_event_subscriptions_by_object, sub->object, sub);
         }
 
         /*create event and add to sub*/
@@ -1839,6 +2075,69 @@ rbusCoreError_t rbus_publishSubscriberEvent(const char* object_name,  const char
     return ret;
 }
 
+rbusCoreError_t rbus_publishSubscriberEvents(const char* object_name,  const char * event_name, const char** listeners, int num_listeners, rbusMessage out)
+{
+    rbusCoreError_t ret = RBUSCORE_SUCCESS;
+    const char** brokered;
+    int num_brokered = 0;
+    uint8_t* data;
+    uint32_t dataLength;
+    int i;
+
+    if(num_listeners == 1)
+        return rbus_publishSubscriberEvent(object_name, event_name, listeners[0], out);
+    if(NULL == event_name)
+        event_name = DEFAULT_EVENT;
+    if(MAX_OBJECT_NAME_LENGTH <= strnlen(object_name, MAX_OBJECT_NAME_LENGTH))
+    {
+        RBUSCORELOG_ERROR("Object name is too long.");
+        return RBUSCORE_ERROR_INVALID_PARAM;
+    }
+    if(NULL == g_connection)
+    {
+        RBUSCORELOG_ERROR("Not connected.");
+        return RBUSCORE_ERROR_INVALID_STATE;
+    }
+    rbusMessage_BeginMetaSectionWrite(out);
+    rbusMessage_SetString(out, event_name);
+    rbusMessage_SetString(out, object_name); 
+    rbusMessage_SetInt32(out, 1);/*is rbus 2.0*/ 
+    rbusMessage_EndMetaSectionWrite(out);
+    rbusMessage_ToBytes(out, &data, &dataLength);
+
+    brokered = rt_malloc(sizeof(char*) * num_listeners);
+    for(i = 0; i < num_listeners; ++i)
+    {
+        const rtPrivateClientInfo *pPrivCliInfo = _rbuscore_find_server_privateconnection (event_name, listeners[i]);
+        if(pPrivCliInfo)
+            rtRouteDirect_SendMessage (pPrivCliInfo, data, dataLength);
+        else
+            brokered[num_brokered++] = listeners[i];
+    }
+
+    if(num_brokered > 0)
+    {
+        rtError err;
+
+        lock();
+        if(NULL == get_object(object_name))
+        {
+            RBUSCORELOG_ERROR("Could not find object %s", object_name);
+            ret = RBUSCORE_ERROR_INVALID_PARAM;
+        }
+        for(i = 0; i < num_brokered; i += RTMSG_MULTICAST_MAX_LISTENERS)
+        {
+            int count = num_brokered - i < RTMSG_MULTICAST_MAX_LISTENERS ? num_brokered - i : RTMSG_MULTICAST_MAX_LISTENERS;
+            err = rtConnection_SendBinaryMulticast(g_connection, data, dataLength, &brokered[i], count, object_name);
+            if(err != RT_OK)
+                RBUSCORELOG_ERROR("Couldn't send event %s::%s to %d listeners.", object_name, event_name, count);
+        }
+        unlock();
+    }
+    free(brokered);
+    return ret;
+}
+
 rbusCoreError_t rbus_discoverWildcardDestinations(const char * expression, int * count, char *** destinations)
 {
     rbusCoreError_t ret = RBUSCORE_SUCCESS;
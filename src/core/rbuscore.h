@@ -41,6 +41,7 @@ extern "C" {
 #endif
 typedef int (*rbus_callback_t)(const char * destination, const char * method, rbusMessage in, void * user_data, rbusMessage *out, const rtMessageHeader* hdr);
 typedef int (*rbus_async_callback_t)(rbusMessage message, void * user_data);
+typedef void (*rbus_async_response_callback_t)(rbusCoreError_t err, rbusMessage response, void * user_data);
 typedef int (*rbus_event_callback_t)(const char * object_name,  const char * event_name, rbusMessage message, void * user_data);
 typedef int (*rbus_timed_update_event_callback_t)(rbusMessage *message);
 typedef int (*rbus_event_subscribe_callback_t)(const char * object_name,  const char * event_name, const char * listener, int added, const rbusMessage payload, void * user_data);
@@ -83,6 +84,9 @@ rbusCoreError_t rbus_unregisterObj(const char * object_name);
  * you have the option to look at the intended recipient (foo vs xyz vs abc) and act accordingly. Elements don't get their own methods/callbacks. They rely on the 
  * callbacks installed for the parent object to get the job done. In other words, elements are an alias for the object.*/
 rbusCoreError_t rbus_addElement(const char * object_name, const char* element);
+/* Adds several elements to an object in one round trip to the broker. Either all of them are added or none are.
+ * If failed_index is not NULL it is set to the element that was rejected, or -1. */
+rbusCoreError_t rbus_addElements(const char * object_name, const char** elements, int num_elements, int* failed_index);
 rbusCoreError_t rbus_removeElement(const char * object_name, const char * element);
 
 /* Register a remote procedure call for an object. Any messages on the bus sent to this object, bearing the registered method, will lead to the installed handler being invoked. */
@@ -104,10 +108,17 @@ rbusCoreError_t rbus_unregisterMethodTable(const char * object_name, rbus_method
 rbusCoreError_t rbus_invokeRemoteMethod(const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbusMessage *in);
 rbusCoreError_t rbus_invokeRemoteMethod2(rtConnection conn, const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbusMessage *in);
 
+/* Invoke 'method' on 'count' objects at once. All requests are sent before any response is awaited and 'timeout_millisecs' bounds the whole
+ * call rather than each request. Each out[i] is released internally; errors[i] holds the result for object_names[i] and, when it is RBUSCORE_SUCCESS,
+ * the caller must release in[i]. */
+rbusCoreError_t rbus_invokeRemoteMethods(int count, const char ** object_names, const char *method, rbusMessage* out, int timeout_millisecs, rbusMessage *in, rbusCoreError_t* errors);
+
 /* Invoke a remote procedure call 'method' on a destination/object object_name. 'out' has the input arguments necessary for the RPC. This function does not block for response
  * from the remote end. It returns immediately after the outbound message is dispatched. 'callback' is invoked when it receives the response to the RPC call, or if it times out 
- * waiting for a response. The callback will contain the response from the remote end. Marshalling of input arguments and output response is the responsibility of the caller.*/
-rbusCoreError_t rbus_invokeRemoteMethodAsync(const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbus_async_callback_t callback);
+ * waiting for a response. The callback will contain the response from the remote end. Marshalling of input arguments and output response is the responsibility of the caller.
+ * 'callback' runs once, only if this returns RBUSCORE_SUCCESS, on the connection's reader thread or its timeout thread; the response is released when it returns. rbus will release 'out' internally.*/
+rbusCoreError_t rbus_invokeRemoteMethodAsync(const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbus_async_response_callback_t callback, void * user_data);
+rbusCoreError_t rbus_invokeRemoteMethodAsync2(rtConnection conn, const char * object_name, const char *method, rbusMessage out, int timeout_millisecs, rbus_async_response_callback_t callback, void * user_data);
 /* Notes on using event APIs:
  * An object_name is a discoverable entity on the bus that is the source of some events. An event source can issue multiple types of events, where each unique type is identified
  * by event_name. A simpler object_name can issue just one type of event, with event_name = 0 always. To receive events, clients have to subscribe to an object_name. 
@@ -161,6 +172,10 @@ rbusCoreError_t rbus_unregisterClientDisconnectHandler();
 /* Send an event message directly to a specific subscribe(e.g. listener) */
 rbusCoreError_t rbus_publishSubscriberEvent(const char* object_name,  const char * event_name, const char* listener, rbusMessage out);
 
+/* Send the same event message to several listeners. Listeners reached through the broker share a
+   single write; the broker fans the message out to each of them. */
+rbusCoreError_t rbus_publishSubscriberEvents(const char* object_name,  const char * event_name, const char** listeners, int num_listeners, rbusMessage out);
+
 /*------ Convenience functions built on top of base functions above. ------*/
 
 
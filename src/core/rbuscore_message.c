@@ -80,6 +80,7 @@ struct _rbusMessage
     msgpack_unpacked upk;
     size_t read_offset;
     int meta_offset;
+    uint32_t caps;
 };
 
 void rbusMessage_Init(rbusMessage* message)
@@ -91,6 +92,7 @@ void rbusMessage_Init(rbusMessage* message)
     *message = ptr;
     ptr->read_offset = 0;
     ptr->meta_offset = 0;
+    ptr->caps = 0;
     (*message)->retainable.refCount = 1;
 }
 
@@ -123,6 +125,7 @@ void rbusMessage_FromBytes(rbusMessage* message, uint8_t const* buff, uint32_t n
     *message = ptr;
     ptr->read_offset = 0;
     ptr->meta_offset = 0;
+    ptr->caps = 0;
     (*message)->retainable.refCount = 1;
 }
 
@@ -250,6 +253,29 @@ rtError rbusMessage_GetDouble(rbusMessage const message, double* value)
     return RT_OK;
 }
 
+rtError rbusMessage_TryGetBytes(rbusMessage message, uint8_t const** value, uint32_t* size)
+{
+    /*peek at the next item and only move past it if it is a byte array*/
+    size_t offset = message->read_offset;
+    if(msgpack_unpack_next(&message->upk, message->sbuf.data, message->sbuf.size, &offset) != MSGPACK_UNPACK_SUCCESS ||
+       message->upk.data.type != MSGPACK_OBJECT_BIN)
+        return RT_FAIL;
+    message->read_offset = offset;
+    *size = message->upk.data.via.bin.size;
+    *value = (uint8_t const*)message->upk.data.via.bin.ptr;
+    return RT_OK;
+}
+
+void rbusMessage_SetCaps(rbusMessage message, uint32_t caps)
+{
+    message->caps = caps;
+}
+
+uint32_t rbusMessage_GetCaps(rbusMessage message)
+{
+    return message->caps;
+}
+
 rtError rbusMessage_SetMessage(rbusMessage message, rbusMessage const item)
 {
     VERIFY_PACK_BUFFER(bin, item->sbuf.data, item->sbuf.size);
@@ -282,6 +308,11 @@ void rbusMessage_BeginMetaSectionRead(rbusMessage message)
     message->read_offset = section_offset;
 }
 
+int rbusMessage_MetaSectionHasMore(rbusMessage message)
+{
+    return message->read_offset < message->sbuf.size - 5;
+}
+
 void rbusMessage_EndMetaSectionRead(rbusMessage message)
 {
     message->read_offset = message->meta_offset;
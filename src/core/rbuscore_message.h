@@ -29,6 +29,9 @@ extern "C" {
 struct _rbusMessage;
 typedef struct _rbusMessage* rbusMessage;
 
+/*capability bits a sender advertises in a message's meta section*/
+#define RBUS_MESSAGE_CAP_TLV 0x1 /*the sender can read properties and objects packed as one rbusBuffer TLV block*/
+
 void rbusMessage_Init(rbusMessage* message);
 void rbusMessage_Retain(rbusMessage message);
 void rbusMessage_Release(rbusMessage message);
@@ -42,6 +45,8 @@ rtError rbusMessage_GetString(rbusMessage const message, char const** value);
 
 rtError rbusMessage_SetBytes(rbusMessage message, uint8_t const* value, uint32_t size);
 rtError rbusMessage_GetBytes(rbusMessage message, uint8_t const** value, uint32_t *size);
+/*like GetBytes but leaves the read position alone and fails quietly if the next item isn't bytes*/
+rtError rbusMessage_TryGetBytes(rbusMessage message, uint8_t const** value, uint32_t *size);
 
 rtError rbusMessage_SetInt32(rbusMessage message, int32_t value);
 rtError rbusMessage_GetInt32(rbusMessage const message, int32_t* value);
@@ -56,6 +61,10 @@ rtError rbusMessage_GetDouble(rbusMessage const message, double* value);
 rtError rbusMessage_SetMessage(rbusMessage message, rbusMessage const item);
 rtError rbusMessage_GetMessage(rbusMessage const message, rbusMessage* value);
 
+/*capabilities are sent in the meta section so they only reach peers whose rbuscore reads them*/
+void rbusMessage_SetCaps(rbusMessage message, uint32_t caps);
+uint32_t rbusMessage_GetCaps(rbusMessage message);
+
 #ifdef __cplusplus
 }
 #endif
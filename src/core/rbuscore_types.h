@@ -70,6 +70,8 @@ typedef enum _rbuscore_bus_status
 #define METHOD_COMMIT "METHOD_COMMIT"
 #define METHOD_ADDTBLROW "METHOD_ADDTBLROW"
 #define METHOD_DELETETBLROW "METHOD_DELETETBLROW"
+#define METHOD_ADDTBLROWS "METHOD_ADDTBLROWS"
+#define METHOD_DELETETBLROWS "METHOD_DELETETBLROWS"
 #define METHOD_RPC "METHOD_RPC"
 #define METHOD_RESPONSE "METHOD_RESPONSE"
 #define METHOD_SUBSCRIBE "METHOD_SUBSCRIBE"
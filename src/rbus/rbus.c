@@ -33,6 +33,7 @@
 #include "rbus_valuechange.h"
 #include "rbus_subscriptions.h"
 #include "rbus_asyncsubscribe.h"
+#include "rbus_executor.h"
 #include "rbus_intervalsubscription.h"
 #include "rbus_config.h"
 #include "rbus_log.h"
@@ -65,6 +66,7 @@
 struct _rbusMethodAsyncHandle
 {
     rtMessageHeader hdr;
+    uint32_t caps;  /*capabilities the caller advertised, so the late response uses what it reads*/
 };
 
 typedef enum _rbus_legacy_support
@@ -103,6 +105,7 @@ typedef enum _rbus_legacy_returns {
 extern char* __progname;
 //******************************* GLOBALS *****************************************//
 static pthread_mutex_t gMutex = PTHREAD_MUTEX_INITIALIZER;
+static bool sDisConnHandler = false;
 
 //********************************************************************************//
 
@@ -224,22 +227,110 @@ void rbusEventSubscription_free(void* p)
     free(sub);
 }
 
-static rbusEventSubscription_t* rbusEventSubscription_find(rtVector eventSubs, char const* eventName,
-        rbusFilter_t filter, uint32_t interval, uint32_t duration)
+/*hashes the parts of a filter that rbusFilter_Compare always tells apart.
+  numeric relation values are left out since rbusValue_Compare equates them across types*/
+static uint32_t rbusEventSubscription_filterHash(rbusFilter_t filter)
 {
-    /*FIXME - convert to map */
-    size_t i;
-    for(i=0; i < rtVector_Size(eventSubs); ++i)
+    uint32_t hash;
+
+    if(!filter)
+        return 0;
+
+    hash = (uint32_t)rbusFilter_GetType(filter) + 1;
+    if(rbusFilter_GetType(filter) == RBUS_FILTER_EXPRESSION_RELATION)
     {
-        rbusEventSubscription_t* sub = (rbusEventSubscription_t*)rtVector_At(eventSubs, i);
-        if(sub && !strcmp(sub->eventName, eventName) && !rbusFilter_Compare(sub->filter, filter)
-                && (sub->interval == interval) && (sub->duration == duration))
+        rbusValue_t value = rbusFilter_GetRelationValue(filter);
+
+        hash = hash * 31 + (uint32_t)rbusFilter_GetRelationOperator(filter);
+        if(value && rbusValue_GetType(value) == RBUS_STRING)
         {
-            return sub;
+            char const* s = rbusValue_GetString(value, NULL);
+            while(s && *s)
+                hash = hash * 31 + (unsigned char)*s++;
         }
     }
-    return NULL;
+    else
+    {
+        hash = hash * 31 + (uint32_t)rbusFilter_GetLogicOperator(filter);
+        hash = hash * 31 + rbusEventSubscription_filterHash(rbusFilter_GetLogicLeft(filter));
+        hash = hash * 31 + rbusEventSubscription_filterHash(rbusFilter_GetLogicRight(filter));
+    }
+    return hash;
+}
+
+static uint32_t eventSubsIndex_Hash(rtHashMap hashmap, const void* key)
+{
+    rbusEventSubscription_t const* sub = key;
+    char const* s = sub->eventName;
+    uint32_t hash = 2166136261u;
+    (void)hashmap;
+
+    while(*s)
+    {
+        hash ^= (unsigned char)*s++;
+        hash *= 16777619u;
+    }
+    hash = hash * 31 + sub->interval;
+    hash = hash * 31 + sub->duration;
+    hash = hash * 31 + rbusEventSubscription_filterHash(sub->filter);
+    return hash;
+}
+
+static int eventSubsIndex_Compare(const void* left, const void* right)
+{
+    rbusEventSubscription_t const* sub1 = left;
+    rbusEventSubscription_t const* sub2 = right;
+
+    if(sub1->interval != sub2->interval || sub1->duration != sub2->duration)
+        return 1;
+    if(strcmp(sub1->eventName, sub2->eventName))
+        return 1;
+    return rbusFilter_Compare(sub1->filter, sub2->filter);
+}
+
+static const void* eventSubsIndex_KeyCopy(const void* key)
+{
+    return key;
+}
+
+static void eventSubsIndex_KeyDestroy(void* key)
+{
+    (void)key;
+}
+
+static rbusEventSubscription_t* rbusEventSubscription_find(struct _rbusHandle* handleInfo, char const* eventName,
+        rbusFilter_t filter, uint32_t interval, uint32_t duration)
+{
+    rbusEventSubscription_t key = {0};
+    rbusEventSubscription_t* sub;
+
+    key.eventName = eventName;
+    key.filter = filter;
+    key.interval = interval;
+    key.duration = duration;
+
+    pthread_mutex_lock(&handleInfo->eventSubsMutex);
+    sub = rtHashMap_Get(handleInfo->eventSubsIndex, &key);
+    pthread_mutex_unlock(&handleInfo->eventSubsMutex);
+    return sub;
 }
+
+static void rbusEventSubscription_add(struct _rbusHandle* handleInfo, rbusEventSubscription_t* sub)
+{
+    pthread_mutex_lock(&handleInfo->eventSubsMutex);
+    rtVector_PushBack(handleInfo->eventSubs, sub);
+    rtHashMap_Set(handleInfo->eventSubsIndex, sub, sub);
+    pthread_mutex_unlock(&handleInfo->eventSubsMutex);
+}
+
+static void rbusEventSubscription_remove(struct _rbusHandle* handleInfo, rbusEventSubscription_t* sub, rtVector_Cleanup destroyer)
+{
+    pthread_mutex_lock(&handleInfo->eventSubsMutex);
+    rtHashMap_Remove(handleInfo->eventSubsIndex, sub);
+    rtVector_RemoveItem(handleInfo->eventSubs, sub, destroyer);
+    pthread_mutex_unlock(&handleInfo->eventSubsMutex);
+}
+
 static bool _parse_rbusData_to_value (char const* pBuff, rbusLegacyDataType_t legacyType, rbusValue_t value)
 {
     bool rc = false;
@@ -325,10 +416,63 @@ void rbusObject_appendToMessage(rbusObject_t obj, rbusMessage msg);
 void rbusEventData_updateFromMessage(rbusEvent_t* event, rbusFilter_t* filter, uint32_t* interval,
         uint32_t* duration, int32_t* componentId, rbusMessage msg);
 void rbusEventData_appendToMessage(rbusEvent_t* event, rbusFilter_t filter, uint32_t interval,
-        uint32_t duration, int32_t componentId, rbusMessage msg);
+        uint32_t duration, int32_t componentId, bool tlv, rbusMessage msg);
 void rbusFilter_AppendToMessage(rbusFilter_t filter, rbusMessage msg);
 void rbusFilter_InitFromMessage(rbusFilter_t* filter, rbusMessage msg);
 
+/*
+    Peers that advertise RBUS_MESSAGE_CAP_TLV get properties and objects as a single rbusBuffer
+    block, nested in the message as bytes, instead of a msgpack item for every name, type and value.
+    Wherever a block can appear the msgpack encoding starts with a string, so readers tell the two
+    apart by the item type and older peers keep getting what they expect.
+*/
+static rbusBuffer_t rbusTlvBlock_Begin(bool tlv)
+{
+    rbusBuffer_t block = NULL;
+    if(tlv)
+        rbusBuffer_Create(&block);
+    return block;
+}
+
+static void rbusTlvBlock_AppendProperty(rbusBuffer_t block, rbusProperty_t prop, rbusMessage msg)
+{
+    if(block)
+        rbusProperty_Encode(prop, block);
+    else
+        rbusValue_appendToMessage(rbusProperty_GetName(prop), rbusProperty_GetValue(prop), msg);
+}
+
+static void rbusTlvBlock_AppendObject(rbusBuffer_t block, rbusObject_t obj, rbusMessage msg)
+{
+    if(block)
+        rbusObject_Encode(obj, block);
+    else
+        rbusObject_appendToMessage(obj, msg);
+}
+
+static void rbusTlvBlock_End(rbusBuffer_t block, rbusMessage msg)
+{
+    if(block)
+    {
+        rbusMessage_SetBytes(msg, block->data, block->posWrite);
+        rbusBuffer_Destroy(block);
+    }
+}
+
+/*if the next item is a block, point block at it without copying*/
+static bool rbusTlvBlock_Get(rbusMessage msg, struct _rbusBuffer* block)
+{
+    uint8_t const* data;
+    uint32_t length;
+
+    if(rbusMessage_TryGetBytes(msg, &data, &length) != RT_OK)
+        return false;
+    block->data = (uint8_t*)data;
+    block->lenAlloc = block->posWrite = (int)length;
+    block->posRead = 0;
+    return true;
+}
+
 rbusError_t rbusValue_initFromMessage(rbusValue_t* value, rbusMessage msg)
 {
     uint8_t const* data;
@@ -537,6 +681,17 @@ void rbusObject_initFromMessage(rbusObject_t* obj, rbusMessage msg)
     int numChild = 0;
     rbusProperty_t prop;
     rbusObject_t children=NULL, previous=NULL;
+    struct _rbusBuffer block;
+
+    if(rbusTlvBlock_Get(msg, &block))
+    {
+        if(rbusObject_Decode(obj, &block) < 0)
+        {
+            RBUSLOG_WARN("%s: failed to decode object", __FUNCTION__);
+            rbusObject_Init(obj, NULL);
+        }
+        return;
+    }
 
     rbusMessage_GetString(msg, &name);
     rbusMessage_GetInt32(msg, &type);
@@ -735,14 +890,17 @@ void rbusEventData_updateFromMessage(rbusEvent_t* event, rbusFilter_t* filter,
 }
 
 void rbusEventData_appendToMessage(rbusEvent_t* event, rbusFilter_t filter,
-        uint32_t interval, uint32_t duration, int32_t componentId, rbusMessage msg)
+        uint32_t interval, uint32_t duration, int32_t componentId, bool tlv, rbusMessage msg)
 {
+    rbusBuffer_t block = rbusTlvBlock_Begin(tlv);
+
     rbusMessage_SetString(msg, event->name);
     rbusMessage_SetInt32(msg, event->type);
 #if DEBUG_SERIALIZER
     RBUSLOG_INFO("> event add name=%s type=%d", event->name, event->type);
 #endif
-    rbusObject_appendToMessage(event->data, msg);
+    rbusTlvBlock_AppendObject(block, event->data, msg);
+    rbusTlvBlock_End(block, msg);
     if(filter)
     {
         rbusMessage_SetInt32(msg, 1);
@@ -1004,112 +1162,212 @@ int subscribeHandlerImpl(
     return RBUS_ERROR_SUCCESS;
 }
 
-static void registerTableRow (rbusHandle_t handle, elementNode* tableInstElem, char const* tableName, char const* aliasName, uint32_t instNum)
+static void publishTableRowCreated (rbusHandle_t handle, char const* tableName, elementNode* rowElem, char const* aliasName, uint32_t instNum)
 {
-    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
-    elementNode* rowElem;
+    rbusEvent_t event = {0};
+    rbusError_t respub;
+    rbusObject_t data;
+    rbusValue_t instNumVal;
+    rbusValue_t aliasVal;
+    rbusValue_t rowNameVal;
+
+    rbusValue_Init(&rowNameVal);
+    rbusValue_Init(&instNumVal);
+    rbusValue_Init(&aliasVal);
+
+    rbusValue_SetString(rowNameVal, rowElem->fullName);
+    rbusValue_SetUInt32(instNumVal, instNum);
+    rbusValue_SetString(aliasVal, aliasName ? aliasName : "");
+
+    rbusObject_Init(&data, NULL);
+    rbusObject_SetValue(data, "rowName", rowNameVal);
+    rbusObject_SetValue(data, "instNum", instNumVal);
+    rbusObject_SetValue(data, "alias", aliasVal);
 
-    RBUSLOG_DEBUG("%s table [%s] alias [%s] instNum [%u]", __FUNCTION__, tableName, aliasName, instNum);
+    event.name = tableName;
+    event.type = RBUS_EVENT_OBJECT_CREATED;
+    event.data = data;
 
-    rowElem = instantiateTableRow(tableInstElem, instNum, aliasName);
+    RBUSLOG_INFO("%s publishing ObjectCreated table=%s rowName=%s", __FUNCTION__, tableName, rowElem->fullName);
+    respub = rbusEvent_Publish(handle, &event);
+
+    if(respub != RBUS_ERROR_SUCCESS && respub != RBUS_ERROR_NOSUBSCRIBERS)
+    {
+        RBUSLOG_WARN("failed to publish ObjectCreated event err:%d", respub);
+    }
+
+    rbusValue_Release(rowNameVal);
+    rbusValue_Release(instNumVal);
+    rbusValue_Release(aliasVal);
+    rbusObject_Release(data);
+}
+
+static void publishTableRowDeleted (rbusHandle_t handle, char const* tableName, char const* rowName)
+{
+    rbusEvent_t event = {0};
+    rbusError_t respub;
+    rbusValue_t rowNameVal;
+    rbusObject_t data;
+
+    rbusValue_Init(&rowNameVal);
+    rbusValue_SetString(rowNameVal, rowName);
+
+    rbusObject_Init(&data, NULL);
+    rbusObject_SetValue(data, "rowName", rowNameVal);
+
+    event.name = tableName;
+    event.data = data;
+    event.type = RBUS_EVENT_OBJECT_DELETED;
+    RBUSLOG_INFO("%s publishing ObjectDeleted table=%s rowName=%s", __FUNCTION__, tableName, rowName);
+    respub = rbusEvent_Publish(handle, &event);
+
+    rbusValue_Release(rowNameVal);
+    rbusObject_Release(data);
+
+    /*the table itself is gone if a row enclosing it was removed in the same batch*/
+    if(respub != RBUS_ERROR_SUCCESS && respub != RBUS_ERROR_NOSUBSCRIBERS && respub != RBUS_ERROR_ELEMENT_DOES_NOT_EXIST)
+    {
+        RBUSLOG_WARN("failed to publish ObjectDeleted event err:%d", respub);
+    }
+}
 
-    rbusSubscriptions_onTableRowAdded(handleInfo->subscriptions, rowElem);
+/*  instantiates numRows rows of one table, matching subscriptions against all of them in one pass
+ *  and publishing their OBJECT_CREATED events only once every row exists
+ */
+static void registerTableRows (rbusHandle_t handle, elementNode* tableInstElem, char const* tableName, int numRows, char const** aliasNames, uint32_t const* instNums)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    elementNode** rowElems;
+    int i;
 
-    /*update ValueChange after rbusSubscriptions_onTableRowAdded */
-    valueChangeTableRowUpdate(handle, rowElem, true);
+    rowElems = rt_malloc(sizeof(elementNode*) * numRows);
 
-    /*send OBJECT_CREATED event after we create the row*/
+    for(i = 0; i < numRows; ++i)
     {
-        rbusEvent_t event = {0};
-        rbusError_t respub;
-        rbusObject_t data;
-        rbusValue_t instNumVal;
-        rbusValue_t aliasVal;
-        rbusValue_t rowNameVal;
+        char const* aliasName = aliasNames ? aliasNames[i] : NULL;
 
-        rbusValue_Init(&rowNameVal);
-        rbusValue_Init(&instNumVal);
-        rbusValue_Init(&aliasVal);
+        RBUSLOG_DEBUG("%s table [%s] alias [%s] instNum [%u]", __FUNCTION__, tableName, aliasName, instNums[i]);
 
-        rbusValue_SetString(rowNameVal, rowElem->fullName);
-        rbusValue_SetUInt32(instNumVal, instNum);
-        rbusValue_SetString(aliasVal, aliasName ? aliasName : "");
+        rowElems[i] = instantiateTableRow(tableInstElem, instNums[i], aliasName);
+    }
 
-        rbusObject_Init(&data, NULL);
-        rbusObject_SetValue(data, "rowName", rowNameVal);
-        rbusObject_SetValue(data, "instNum", instNumVal);
-        rbusObject_SetValue(data, "alias", aliasVal);
+    rbusSubscriptions_onTableRowsAdded(handleInfo->subscriptions, rowElems, numRows);
 
-        event.name = tableName;
-        event.type = RBUS_EVENT_OBJECT_CREATED;
-        event.data = data;
+    /*update ValueChange after rbusSubscriptions_onTableRowsAdded */
+    for(i = 0; i < numRows; ++i)
+    {
+        if(rowElems[i])
+            valueChangeTableRowUpdate(handle, rowElems[i], true);
+    }
 
-        RBUSLOG_INFO("%s publishing ObjectCreated table=%s rowName=%s", __FUNCTION__, tableName, rowElem->fullName);
-        respub = rbusEvent_Publish(handle, &event);
+    /*send OBJECT_CREATED events after we create the rows*/
+    if(tableInstElem->subscriptions)
+    {
+        for(i = 0; i < numRows; ++i)
+        {
+            if(rowElems[i])
+                publishTableRowCreated(handle, tableName, rowElems[i], aliasNames ? aliasNames[i] : NULL, instNums[i]);
+        }
+    }
 
-        if(respub != RBUS_ERROR_SUCCESS && respub != RBUS_ERROR_NOSUBSCRIBERS)
+    /* Re-subscribe all the child elements of these rows */
+    if(handleInfo->subscriptions)
+    {
+        for(i = 0; i < numRows; ++i)
         {
-            RBUSLOG_WARN("failed to publish ObjectCreated event err:%d", respub);
+            if(rowElems[i])
+                rbusSubscriptions_resubscribeRowElementCache(handle, handleInfo->subscriptions, rowElems[i]);
         }
+    }
 
-        /* Re-subscribe all the child elements of this row */
-        if(handleInfo->subscriptions)
-            rbusSubscriptions_resubscribeRowElementCache(handle, handleInfo->subscriptions, rowElem);
+    free(rowElems);
+}
 
-        rbusValue_Release(rowNameVal);
-        rbusValue_Release(instNumVal);
-        rbusValue_Release(aliasVal);
-        rbusObject_Release(data);
-    }
+static void registerTableRow (rbusHandle_t handle, elementNode* tableInstElem, char const* tableName, char const* aliasName, uint32_t instNum)
+{
+    registerTableRows(handle, tableInstElem, tableName, 1, &aliasName, &instNum);
 }
 
-static void unregisterTableRow (rbusHandle_t handle, elementNode* rowInstElem)
+/*  deletes a row, returning the names its OBJECT_DELETED event is published with.
+ *  must dup the names because we are deleting the instance
+ */
+static void removeTableRow (rbusHandle_t handle, elementNode* rowInstElem, char** rowName, char** tableName)
 {
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
-    char* rowInstName = strdup(rowInstElem->fullName); /*must dup because we are deleting the instance*/
     elementNode* tableInstElem = rowInstElem->parent;
+    size_t len;
 
     RBUSLOG_DEBUG("%s [%s]", __FUNCTION__, rowInstElem->fullName);
 
+    *rowName = strdup(rowInstElem->fullName);
+
+    /*must end the table name with a dot(.)*/
+    len = strlen(tableInstElem->fullName);
+    *tableName = rt_malloc(len + 2);
+    memcpy(*tableName, tableInstElem->fullName, len);
+    (*tableName)[len] = '.';
+    (*tableName)[len+1] = '\0';
+
     /*update ValueChange before rbusSubscriptions_onTableRowRemoved */
     valueChangeTableRowUpdate(handle, rowInstElem, false);
 
     rbusSubscriptions_onTableRowRemoved(handleInfo->subscriptions, rowInstElem);
 
     deleteTableRow(rowInstElem);
+}
 
-    /*send OBJECT_DELETED event after we delete the row*/
-    {
-        rbusEvent_t event = {0};
-        rbusError_t respub;
-        rbusValue_t rowNameVal;
-        rbusObject_t data;
-        char tableName[RBUS_MAX_NAME_LENGTH];
+static void unregisterTableRow (rbusHandle_t handle, elementNode* rowInstElem)
+{
+    char* rowName;
+    char* tableName;
+
+    removeTableRow(handle, rowInstElem, &rowName, &tableName);
 
-        /*must end the table name with a dot(.)*/
-        snprintf(tableName, RBUS_MAX_NAME_LENGTH, "%s.", tableInstElem->fullName);
+    /*send OBJECT_DELETED event after we delete the row*/
+    publishTableRowDeleted(handle, tableName, rowName);
 
-        rbusValue_Init(&rowNameVal);
-        rbusValue_SetString(rowNameVal, rowInstName);
+    free(rowName);
+    free(tableName);
+}
 
-        rbusObject_Init(&data, NULL);
-        rbusObject_SetValue(data, "rowName", rowNameVal);
+/*  deletes the named rows, publishing their OBJECT_DELETED events once every row is gone.
+ *  rows are looked up as they are deleted since a row can be nested in one deleted before it
+ */
+static void unregisterTableRows (rbusHandle_t handle, int numRows, char const** rowNames)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    char** deletedRows;
+    char** deletedTables;
+    int numDeleted = 0;
+    int i;
 
-        event.name = tableName;
-        event.data = data;
-        event.type = RBUS_EVENT_OBJECT_DELETED;
-        RBUSLOG_INFO("%s publishing ObjectDeleted table=%s rowName=%s", __FUNCTION__, tableInstElem->fullName, rowInstName);
-        respub = rbusEvent_Publish(handle, &event);
+    deletedRows = rt_malloc(sizeof(char*) * numRows);
+    deletedTables = rt_malloc(sizeof(char*) * numRows);
 
-        rbusValue_Release(rowNameVal);
-        rbusObject_Release(data);
-        free(rowInstName);
+    for(i = 0; i < numRows; ++i)
+    {
+        elementNode* rowInstElem = retrieveInstanceElement(handleInfo->elementRoot, rowNames[i]);
 
-        if(respub != RBUS_ERROR_SUCCESS && respub != RBUS_ERROR_NOSUBSCRIBERS)
+        if(!rowInstElem)
         {
-            RBUSLOG_WARN("failed to publish ObjectDeleted event err:%d", respub);
+            RBUSLOG_DEBUG("%s row already removed %s", __FUNCTION__, rowNames[i]);
+            continue;
         }
+
+        removeTableRow(handle, rowInstElem, &deletedRows[numDeleted], &deletedTables[numDeleted]);
+        numDeleted++;
     }
+
+    /*send OBJECT_DELETED events after we delete the rows*/
+    for(i = 0; i < numDeleted; ++i)
+    {
+        publishTableRowDeleted(handle, deletedTables[i], deletedRows[i]);
+        free(deletedRows[i]);
+        free(deletedTables[i]);
+    }
+
+    free(deletedRows);
+    free(deletedTables);
 }
 //******************************* CALLBACKS *************************************//
 static int _event_subscribe_callback_handler(elementNode* el,  char const* eventName, char const* listener, int added, int componentId, int interval, int duration, rbusFilter_t filter, void* userData)
@@ -1125,7 +1383,14 @@ static int _event_subscribe_callback_handler(elementNode* el,  char const* event
 
 static void _client_disconnect_callback_handler(const char * listener)
 {
-    LockMutex();
+    /*rbus_close holds gMutex while closing the broker connection, which waits on this thread,
+      so stop trying once it has unregistered this handler*/
+    while(pthread_mutex_trylock(&gMutex) != 0)
+    {
+        if(!sDisConnHandler)
+            return;
+        usleep(1000);
+    }
     rbusHandleList_ClientDisconnect(listener);
     UnlockMutex();
 }
@@ -1138,7 +1403,7 @@ void _subscribe_async_callback_handler(rbusHandle_t handle, rbusEventSubscriptio
 
     if(error == RBUS_ERROR_SUCCESS)
     {
-        rtVector_PushBack(handleInfo->eventSubs, subscription);
+        rbusEventSubscription_add(handleInfo, subscription);
     }
     else
     {
@@ -1205,12 +1470,12 @@ static int _master_event_callback_handler(char const* sender, char const* eventN
 
     RBUSLOG_DEBUG("Received master event callback: sender=%s eventName=%s componentId=%d", sender, eventName, componentId);
 
-    subscription = rbusEventSubscription_find(handleInfo->eventSubs, eventName, filter, interval, duration);
+    subscription = rbusEventSubscription_find(handleInfo, eventName, filter, interval, duration);
 
     if(subscription)
     {
         if (event.type == RBUS_EVENT_DURATION_COMPLETE) {
-            rtVector_RemoveItem(handleInfo->eventSubs, subscription, NULL);
+            rbusEventSubscription_remove(handleInfo, subscription, NULL);
             duration_complete = true;
         }
         ((rbusEventHandler_t)subscription->handler)(subscription->handle, &event, subscription);
@@ -1670,6 +1935,7 @@ static void _get_callback_handler (rbusHandle_t handle, rbusMessage request, rbu
     char const *pCompName = NULL;
     rbusProperty_t* properties = NULL;
     rbusGetHandlerOptions_t options;
+    bool tlv = (rbusMessage_GetCaps(request) & RBUS_MESSAGE_CAP_TLV) != 0;
 
     memset(&options, 0, sizeof(options));
     rbusMessage_GetString(request, &pCompName);
@@ -1718,12 +1984,14 @@ static void _get_callback_handler (rbusHandle_t handle, rbusMessage request, rbu
                         rbusMessage_SetInt32(*response, count);
                         if (count > 0)
                         {
+                            rbusBuffer_t block = rbusTlvBlock_Begin(tlv);
                             first = rbusProperty_GetNext(xproperties);
                             for(i = 0; i < count; i++)
                             {
-                                rbusValue_appendToMessage(rbusProperty_GetName(first), rbusProperty_GetValue(first), *response);
+                                rbusTlvBlock_AppendProperty(block, first, *response);
                                 first = rbusProperty_GetNext(first);
                             }
+                            rbusTlvBlock_End(block, *response);
                         }
                     }
                     /* Release the memory */
@@ -1756,11 +2024,13 @@ static void _get_callback_handler (rbusHandle_t handle, rbusMessage request, rbu
         {
             if (result == RBUS_ERROR_SUCCESS)
             {
+                rbusBuffer_t block = rbusTlvBlock_Begin(tlv);
                 rbusMessage_SetInt32(*response, paramSize);
                 for(i = 0; i < paramSize; i++)
                 {
-                    rbusValue_appendToMessage(rbusProperty_GetName(properties[i]), rbusProperty_GetValue(properties[i]), *response);
+                    rbusTlvBlock_AppendProperty(block, properties[i], *response);
                 }
+                rbusTlvBlock_End(block, *response);
             }
         
             /* Free the memory, regardless of success or not.. */
@@ -2103,6 +2373,188 @@ static void _table_remove_row_callback_handler (rbusHandle_t handle, rbusMessage
     rbusMessage_SetInt32(*response, result);
 }
 
+static void _table_add_rows_callback_handler (rbusHandle_t handle, rbusMessage request, rbusMessage* response)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    rbusError_t result = RBUS_ERROR_BUS_ERROR;
+    int sessionId;
+    char const* tableName = NULL;
+    int32_t numRows = 0;
+    char const** aliasNames = NULL;
+    uint32_t* instNums = NULL;
+    int numAdded = 0;
+    int i;
+
+    rbusMessage_GetInt32(request, &sessionId);
+    rbusMessage_GetString(request, &tableName);
+    if(rbusMessage_GetInt32(request, &numRows) != RT_OK || numRows <= 0)
+        numRows = 0;
+
+    if(numRows)
+    {
+        aliasNames = rt_malloc(sizeof(char const*) * numRows);
+        instNums = rt_calloc(numRows, sizeof(uint32_t));
+        for(i = 0; i < numRows; ++i)
+        {
+            if(rbusMessage_GetString(request, &aliasNames[i]) != RT_OK)
+                break;
+            if(strlen(aliasNames[i]) == 0)
+                aliasNames[i] = NULL;
+        }
+        if(i < numRows)
+            numRows = 0;
+    }
+
+    RBUSLOG_DEBUG("%s table [%s] rows [%d] name [%s]", __FUNCTION__, tableName, numRows, handleInfo->componentName);
+
+    elementNode* tableRegElem = tableName ? retrieveElement(handleInfo->elementRoot, tableName) : NULL;
+    elementNode* tableInstElem = tableName ? retrieveInstanceElement(handleInfo->elementRoot, tableName) : NULL;
+
+    if(!numRows)
+    {
+        RBUSLOG_WARN("%s invalid request table [%s]", __FUNCTION__, tableName);
+        result = RBUS_ERROR_INVALID_INPUT;
+    }
+    else if(tableRegElem && tableInstElem)
+    {
+        if(tableRegElem->cbTable.tableAddRowHandler)
+        {
+            RBUSLOG_INFO("%s calling tableAddRowHandler table [%s] for %d rows", __FUNCTION__, tableName, numRows);
+
+            ELM_PRIVATE_LOCK(tableRegElem);
+            for(numAdded = 0; numAdded < numRows; ++numAdded)
+            {
+                result = tableRegElem->cbTable.tableAddRowHandler(handle, tableName, aliasNames[numAdded], &instNums[numAdded]);
+                if(result != RBUS_ERROR_SUCCESS)
+                    break;
+            }
+
+            /*the batch is all or nothing, so take back the rows the provider already added*/
+            if(result != RBUS_ERROR_SUCCESS)
+            {
+                RBUSLOG_WARN("%s tableAddRowHandler failed table [%s] alias [%s]", __FUNCTION__, tableName, aliasNames[numAdded]);
+
+                if(tableRegElem->cbTable.tableRemoveRowHandler)
+                {
+                    for(i = 0; i < numAdded; ++i)
+                    {
+                        char rowName[RBUS_MAX_NAME_LENGTH];
+                        snprintf(rowName, RBUS_MAX_NAME_LENGTH, "%s%u", tableName, instNums[i]);
+                        if(tableRegElem->cbTable.tableRemoveRowHandler(handle, rowName) != RBUS_ERROR_SUCCESS)
+                            RBUSLOG_WARN("%s tableRemoveRowHandler failed to roll back row [%s]", __FUNCTION__, rowName);
+                    }
+                }
+                numAdded = 0;
+            }
+            ELM_PRIVATE_UNLOCK(tableRegElem);
+
+            if (result == RBUS_ERROR_SUCCESS)
+            {
+                registerTableRows(handle, tableInstElem, tableName, numRows, aliasNames, instNums);
+            }
+        }
+        else
+        {
+            RBUSLOG_WARN("%s tableAddRowHandler not registered table [%s]", __FUNCTION__, tableName);
+            result = RBUS_ERROR_INVALID_OPERATION;
+        }
+    }
+    else
+    {
+        RBUSLOG_WARN("%s no element found table [%s]", __FUNCTION__, tableName);
+        result = RBUS_ERROR_ELEMENT_DOES_NOT_EXIST;
+    }
+
+    /*numAdded is always sent, even on failure, so a consumer can tell us apart from a provider without METHOD_ADDTBLROWS*/
+    rbusMessage_Init(response);
+    rbusMessage_SetInt32(*response, result);
+    rbusMessage_SetInt32(*response, numAdded);
+    for(i = 0; i < numAdded; ++i)
+        rbusMessage_SetInt32(*response, (int32_t)instNums[i]);
+
+    free(aliasNames);
+    free(instNums);
+}
+
+static void _table_remove_rows_callback_handler (rbusHandle_t handle, rbusMessage request, rbusMessage* response)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    rbusError_t result = RBUS_ERROR_SUCCESS;
+    int sessionId;
+    int32_t numRows = 0;
+    char const** rowNames = NULL;
+    int numRemoved = 0;
+    int i;
+
+    rbusMessage_GetInt32(request, &sessionId);
+    if(rbusMessage_GetInt32(request, &numRows) != RT_OK || numRows <= 0)
+        numRows = 0;
+
+    if(numRows)
+    {
+        rowNames = rt_malloc(sizeof(char const*) * numRows);
+        for(i = 0; i < numRows; ++i)
+        {
+            if(rbusMessage_GetString(request, &rowNames[i]) != RT_OK)
+                break;
+        }
+        if(i < numRows)
+            numRows = 0;
+    }
+
+    if(!numRows)
+    {
+        RBUSLOG_WARN("%s invalid request", __FUNCTION__);
+        result = RBUS_ERROR_INVALID_INPUT;
+    }
+
+    RBUSLOG_DEBUG("%s rows [%d]", __FUNCTION__, numRows);
+
+    /*stop at the first row that fails; rows removed before it cannot be put back*/
+    for(numRemoved = 0; numRemoved < numRows; ++numRemoved)
+    {
+        char const* rowName = rowNames[numRemoved];
+        elementNode* rowRegElem = retrieveElement(handleInfo->elementRoot, rowName);
+        elementNode* rowInstElem = retrieveInstanceElement(handleInfo->elementRoot, rowName);
+        elementNode* tableRegElem = rowRegElem ? rowRegElem->parent : NULL;
+
+        if(!rowRegElem || !rowInstElem || !tableRegElem || !rowInstElem->parent)
+        {
+            RBUSLOG_WARN("%s no element found row [%s]", __FUNCTION__, rowName);
+            result = RBUS_ERROR_ELEMENT_DOES_NOT_EXIST;
+            break;
+        }
+
+        if(!tableRegElem->cbTable.tableRemoveRowHandler)
+        {
+            RBUSLOG_INFO("%s tableRemoveRowHandler not registered row [%s]", __FUNCTION__, rowName);
+            result = RBUS_ERROR_INVALID_OPERATION;
+            break;
+        }
+
+        RBUSLOG_INFO("%s calling tableRemoveRowHandler row [%s]", __FUNCTION__, rowName);
+
+        ELM_PRIVATE_LOCK(tableRegElem);
+        result = tableRegElem->cbTable.tableRemoveRowHandler(handle, rowName);
+        ELM_PRIVATE_UNLOCK(tableRegElem);
+
+        if(result != RBUS_ERROR_SUCCESS)
+        {
+            RBUSLOG_WARN("%s tableRemoveRowHandler failed row [%s]", __FUNCTION__, rowName);
+            break;
+        }
+    }
+
+    if(numRemoved)
+        unregisterTableRows(handle, numRemoved, rowNames);
+
+    rbusMessage_Init(response);
+    rbusMessage_SetInt32(*response, result);
+    rbusMessage_SetInt32(*response, numRemoved);
+
+    free(rowNames);
+}
+
 static int _method_callback_handler(rbusHandle_t handle, rbusMessage request, rbusMessage* response, const rtMessageHeader* hdr)
 {
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
@@ -2112,6 +2564,7 @@ static int _method_callback_handler(rbusHandle_t handle, rbusMessage request, rb
     rbusObject_t inParams, outParams;
     rbusValue_t value1, value2;
     rbusValue_t outParamsVal = NULL;
+    rbusBuffer_t block;
 
     rbusValue_Init(&value1);
     rbusValue_Init(&value2);
@@ -2135,6 +2588,7 @@ static int _method_callback_handler(rbusHandle_t handle, rbusMessage request, rb
 
             rbusMethodAsyncHandle_t asyncHandle = rt_malloc(sizeof(struct _rbusMethodAsyncHandle));
             asyncHandle->hdr = *hdr;
+            asyncHandle->caps = rbusMessage_GetCaps(request);
 
             ELM_PRIVATE_LOCK(methRegElem);
             result = methRegElem->cbTable.methodHandler(handle, methodName, inParams, outParams, asyncHandle);
@@ -2195,7 +2649,9 @@ static int _method_callback_handler(rbusHandle_t handle, rbusMessage request, rb
     {
         rbusMessage_Init(response);
         rbusMessage_SetInt32(*response, result);
-        rbusObject_appendToMessage(outParams, *response);
+        block = rbusTlvBlock_Begin((rbusMessage_GetCaps(request) & RBUS_MESSAGE_CAP_TLV) != 0);
+        rbusTlvBlock_AppendObject(block, outParams, *response);
+        rbusTlvBlock_End(block, *response);
         rbusObject_Release(outParams);
         return RBUSCORE_SUCCESS; 
     }
@@ -2267,6 +2723,12 @@ static void _subscribe_callback_handler (rbusHandle_t handle, rbusMessage reques
                 rbusMessage_GetInt32(request, &publishOnSubscribe);
             if(ret == RBUS_ERROR_SUCCESS)
                 ret = _event_subscribe_callback_handler(el, event_name, sender, added, componentId, interval, duration, filter, handle);
+            if(added && ret == RBUS_ERROR_SUCCESS)
+            {
+                rbusSubscription_t* subscription = rbusSubscriptions_getSubscription(handleInfo->subscriptions, sender, event_name, componentId, filter);
+                if(subscription)
+                    subscription->tlv = (rbusMessage_GetCaps(request) & RBUS_MESSAGE_CAP_TLV) != 0;
+            }
             rbusMessage_SetInt32(*response, ret);
 
             if(publishOnSubscribe && ret == RBUS_ERROR_SUCCESS)
@@ -2353,7 +2815,8 @@ static void _subscribe_callback_handler (rbusHandle_t handle, rbusMessage reques
                     event.data = data;
                     rbusMessage_SetInt32(*response, 1); /* Based on this value initial value will be published to the consumer in
                                                            rbusEvent_SubscribeWithRetries() function call */
-                    rbusEventData_appendToMessage(&event, filter, interval, duration, handleInfo->componentId, *response);
+                    rbusEventData_appendToMessage(&event, filter, interval, duration, handleInfo->componentId,
+                        (rbusMessage_GetCaps(request) & RBUS_MESSAGE_CAP_TLV) != 0, *response);
                     rbusProperty_Release(tmpProperties);
                     rbusObject_Release(data);
                 }
@@ -2507,6 +2970,14 @@ static int _callback_handler(char const* destination, char const* method, rbusMe
     {
         _table_remove_row_callback_handler (handle, request, response);
     }
+    else if(!strcmp(method, METHOD_ADDTBLROWS))
+    {
+        _table_add_rows_callback_handler (handle, request, response);
+    }
+    else if(!strcmp(method, METHOD_DELETETBLROWS))
+    {
+        _table_remove_rows_callback_handler (handle, request, response);
+    }
     else if(!strcmp(method, METHOD_SUBSCRIBE) || !strcmp(method, METHOD_UNSUBSCRIBE))
     {
         _subscribe_callback_handler (handle, request, response, method);
@@ -2634,7 +3105,20 @@ rbusError_t rbus_open(rbusHandle_t* handle, char const* componentName)
     tmpHandle->componentId = ++sLastComponentId;
     tmpHandle->m_connection = rbus_getConnection();
     rtVector_Create(&tmpHandle->eventSubs);
+    rtHashMap_CreateEx(&tmpHandle->eventSubsIndex, 0, eventSubsIndex_Hash, eventSubsIndex_Compare,
+        eventSubsIndex_KeyCopy, eventSubsIndex_KeyDestroy, NULL, NULL);
+    pthread_mutex_init(&tmpHandle->eventSubsMutex, NULL);
     rtVector_Create(&tmpHandle->messageCallbacks);
+    rbusDiscoveryCache_Create(&tmpHandle->discoveryCache, rbusConfig_Get()->discoveryCacheTTL);
+
+    /*disconnect advisories drop cached resolutions to the departing component*/
+    if(rbusConfig_Get()->discoveryCacheTTL > 0 && !sDisConnHandler)
+    {
+        if((err = rbus_registerClientDisconnectHandler(_client_disconnect_callback_handler)) != RBUSCORE_SUCCESS)
+            RBUSLOG_WARN("%s(%s): rbus_registerClientDisconnectHandler error %d", __FUNCTION__, componentName, err);
+        else
+            sDisConnHandler = true;
+    }
 
     *handle = tmpHandle;
 
@@ -2679,8 +3163,6 @@ exit_error0:
     return ret;
 }
 
-static bool sDisConnHandler = false;
-
 rbusError_t rbus_openDirect(rbusHandle_t handle, rbusHandle_t* myDirectHandle, char const* pParameterName)
 {
     rtConnection myDirectCon = NULL;
@@ -2755,6 +3237,7 @@ rbusError_t rbus_close(rbusHandle_t handle)
     rbusCoreError_t err = RBUSCORE_SUCCESS;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
     char* componentName = NULL;
+    bool closedLast = false;
 
     VERIFY_NULL(handle);
 
@@ -2778,6 +3261,9 @@ rbusError_t rbus_close(rbusHandle_t handle)
         }
         rtVector_Destroy(handleInfo->eventSubs, NULL);
         handleInfo->eventSubs = NULL;
+        rtHashMap_Destroy(handleInfo->eventSubsIndex);
+        handleInfo->eventSubsIndex = NULL;
+        pthread_mutex_destroy(&handleInfo->eventSubsMutex);
     }
 
     if (handleInfo->messageCallbacks)
@@ -2787,6 +3273,8 @@ rbusError_t rbus_close(rbusHandle_t handle)
         handleInfo->messageCallbacks = NULL;
     }
 
+    rbusInterval_CloseHandle(handle);//called before the subscriptions it publishes are destroyed
+
     if(handleInfo->subscriptions != NULL)
     {
         rbusSubscriptions_destroy(handleInfo->subscriptions);
@@ -2809,6 +3297,9 @@ rbusError_t rbus_close(rbusHandle_t handle)
         ret = RBUS_ERROR_INVALID_HANDLE;
     }
 
+    rbusDiscoveryCache_Destroy(handleInfo->discoveryCache);
+    handleInfo->discoveryCache = NULL;
+
     componentName = handleInfo->componentName;
     handleInfo->componentName=NULL;
     rbusHandleList_Remove(handleInfo);
@@ -2823,6 +3314,7 @@ rbusError_t rbus_close(rbusHandle_t handle)
             RBUSLOG_ERROR("%s(%s): rbus_unregisterClientDisconnectHandler error %d", __FUNCTION__, componentName, err);
             ret = RBUS_ERROR_BUS_ERROR;
         }
+        sDisConnHandler = false;
 
         if((err = rbus_closeBrokerConnection()) != RBUSCORE_SUCCESS)
         {
@@ -2831,10 +3323,15 @@ rbusError_t rbus_close(rbusHandle_t handle)
         }
 
         _rbus_open_pre_initialize(false);
+        closedLast = true;
     }
 
     UnlockMutex();
 
+    /*outside gMutex as tasks still finishing may need it*/
+    if(closedLast)
+        rbusExecutor_Destroy();
+
     if(ret == RBUS_ERROR_SUCCESS)
         RBUSLOG_INFO("%s(%s) success", __FUNCTION__, componentName);
 
@@ -2866,52 +3363,66 @@ rbusError_t rbus_regDataElements(
         char* name = elements[i].name;
 
         if((!name) || (0 == strlen(name))) {
-            rc = RBUS_ERROR_INVALID_INPUT;
-            break ;
+            return RBUS_ERROR_INVALID_INPUT;
         }
-
         RBUSLOG_DEBUG("%s: %s", __FUNCTION__, name);
+    }
 
-        if(handleInfo->elementRoot == NULL)
-        {
-            RBUSLOG_DEBUG("First Time, create the root node for [%s]!", handleInfo->componentName);
-            handleInfo->elementRoot = getEmptyElementNode();
-            handleInfo->elementRoot->name = strdup(handleInfo->componentName);
-            RBUSLOG_DEBUG("Root node created for [%s]", handleInfo->elementRoot->name);
-        }
+    if(handleInfo->elementRoot == NULL)
+    {
+        RBUSLOG_DEBUG("First Time, create the root node for [%s]!", handleInfo->componentName);
+        handleInfo->elementRoot = getEmptyElementNode();
+        handleInfo->elementRoot->name = strdup(handleInfo->componentName);
+        RBUSLOG_DEBUG("Root node created for [%s]", handleInfo->elementRoot->name);
+    }
 
-        if(handleInfo->subscriptions == NULL)
-        {
-            rbusSubscriptions_create(&handleInfo->subscriptions, handle, handleInfo->componentName, handleInfo->elementRoot, rbusConfig_Get()->tmpDir);
-        }
+    if(handleInfo->subscriptions == NULL)
+    {
+        rbusSubscriptions_create(&handleInfo->subscriptions, handle, handleInfo->componentName, handleInfo->elementRoot, rbusConfig_Get()->tmpDir);
+    }
+
+    /*register every name with the broker in one round trip. the broker adds all of them or none,
+      so a provider never ends up with a half registered data model*/
+    {
+        char const** names = rt_malloc(numDataElements * sizeof(char const*));
+        int failed = -1;
+
+        for(i=0; i<numDataElements; ++i)
+            names[i] = elements[i].name;
+
+        err = rbus_addElements(handleInfo->componentName, names, numDataElements, &failed);
+        free(names);
 
-        if((err = rbus_addElement(handleInfo->componentName, name)) != RBUSCORE_SUCCESS)
+        if(err != RBUSCORE_SUCCESS)
         {
-            RBUSLOG_ERROR("%s: failed to add element with core [%s] err=%d!!", __FUNCTION__, name, err);
+            RBUSLOG_ERROR("%s: failed to add element with core [%s] err=%d!!", __FUNCTION__,
+                failed >= 0 ? elements[failed].name : handleInfo->componentName, err);
             if(err == RBUSCORE_ERROR_UNSUPPORTED_ENTRY)
             {
-                rc = RBUS_ERROR_INVALID_NAMESPACE;
+                return RBUS_ERROR_INVALID_NAMESPACE;
             }
             else
-	    {
-                rc = RBUS_ERROR_ELEMENT_NAME_DUPLICATE;
-	    }
-	    break;
+            {
+                return RBUS_ERROR_ELEMENT_NAME_DUPLICATE;
+            }
+        }
+    }
+
+    for(i=0; i<numDataElements; ++i)
+    {
+        char* name = elements[i].name;
+        elementNode* node;
+
+        if((node = insertElement(handleInfo->elementRoot, &elements[i])) == NULL)
+        {
+            RBUSLOG_ERROR("%s: failed to insert element [%s]!!", __FUNCTION__, name);
+            rc = RBUS_ERROR_OUT_OF_RESOURCES;
+            break;
         }
         else
         {
-            elementNode* node;
-            if((node = insertElement(handleInfo->elementRoot, &elements[i])) == NULL)
-            {
-                RBUSLOG_ERROR("%s: failed to insert element [%s]!!", __FUNCTION__, name);
-                rc = RBUS_ERROR_OUT_OF_RESOURCES;
-                break;
-            }
-            else
-            {
-                rbusSubscriptions_resubscribeElementCache(handle, handleInfo->subscriptions, name, node);
-                RBUSLOG_DEBUG("%s inserted successfully!", name);
-            }
+            rbusSubscriptions_resubscribeElementCache(handle, handleInfo->subscriptions, name, node);
+            RBUSLOG_DEBUG("%s inserted successfully!", name);
         }
     }
 
@@ -2919,12 +3430,10 @@ rbusError_t rbus_regDataElements(
       To avoid a provider having a half registered data model, and to avoid
       the complexity of returning a list of error codes for each element in the list,
       we treat rbus_regDataElements as a transaction.  If any element from the elements list
-      fails to register, we abort the whole thing.  We do this as follows: As soon 
-      as 1 fail occurs above, we break out of loop and we unregister all the 
-      successfully registered elements that happened during this call, before we failed.
-      Thus we unregisters elements 0 to i (i was when we broke from loop above).*/
-    if(rc != RBUS_ERROR_SUCCESS && i > 0)
-        rbus_unregDataElements(handle, i, elements);
+      fails to insert, we abort the whole thing by unregistering every element of this call,
+      all of which the broker already accepted above.*/
+    if(rc != RBUS_ERROR_SUCCESS)
+        rbus_unregDataElements(handle, numDataElements, elements);
 
     if((rc == RBUS_ERROR_SUCCESS) && (!sDisConnHandler))
     {
@@ -3005,6 +3514,38 @@ rbusError_t rbus_discoverComponentName (rbusHandle_t handle,
     return errorcode;
 }
 
+/*rbus_discoverComponentName through the handle's discovery cache; fromCache tells the caller
+  whether a delivery failure may be due to a stale entry and worth rediscovering*/
+static rbusError_t _rbus_discoverComponentNameCached(rbusHandle_t handle,
+                            int numElements, char const** elementNames,
+                            int *numComponents, char ***componentName, bool* fromCache)
+{
+    rbusError_t errorcode;
+
+    if(rbusDiscoveryCache_Lookup(handle->discoveryCache, numElements, elementNames, componentName))
+    {
+        *numComponents = numElements;
+        *fromCache = true;
+        return RBUS_ERROR_SUCCESS;
+    }
+
+    *fromCache = false;
+    errorcode = rbus_discoverComponentName(handle, numElements, elementNames, numComponents, componentName);
+    if(errorcode == RBUS_ERROR_SUCCESS && *numComponents == numElements)
+        rbusDiscoveryCache_Store(handle->discoveryCache, numElements, elementNames, *componentName);
+    return errorcode;
+}
+
+rbusError_t rbusHandle_GetDiscoveryCacheStats(rbusHandle_t handle, rbusDiscoveryCacheStats_t* stats)
+{
+    VERIFY_NULL(handle);
+    VERIFY_NULL(stats);
+
+    memset(stats, 0, sizeof(*stats));
+    rbusDiscoveryCache_GetStats(handle->discoveryCache, stats);
+    return RBUS_ERROR_SUCCESS;
+}
+
 rbusError_t rbus_discoverComponentDataElements (rbusHandle_t handle,
                             char const* name, bool nextLevel,
                             int *numElements, char*** elementNames)
@@ -3028,12 +3569,8 @@ rbusError_t rbus_discoverComponentDataElements (rbusHandle_t handle,
 }
 
 //************************* Parameters related Operations *******************//
-rbusError_t rbus_get(rbusHandle_t handle, char const* name, rbusValue_t* value)
+static rbusError_t _get_request(rbusHandle_t handle, char const* name, rbusMessage* request)
 {
-    rbusError_t errorcode = RBUS_ERROR_SUCCESS;
-    rbusCoreError_t err = RBUSCORE_SUCCESS;
-    rbusMessage request, response;
-    int ret = -1;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
 
     VERIFY_NULL(handleInfo);
@@ -3054,76 +3591,196 @@ rbusError_t rbus_get(rbusHandle_t handle, char const* name, rbusValue_t* value)
         return RBUS_ERROR_ACCESS_NOT_ALLOWED;
     }
 
-    rbusMessage_Init(&request);
+    rbusMessage_Init(request);
+    rbusMessage_SetCaps(*request, RBUS_MESSAGE_CAP_TLV);
     /* Set the Component name that invokes the set */
-    rbusMessage_SetString(request, handleInfo->componentName);
+    rbusMessage_SetString(*request, handleInfo->componentName);
     /* Param Size */
-    rbusMessage_SetInt32(request, (int32_t)1);
-    rbusMessage_SetString(request, name);
-
-    RBUSLOG_DEBUG("Calling rbus_invokeRemoteMethod2 for [%s]", name);
-
-    /* Find direct connection status */
-    rtConnection myConn = rbuscore_FindClientPrivateConnection(name);
-        
-    if (NULL == myConn)
-        myConn = handleInfo->m_connection;
-
-    err = rbus_invokeRemoteMethod2(myConn, name, METHOD_GETPARAMETERVALUES, request, rbusConfig_ReadGetTimeout(), &response);
+    rbusMessage_SetInt32(*request, (int32_t)1);
+    rbusMessage_SetString(*request, name);
+    return RBUS_ERROR_SUCCESS;
+}
 
-    if(err != RBUSCORE_SUCCESS)
-    {
-        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, name);
-        errorcode = rbusCoreError_to_rbusError(err);
-    }
-    else
-    {
-        int valSize;
-        rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+static rbusError_t _get_response_parser(char const* name, rbusMessage response, rbusValue_t* value)
+{
+    rbusError_t errorcode = RBUS_ERROR_SUCCESS;
+    int valSize;
+    int ret = -1;
+    rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+    struct _rbusBuffer block;
 
-        RBUSLOG_DEBUG("Received response for remote method invocation!");
+    RBUSLOG_DEBUG("Received response for remote method invocation!");
 
-        rbusMessage_GetInt32(response, &ret);
+    rbusMessage_GetInt32(response, &ret);
 
-        RBUSLOG_DEBUG("Response from the remote method is [%d]!",ret);
-        errorcode = (rbusError_t) ret;
-        legacyRetCode = (rbusLegacyReturn_t) ret;
+    RBUSLOG_DEBUG("Response from the remote method is [%d]!",ret);
+    errorcode = (rbusError_t) ret;
+    legacyRetCode = (rbusLegacyReturn_t) ret;
 
-        if((errorcode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    if((errorcode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    {
+        errorcode = RBUS_ERROR_SUCCESS;
+        RBUSLOG_DEBUG("Received valid response!");
+        rbusMessage_GetInt32(response, &valSize);
+        if(rbusTlvBlock_Get(response, &block))
         {
-            errorcode = RBUS_ERROR_SUCCESS;
-            RBUSLOG_DEBUG("Received valid response!");
-            rbusMessage_GetInt32(response, &valSize);
-            if(1/*valSize*/)
+            rbusProperty_t prop;
+            if(rbusProperty_Decode(&prop, &block) < 0)
             {
-                char const *buff = NULL;
-
-                //Param Name
-                rbusMessage_GetString(response, &buff);
-                if(buff && (strcmp(name, buff) == 0))
+                RBUSLOG_WARN("Failed to decode response for %s", name);
+                errorcode = RBUS_ERROR_INVALID_RESPONSE_FROM_DESTINATION;
+            }
+            else
+            {
+                if(strcmp(name, rbusProperty_GetName(prop)) == 0)
                 {
-                    rbusValue_initFromMessage(value, response);
+                    *value = rbusProperty_GetValue(prop);
+                    rbusValue_Retain(*value);
                 }
                 else
                 {
                     RBUSLOG_WARN("Param mismatch!");
-                    RBUSLOG_WARN("Requested param: [%s], Received Param: [%s]", name, buff);
+                    RBUSLOG_WARN("Requested param: [%s], Received Param: [%s]", name, rbusProperty_GetName(prop));
                     errorcode = RBUS_ERROR_INVALID_RESPONSE_FROM_DESTINATION;
                 }
+                rbusProperty_Release(prop);
             }
         }
         else
         {
-            if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
+            char const *buff = NULL;
+
+            //Param Name
+            rbusMessage_GetString(response, &buff);
+            if(buff && (strcmp(name, buff) == 0))
             {
-                errorcode = CCSPError_to_rbusError(legacyRetCode);
+                rbusValue_initFromMessage(value, response);
+            }
+            else
+            {
+                RBUSLOG_WARN("Param mismatch!");
+                RBUSLOG_WARN("Requested param: [%s], Received Param: [%s]", name, buff);
+                errorcode = RBUS_ERROR_INVALID_RESPONSE_FROM_DESTINATION;
             }
         }
+    }
+    else
+    {
+        if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
+        {
+            errorcode = CCSPError_to_rbusError(legacyRetCode);
+        }
+    }
+    return errorcode;
+}
+
+rbusError_t rbus_get(rbusHandle_t handle, char const* name, rbusValue_t* value)
+{
+    rbusError_t errorcode = RBUS_ERROR_SUCCESS;
+    rbusCoreError_t err = RBUSCORE_SUCCESS;
+    rbusMessage request, response;
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
+
+    if ((errorcode = _get_request(handle, name, &request)) != RBUS_ERROR_SUCCESS)
+        return errorcode;
+
+    RBUSLOG_DEBUG("Calling rbus_invokeRemoteMethod2 for [%s]", name);
+
+    /* Find direct connection status */
+    rtConnection myConn = rbuscore_FindClientPrivateConnection(name);
+        
+    if (NULL == myConn)
+        myConn = handleInfo->m_connection;
+
+    err = rbus_invokeRemoteMethod2(myConn, name, METHOD_GETPARAMETERVALUES, request, rbusConfig_ReadGetTimeout(), &response);
+
+    if(err != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, name);
+        errorcode = rbusCoreError_to_rbusError(err);
+    }
+    else
+    {
+        errorcode = _get_response_parser(name, response, value);
         rbusMessage_Release(response);
     }
     return errorcode;
 }
 
+typedef struct _rbusAsyncRequest
+{
+    rbusHandle_t handle;
+    rbusGetAsyncRespHandler_t getHandler;
+    rbusSetAsyncRespHandler_t setHandler;
+    void* userData;
+    char name[];
+} rbusAsyncRequest_t;
+
+static rbusAsyncRequest_t* _async_request_create(rbusHandle_t handle, char const* name, void* userData)
+{
+    rbusAsyncRequest_t* req = rt_malloc(sizeof(rbusAsyncRequest_t) + strlen(name) + 1);
+    req->handle = handle;
+    req->getHandler = NULL;
+    req->setHandler = NULL;
+    req->userData = userData;
+    strcpy(req->name, name);
+    return req;
+}
+
+/* runs on the connection's reader thread, or its timeout thread if no response came */
+static void _get_async_callback(rbusCoreError_t err, rbusMessage response, void* userData)
+{
+    rbusAsyncRequest_t* req = (rbusAsyncRequest_t*)userData;
+    rbusValue_t value = NULL;
+    rbusError_t errorcode;
+
+    if(err != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("rbus_getAsync failed; Received error %d from RBUS Daemon for the object %s", err, req->name);
+        errorcode = rbusCoreError_to_rbusError(err);
+    }
+    else
+    {
+        errorcode = _get_response_parser(req->name, response, &value);
+    }
+
+    req->getHandler(req->handle, req->name, errorcode, errorcode == RBUS_ERROR_SUCCESS ? value : NULL, req->userData);
+    if(value)
+        rbusValue_Release(value);
+    free(req);
+}
+
+rbusError_t rbus_getAsync(rbusHandle_t handle, char const* name, rbusGetAsyncRespHandler_t callback, void* userData)
+{
+    rbusError_t errorcode = RBUS_ERROR_SUCCESS;
+    rbusCoreError_t err = RBUSCORE_SUCCESS;
+    rbusMessage request;
+    rbusAsyncRequest_t* req;
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
+
+    VERIFY_NULL(name);
+    VERIFY_NULL(callback);
+
+    if ((errorcode = _get_request(handle, name, &request)) != RBUS_ERROR_SUCCESS)
+        return errorcode;
+
+    rtConnection myConn = rbuscore_FindClientPrivateConnection(name);
+    if (NULL == myConn)
+        myConn = handleInfo->m_connection;
+
+    req = _async_request_create(handle, name, userData);
+    req->getHandler = callback;
+
+    err = rbus_invokeRemoteMethodAsync2(myConn, name, METHOD_GETPARAMETERVALUES, request, rbusConfig_ReadGetTimeout(), _get_async_callback, req);
+    if(err != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, name);
+        free(req);
+        return rbusCoreError_to_rbusError(err);
+    }
+    return RBUS_ERROR_SUCCESS;
+}
+
 rbusError_t _getExt_response_parser(rbusMessage response, int *numValues, rbusProperty_t* retProperties)
 {
     rbusError_t errorcode = RBUS_ERROR_SUCCESS;
@@ -3131,6 +3788,7 @@ rbusError_t _getExt_response_parser(rbusMessage response, int *numValues, rbusPr
     int numOfVals = 0;
     int ret = -1;
     int i = 0;
+    struct _rbusBuffer block;
     RBUSLOG_DEBUG("Received response for remote method invocation!");
 
     rbusMessage_GetInt32(response, &ret);
@@ -3148,7 +3806,38 @@ rbusError_t _getExt_response_parser(rbusMessage response, int *numValues, rbusPr
         *numValues = numOfVals;
         RBUSLOG_DEBUG("Number of return params = %d", numOfVals);
 
-        if(numOfVals)
+        if(numOfVals && rbusTlvBlock_Get(response, &block))
+        {
+            rbusProperty_t last = NULL;
+            for(i = 0; i < numOfVals; i++)
+            {
+                rbusProperty_t tmpProperties;
+                if(rbusProperty_Decode(&tmpProperties, &block) < 0)
+                {
+                    RBUSLOG_WARN("Failed to decode property %d of %d", i, numOfVals);
+                    if(last)
+                    {
+                        rbusProperty_Release(*retProperties);
+                        *retProperties = NULL;
+                    }
+                    *numValues = 0;
+                    errorcode = RBUS_ERROR_INVALID_RESPONSE_FROM_DESTINATION;
+                    break;
+                }
+                /* For the first instance, lets use the given pointer */
+                if (0 == i)
+                {
+                    *retProperties = tmpProperties;
+                }
+                else
+                {
+                    rbusProperty_SetNext(last, tmpProperties);
+                    rbusProperty_Release(tmpProperties);
+                }
+                last = tmpProperties;
+            }
+        }
+        else if(numOfVals)
         {
             rbusProperty_t last;
             for(i = 0; i < numOfVals; i++)
@@ -3216,76 +3905,73 @@ rbusError_t rbus_getExt(rbusHandle_t handle, int paramCount, char const** pParam
             }
             else
             {
+                rbusMessage* requests = rt_malloc(numDestinations * sizeof(rbusMessage));
+                rbusMessage* responses = rt_malloc(numDestinations * sizeof(rbusMessage));
+                rbusCoreError_t* errors = rt_malloc(numDestinations * sizeof(rbusCoreError_t));
+
                 for(i = 0; i < numDestinations; i++)
                 {
-                    int tmpNumOfValues = 0;
-                    rbusMessage request, response;
                     RBUSLOG_DEBUG("Destination %d is %s", i, destinations[i]);
 
                     /* Get the query sent to each component identified */
-                    rbusMessage_Init(&request);
+                    rbusMessage_Init(&requests[i]);
+                    rbusMessage_SetCaps(requests[i], RBUS_MESSAGE_CAP_TLV);
                     /* Set the Component name that invokes the set */
-                    rbusMessage_SetString(request, handleInfo->componentName);
-                    rbusMessage_SetInt32(request, 1);
-                    rbusMessage_SetString(request, pParamNames[0]);
-                    /* Invoke the method */
-                    err = rbus_invokeRemoteMethod(destinations[i], METHOD_GETPARAMETERVALUES, request, rbusConfig_ReadGetTimeout(), &response);
+                    rbusMessage_SetString(requests[i], handleInfo->componentName);
+                    rbusMessage_SetInt32(requests[i], 1);
+                    rbusMessage_SetString(requests[i], pParamNames[0]);
+                }
 
-                    if(err != RBUSCORE_SUCCESS)
-                    {
-                        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, destinations[i]);
-                        errorcode = rbusCoreError_to_rbusError(err);
-                    }
-                    else
+                /* Send to every component before waiting on any, so the whole query takes as long
+                   as the slowest component rather than the sum of them, within one get timeout */
+                err = rbus_invokeRemoteMethods(numDestinations, (const char**)destinations, METHOD_GETPARAMETERVALUES, requests, rbusConfig_ReadGetTimeout(), responses, errors);
+                if(err != RBUSCORE_SUCCESS)
+                {
+                    RBUSLOG_ERROR("%s by %s failed; error %d sending to %d components", __FUNCTION__, handle->componentName, err, numDestinations);
+                    errorcode = rbusCoreError_to_rbusError(err);
+                }
+                else
+                {
+                    /* Keep what the responding components returned; report the first failure */
+                    for(i = 0; i < numDestinations; i++)
                     {
-                        if (0 == i)
+                        int tmpNumOfValues = 0;
+                        rbusProperty_t tmpProperties = NULL;
+                        rbusError_t rc;
+
+                        if(errors[i] != RBUSCORE_SUCCESS)
                         {
-                            if((errorcode = _getExt_response_parser(response, &tmpNumOfValues, retProperties)) != RBUS_ERROR_SUCCESS)
-                            {
-                                RBUSLOG_ERROR("%s error parsing response %d", __FUNCTION__, errorcode);
-                            }
-                            else
-                            {
-                                if(tmpNumOfValues > 0)
-                                    last = *retProperties;
-                            }
+                            RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, errors[i], destinations[i]);
+                            rc = rbusCoreError_to_rbusError(errors[i]);
                         }
-                        else
+                        else if((rc = _getExt_response_parser(responses[i], &tmpNumOfValues, &tmpProperties)) != RBUS_ERROR_SUCCESS)
                         {
-                            rbusProperty_t tmpProperties;
-
-                            if((errorcode = _getExt_response_parser(response, &tmpNumOfValues, &tmpProperties)) != RBUS_ERROR_SUCCESS)
+                            RBUSLOG_ERROR("%s error parsing response %d", __FUNCTION__, rc);
+                        }
+                        else if(tmpNumOfValues > 0 && tmpProperties)
+                        {
+                            if(NULL != last)
                             {
-                                RBUSLOG_ERROR("%s error parsing response %d", __FUNCTION__, errorcode);
+                                rbusProperty_Append(last, tmpProperties);
+                                rbusProperty_Release(tmpProperties);
                             }
                             else
-                            {
-                                if(tmpNumOfValues > 0 && tmpProperties)
-                                {
-                                    if(NULL != last)
-                                    {
-                                        rbusProperty_Append(last, tmpProperties);
-                                    }
-                                    else
-                                    {
-                                        last = tmpProperties;
-                                        *retProperties = last;
-                                    }
-                                }
-                            }
+                                *retProperties = last = tmpProperties;
+                            *numValues += tmpNumOfValues;
+                        }
+
+                        if(rc != RBUS_ERROR_SUCCESS)
+                        {
+                            RBUSLOG_WARN("Failed to get the data from %s Component", destinations[i]);
+                            if(errorcode == RBUS_ERROR_SUCCESS)
+                                errorcode = rc;
                         }
-                    }
-                    if (errorcode != RBUS_ERROR_SUCCESS)
-                    {
-                        RBUSLOG_WARN("Failed to get the data from %s Component", destinations[i]);
-                        break;
-                    }
-                    else
-                    {
-                        *numValues += tmpNumOfValues;
                     }
                 }
 
+                free(requests);
+                free(responses);
+                free(errors);
                 for(i = 0; i < numDestinations; i++)
                     free(destinations[i]);
                 free(destinations);
@@ -3304,9 +3990,12 @@ rbusError_t rbus_getExt(rbusHandle_t handle, int paramCount, char const** pParam
         rbusMessage request, response;
         int numComponents;
         char** componentNames = NULL;
+        bool fromCache = false;
+        bool rediscovered = false;
 
+rediscover:
         /*discover which components have some ownership of the params in the list*/
-        errorcode = rbus_discoverComponentName(handle, paramCount, pParamNames, &numComponents, &componentNames);
+        errorcode = _rbus_discoverComponentNameCached(handle, paramCount, pParamNames, &numComponents, &componentNames, &fromCache);
         if(errorcode == RBUS_ERROR_SUCCESS && paramCount == numComponents)
         {
 #if 0
@@ -3362,6 +4051,7 @@ rbusError_t rbus_getExt(rbusHandle_t handle, int paramCount, char const** pParam
                 if(componentName)
                 {
                     rbusMessage_Init(&request);
+                    rbusMessage_SetCaps(request, RBUS_MESSAGE_CAP_TLV);
                     rbusMessage_SetString(request, componentName);
                     rbusMessage_SetInt32(request, batchCount);
 
@@ -3418,6 +4108,31 @@ rbusError_t rbus_getExt(rbusHandle_t handle, int paramCount, char const** pParam
                     break;
                 }
             }
+
+            /*a batch failing part way leaves the names of the unsent ones*/
+            for(i = 0; i < paramCount; ++i)
+            {
+                free(componentNames[i]);
+                componentNames[i] = NULL;
+            }
+
+            /*the cached resolution may point at a component that went away: ask rtrouted again once*/
+            if(err == RBUSCORE_ERROR_DESTINATION_UNREACHABLE && fromCache && !rediscovered)
+            {
+                RBUSLOG_INFO("%s: cached destination unreachable; rediscovering", __FUNCTION__);
+                rbusDiscoveryCache_Clear(handleInfo->discoveryCache);
+                if(*retProperties)
+                {
+                    rbusProperty_Release(*retProperties);
+                    *retProperties = NULL;
+                }
+                *numValues = 0;
+                free(componentNames);
+                componentNames = NULL;
+                err = RBUSCORE_SUCCESS;
+                rediscovered = true;
+                goto rediscover;
+            }
         }
         else
         {
@@ -3495,11 +4210,8 @@ rbusError_t rbus_getStr (rbusHandle_t handle, char const* paramName, char** para
     return rbus_getByType(handle, paramName, paramVal, RBUS_STRING);
 }
 
-rbusError_t rbus_set(rbusHandle_t handle, char const* name,rbusValue_t value, rbusSetOptions_t* opts)
+static rbusError_t _set_request(rbusHandle_t handle, char const* name, rbusValue_t value, rbusSetOptions_t* opts, rbusMessage* setRequest)
 {
-    rbusError_t errorcode = RBUS_ERROR_INVALID_INPUT;
-    rbusCoreError_t err = RBUSCORE_SUCCESS;
-    rbusMessage setRequest, setResponse;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
 
     VERIFY_NULL(handle);
@@ -3511,25 +4223,67 @@ rbusError_t rbus_set(rbusHandle_t handle, char const* name,rbusValue_t value, rb
 
     if (RBUS_NONE == rbusValue_GetType(value))
     {
-        return errorcode;
+        return RBUS_ERROR_INVALID_INPUT;
     }
-    rbusMessage_Init(&setRequest);
+    rbusMessage_Init(setRequest);
     /* Set the Session ID first */
     if ((opts) && (opts->sessionId != 0))
-        rbusMessage_SetInt32(setRequest, opts->sessionId);
+        rbusMessage_SetInt32(*setRequest, opts->sessionId);
     else
-        rbusMessage_SetInt32(setRequest, 0);
+        rbusMessage_SetInt32(*setRequest, 0);
 
     /* Set the Component name that invokes the set */
-    rbusMessage_SetString(setRequest, handleInfo->componentName);
+    rbusMessage_SetString(*setRequest, handleInfo->componentName);
     /* Set the Size of params */
-    rbusMessage_SetInt32(setRequest, 1);
+    rbusMessage_SetInt32(*setRequest, 1);
 
     /* Set the params in details */
-    rbusValue_appendToMessage(name, value, setRequest);
+    rbusValue_appendToMessage(name, value, *setRequest);
 
     /* Set the Commit value; FIXME: Should we use string? */
-    rbusMessage_SetString(setRequest, (!opts || opts->commit) ? "TRUE" : "FALSE");
+    rbusMessage_SetString(*setRequest, (!opts || opts->commit) ? "TRUE" : "FALSE");
+    return RBUS_ERROR_SUCCESS;
+}
+
+static rbusError_t _set_response_parser(rbusMessage setResponse)
+{
+    rbusError_t errorcode;
+    rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+    int ret = -1;
+    char const* pErrorReason = NULL;
+    rbusMessage_GetInt32(setResponse, &ret);
+
+    RBUSLOG_DEBUG("Response from the remote method is [%d]!", ret);
+    errorcode = (rbusError_t) ret;
+    legacyRetCode = (rbusLegacyReturn_t) ret;
+
+    if((errorcode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    {
+        errorcode = RBUS_ERROR_SUCCESS;
+        RBUSLOG_DEBUG("Successfully Set the Value");
+    }
+    else
+    {
+        rbusMessage_GetString(setResponse, &pErrorReason);
+        RBUSLOG_WARN("Failed to Set the Value for %s", pErrorReason);
+        if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
+        {
+            errorcode = CCSPError_to_rbusError(legacyRetCode);
+        }
+    }
+    return errorcode;
+}
+
+rbusError_t rbus_set(rbusHandle_t handle, char const* name,rbusValue_t value, rbusSetOptions_t* opts)
+{
+    rbusError_t errorcode = RBUS_ERROR_INVALID_INPUT;
+    rbusCoreError_t err = RBUSCORE_SUCCESS;
+    rbusMessage setRequest, setResponse;
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
+
+    if ((errorcode = _set_request(handle, name, value, opts, &setRequest)) != RBUS_ERROR_SUCCESS)
+        return errorcode;
+
     /* Find direct connection status */
     rtConnection myConn = rbuscore_FindClientPrivateConnection(name);
         
@@ -3543,29 +4297,7 @@ rbusError_t rbus_set(rbusHandle_t handle, char const* name,rbusValue_t value, rb
     }
     else
     {
-        rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
-        int ret = -1;
-        char const* pErrorReason = NULL;
-        rbusMessage_GetInt32(setResponse, &ret);
-
-        RBUSLOG_DEBUG("Response from the remote method is [%d]!", ret);
-        errorcode = (rbusError_t) ret;
-        legacyRetCode = (rbusLegacyReturn_t) ret;
-
-        if((errorcode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
-        {
-            errorcode = RBUS_ERROR_SUCCESS;
-            RBUSLOG_DEBUG("Successfully Set the Value");
-        }
-        else
-        {
-            rbusMessage_GetString(setResponse, &pErrorReason);
-            RBUSLOG_WARN("Failed to Set the Value for %s", pErrorReason);
-            if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
-            {
-                errorcode = CCSPError_to_rbusError(legacyRetCode);
-            }
-        }
+        errorcode = _set_response_parser(setResponse);
 
         /* Release the reponse message */
         rbusMessage_Release(setResponse);
@@ -3573,6 +4305,56 @@ rbusError_t rbus_set(rbusHandle_t handle, char const* name,rbusValue_t value, rb
     return errorcode;
 }
 
+static void _set_async_callback(rbusCoreError_t err, rbusMessage response, void* userData)
+{
+    rbusAsyncRequest_t* req = (rbusAsyncRequest_t*)userData;
+    rbusError_t errorcode;
+
+    if(err != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("rbus_setAsync failed; Received error %d from RBUS Daemon for the object %s", err, req->name);
+        errorcode = rbusCoreError_to_rbusError(err);
+    }
+    else
+    {
+        errorcode = _set_response_parser(response);
+    }
+
+    req->setHandler(req->handle, req->name, errorcode, req->userData);
+    free(req);
+}
+
+rbusError_t rbus_setAsync(rbusHandle_t handle, char const* name, rbusValue_t value, rbusSetOptions_t* opts,
+    rbusSetAsyncRespHandler_t callback, void* userData)
+{
+    rbusError_t errorcode = RBUS_ERROR_SUCCESS;
+    rbusCoreError_t err = RBUSCORE_SUCCESS;
+    rbusMessage setRequest;
+    rbusAsyncRequest_t* req;
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
+
+    VERIFY_NULL(callback);
+
+    if ((errorcode = _set_request(handle, name, value, opts, &setRequest)) != RBUS_ERROR_SUCCESS)
+        return errorcode;
+
+    rtConnection myConn = rbuscore_FindClientPrivateConnection(name);
+    if (NULL == myConn)
+        myConn = handleInfo->m_connection;
+
+    req = _async_request_create(handle, name, userData);
+    req->setHandler = callback;
+
+    err = rbus_invokeRemoteMethodAsync2(myConn, name, METHOD_SETPARAMETERVALUES, setRequest, rbusConfig_ReadSetTimeout(), _set_async_callback, req);
+    if(err != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, name);
+        free(req);
+        return rbusCoreError_to_rbusError(err);
+    }
+    return RBUS_ERROR_SUCCESS;
+}
+
 rbusError_t rbus_setMulti(rbusHandle_t handle, int numProps, rbusProperty_t properties, rbusSetOptions_t* opts)
 {
     rbusError_t errorcode = RBUS_ERROR_INVALID_INPUT;
@@ -3622,8 +4404,13 @@ rbusError_t rbus_setMulti(rbusHandle_t handle, int numProps, rbusProperty_t prop
             return RBUS_ERROR_INVALID_INPUT;
         }
 
+        bool fromCache = false;
+        bool rediscovered = false;
+        bool firstBatch = true;
+
+rediscover:
         /*discover which components have some ownership of the params*/
-        errorcode = rbus_discoverComponentName(handle, numProps, pParamNames, &numComponents, &componentNames);
+        errorcode = _rbus_discoverComponentNameCached(handle, numProps, pParamNames, &numComponents, &componentNames, &fromCache);
         if(errorcode == RBUS_ERROR_SUCCESS && numProps == numComponents)
         {
 #if 0
@@ -3713,6 +4500,23 @@ rbusError_t rbus_setMulti(rbusHandle_t handle, int numProps, rbusProperty_t prop
                     {
                         RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, firstParamName);
                         errorcode = rbusCoreError_to_rbusError(err);
+
+                        /*nothing has been set yet, so a stale cached resolution can safely be rediscovered once*/
+                        if(err == RBUSCORE_ERROR_DESTINATION_UNREACHABLE && fromCache && !rediscovered && firstBatch)
+                        {
+                            RBUSLOG_INFO("%s: cached destination unreachable; rediscovering", __FUNCTION__);
+                            free(componentName);
+                            for(i = 0; i < numProps; ++i)
+                            {
+                                free(componentNames[i]);
+                                componentNames[i] = NULL;
+                            }
+                            free(componentNames);
+                            componentNames = NULL;
+                            rbusDiscoveryCache_Clear(handleInfo->discoveryCache);
+                            rediscovered = true;
+                            goto rediscover;
+                        }
                     }
                     else
                     {
@@ -3743,6 +4547,7 @@ rbusError_t rbus_setMulti(rbusHandle_t handle, int numProps, rbusProperty_t prop
                         /* Release the reponse message */
                         rbusMessage_Release(setResponse);
                     }
+                    firstBatch = false;
                     free(componentName);
                 }
                 else
@@ -3801,47 +4606,235 @@ static rbusError_t rbus_setByType(rbusHandle_t handle, char const* paramName, vo
             break;
     }
 
-    errorcode = rbus_set(handle, paramName, value, NULL);
-
-    rbusValue_Release(value);
-
-    return errorcode;
+    errorcode = rbus_set(handle, paramName, value, NULL);
+
+    rbusValue_Release(value);
+
+    return errorcode;
+}
+
+rbusError_t rbus_setBoolean(rbusHandle_t handle, char const* paramName, bool paramVal)
+{
+    return rbus_setByType(handle, paramName, &paramVal, RBUS_BOOLEAN);
+}
+
+rbusError_t rbus_setInt(rbusHandle_t handle, char const* paramName, int paramVal)
+{
+    return rbus_setByType(handle, paramName, &paramVal, RBUS_INT32);
+}
+
+rbusError_t rbus_setUInt(rbusHandle_t handle, char const* paramName, unsigned int paramVal)
+{
+    return rbus_setByType(handle, paramName, &paramVal, RBUS_UINT32);
+}
+
+rbusError_t rbus_setStr(rbusHandle_t handle, char const* paramName, char const* paramVal)
+{
+    VERIFY_NULL(paramVal);
+    return rbus_setByType(handle, paramName, paramVal, RBUS_STRING);
+}
+
+rbusError_t rbusTable_addRow(
+    rbusHandle_t handle,
+    char const* tableName,
+    char const* aliasName,
+    uint32_t* instNum)
+{
+    rbusCoreError_t err;
+    int returnCode = 0;
+    int32_t instanceId = 0;
+    const char dot = '.';
+    rbusMessage request, response;
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
+    rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+
+    VERIFY_NULL(handle);
+    VERIFY_NULL(tableName);
+
+    if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
+        return RBUS_ERROR_INVALID_HANDLE;
+
+    RBUSLOG_DEBUG("%s: %s %s", __FUNCTION__, tableName, aliasName);
+
+    if(tableName[strlen(tableName)-1] != dot)
+    {
+        RBUSLOG_WARN("%s invalid table name %s", __FUNCTION__, tableName);
+        return RBUS_ERROR_INVALID_INPUT;
+    }
+
+    rbusMessage_Init(&request);
+    rbusMessage_SetInt32(request, 0);/*TODO: this should be the session ID*/
+    rbusMessage_SetString(request, tableName);/*TODO: do we need to append the name as well as pass the name as the 1st arg to rbus_invokeRemoteMethod2 ?*/
+    if(aliasName)
+        rbusMessage_SetString(request, aliasName);
+    else
+        rbusMessage_SetString(request, "");
+
+    /* Find direct connection status */
+    rtConnection myConn = rbuscore_FindClientPrivateConnection(tableName);
+
+    if (NULL == myConn)
+        myConn = handleInfo->m_connection;
+
+    if((err = rbus_invokeRemoteMethod2(myConn,
+        tableName, /*as taken from ccsp_base_api.c, this was the destination component ID, but to locate the route, the table name can be used
+                     because the broker simlpy looks at the top level nodes that are owned by a component route.  maybe this breaks if the broker changes*/
+        METHOD_ADDTBLROW, 
+        request, 
+        rbusConfig_ReadSetTimeout(),
+        &response)) != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, tableName);
+        return rbusCoreError_to_rbusError(err);
+    }
+    else
+    {
+        rbusMessage_GetInt32(response, &returnCode);
+        rbusMessage_GetInt32(response, &instanceId);
+        legacyRetCode = (rbusLegacyReturn_t)returnCode;
+
+        if(instNum)
+            *instNum = (uint32_t)instanceId;/*FIXME we need an rbus_PopUInt32 to avoid loosing a bit */
+
+        RBUSLOG_INFO("%s rbus_invokeRemoteMethod2 success response returnCode:%d instanceId:%d", __FUNCTION__, returnCode, instanceId);
+        if((returnCode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+        {
+            returnCode = RBUS_ERROR_SUCCESS;
+            RBUSLOG_DEBUG("Successfully Set the Value");
+        }
+        else
+        {
+            RBUSLOG_WARN("Response from remote method indicates the call failed!!");
+            if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
+            {
+                returnCode = CCSPError_to_rbusError(legacyRetCode);
+            }
+        }
+        rbusMessage_Release(response);
+    }
+
+    return returnCode;
+}
+
+rbusError_t rbusTable_removeRow(
+    rbusHandle_t handle,
+    char const* rowName)
+{
+    rbusCoreError_t err;
+    int returnCode = 0;
+    rbusMessage request, response;
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
+    rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+
+    VERIFY_NULL(handle);
+    VERIFY_NULL(rowName);
+
+    if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
+        return RBUS_ERROR_INVALID_HANDLE;
+
+    RBUSLOG_DEBUG("%s: %s", __FUNCTION__, rowName);
+
+    rbusMessage_Init(&request);
+    rbusMessage_SetInt32(request, 0);/*TODO: this should be the session ID*/
+    rbusMessage_SetString(request, rowName);/*TODO: do we need to append the name as well as pass the name as the 1st arg to rbus_invokeRemoteMethod2 ?*/
+    /* Find direct connection status */
+    rtConnection myConn = rbuscore_FindClientPrivateConnection(rowName);
+        
+    if (NULL == myConn)
+        myConn = handleInfo->m_connection;
+
+    if((err = rbus_invokeRemoteMethod2(myConn,
+        rowName,
+        METHOD_DELETETBLROW, 
+        request, 
+        rbusConfig_ReadSetTimeout(),
+        &response)) != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, rowName);
+        return rbusCoreError_to_rbusError(err);
+    }
+    else
+    {
+        rbusMessage_GetInt32(response, &returnCode);
+        legacyRetCode = (rbusLegacyReturn_t)returnCode;
+
+        RBUSLOG_INFO("%s rbus_invokeRemoteMethod2 success response returnCode:%d", __FUNCTION__, returnCode);
+        if((returnCode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+        {
+            returnCode = RBUS_ERROR_SUCCESS;
+            RBUSLOG_DEBUG("Successfully Set the Value");
+        }
+        else
+        {
+            RBUSLOG_WARN("Response from remote method indicates the call failed!!");
+            if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
+            {
+                returnCode = CCSPError_to_rbusError(legacyRetCode);
+            }
+        }
+        rbusMessage_Release(response);
+    }
+
+    return returnCode;
 }
 
-rbusError_t rbus_setBoolean(rbusHandle_t handle, char const* paramName, bool paramVal)
+/*  add the rows one METHOD_ADDTBLROW at a time, for providers that predate METHOD_ADDTBLROWS.
+ *  rows already added are removed again if one fails, to keep rbusTable_addRows all or nothing
+ */
+static rbusError_t rbusTable_addRowsSerially(
+    rbusHandle_t handle,
+    char const* tableName,
+    int numRows,
+    char const** aliasNames,
+    uint32_t* instNums)
 {
-    return rbus_setByType(handle, paramName, &paramVal, RBUS_BOOLEAN);
-}
+    rbusError_t rc = RBUS_ERROR_SUCCESS;
+    uint32_t* added;
+    int i, j;
 
-rbusError_t rbus_setInt(rbusHandle_t handle, char const* paramName, int paramVal)
-{
-    return rbus_setByType(handle, paramName, &paramVal, RBUS_INT32);
-}
+    added = rt_malloc(sizeof(uint32_t) * numRows);
 
-rbusError_t rbus_setUInt(rbusHandle_t handle, char const* paramName, unsigned int paramVal)
-{
-    return rbus_setByType(handle, paramName, &paramVal, RBUS_UINT32);
-}
+    for(i = 0; i < numRows; ++i)
+    {
+        rc = rbusTable_addRow(handle, tableName, aliasNames ? aliasNames[i] : NULL, &added[i]);
+        if(rc != RBUS_ERROR_SUCCESS)
+            break;
+    }
 
-rbusError_t rbus_setStr(rbusHandle_t handle, char const* paramName, char const* paramVal)
-{
-    VERIFY_NULL(paramVal);
-    return rbus_setByType(handle, paramName, paramVal, RBUS_STRING);
+    if(rc != RBUS_ERROR_SUCCESS)
+    {
+        for(j = 0; j < i; ++j)
+        {
+            char rowName[RBUS_MAX_NAME_LENGTH];
+            snprintf(rowName, RBUS_MAX_NAME_LENGTH, "%s%u", tableName, added[j]);
+            if(rbusTable_removeRow(handle, rowName) != RBUS_ERROR_SUCCESS)
+                RBUSLOG_WARN("%s failed to roll back row %s", __FUNCTION__, rowName);
+        }
+    }
+    else if(instNums)
+    {
+        memcpy(instNums, added, sizeof(uint32_t) * numRows);
+    }
+
+    free(added);
+    return rc;
 }
 
-rbusError_t rbusTable_addRow(
+rbusError_t rbusTable_addRows(
     rbusHandle_t handle,
     char const* tableName,
-    char const* aliasName,
-    uint32_t* instNum)
+    int numRows,
+    char const** aliasNames,
+    uint32_t* instNums)
 {
     rbusCoreError_t err;
     int returnCode = 0;
-    int32_t instanceId = 0;
+    int32_t numAdded = 0;
     const char dot = '.';
     rbusMessage request, response;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
     rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+    int i;
 
     VERIFY_NULL(handle);
     VERIFY_NULL(tableName);
@@ -3849,7 +4842,10 @@ rbusError_t rbusTable_addRow(
     if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
         return RBUS_ERROR_INVALID_HANDLE;
 
-    RBUSLOG_DEBUG("%s: %s %s", __FUNCTION__, tableName, aliasName);
+    if(numRows <= 0)
+        return RBUS_ERROR_INVALID_INPUT;
+
+    RBUSLOG_DEBUG("%s: %s %d rows", __FUNCTION__, tableName, numRows);
 
     if(tableName[strlen(tableName)-1] != dot)
     {
@@ -3859,11 +4855,10 @@ rbusError_t rbusTable_addRow(
 
     rbusMessage_Init(&request);
     rbusMessage_SetInt32(request, 0);/*TODO: this should be the session ID*/
-    rbusMessage_SetString(request, tableName);/*TODO: do we need to append the name as well as pass the name as the 1st arg to rbus_invokeRemoteMethod2 ?*/
-    if(aliasName)
-        rbusMessage_SetString(request, aliasName);
-    else
-        rbusMessage_SetString(request, "");
+    rbusMessage_SetString(request, tableName);
+    rbusMessage_SetInt32(request, numRows);
+    for(i = 0; i < numRows; ++i)
+        rbusMessage_SetString(request, (aliasNames && aliasNames[i]) ? aliasNames[i] : "");
 
     /* Find direct connection status */
     rtConnection myConn = rbuscore_FindClientPrivateConnection(tableName);
@@ -3872,9 +4867,8 @@ rbusError_t rbusTable_addRow(
         myConn = handleInfo->m_connection;
 
     if((err = rbus_invokeRemoteMethod2(myConn,
-        tableName, /*as taken from ccsp_base_api.c, this was the destination component ID, but to locate the route, the table name can be used
-                     because the broker simlpy looks at the top level nodes that are owned by a component route.  maybe this breaks if the broker changes*/
-        METHOD_ADDTBLROW, 
+        tableName,
+        METHOD_ADDTBLROWS, 
         request, 
         rbusConfig_ReadSetTimeout(),
         &response)) != RBUSCORE_SUCCESS)
@@ -3882,93 +4876,126 @@ rbusError_t rbusTable_addRow(
         RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, tableName);
         return rbusCoreError_to_rbusError(err);
     }
-    else
+
+    rbusMessage_GetInt32(response, &returnCode);
+
+    /*a provider without METHOD_ADDTBLROWS answers with the error code alone*/
+    if(rbusMessage_GetInt32(response, &numAdded) != RT_OK)
     {
-        rbusMessage_GetInt32(response, &returnCode);
-        rbusMessage_GetInt32(response, &instanceId);
-        legacyRetCode = (rbusLegacyReturn_t)returnCode;
+        rbusMessage_Release(response);
+        RBUSLOG_INFO("%s %s does not support adding rows in bulk", __FUNCTION__, tableName);
+        return rbusTable_addRowsSerially(handle, tableName, numRows, aliasNames, instNums);
+    }
 
-        if(instNum)
-            *instNum = (uint32_t)instanceId;/*FIXME we need an rbus_PopUInt32 to avoid loosing a bit */
+    legacyRetCode = (rbusLegacyReturn_t)returnCode;
 
-        RBUSLOG_INFO("%s rbus_invokeRemoteMethod2 success response returnCode:%d instanceId:%d", __FUNCTION__, returnCode, instanceId);
-        if((returnCode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    RBUSLOG_INFO("%s rbus_invokeRemoteMethod2 success response returnCode:%d numAdded:%d", __FUNCTION__, returnCode, numAdded);
+    if((returnCode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    {
+        returnCode = RBUS_ERROR_SUCCESS;
+        for(i = 0; i < numAdded && i < numRows; ++i)
         {
-            returnCode = RBUS_ERROR_SUCCESS;
-            RBUSLOG_DEBUG("Successfully Set the Value");
+            int32_t instanceId = 0;
+            rbusMessage_GetInt32(response, &instanceId);
+            if(instNums)
+                instNums[i] = (uint32_t)instanceId;
         }
-        else
+    }
+    else
+    {
+        RBUSLOG_WARN("Response from remote method indicates the call failed!!");
+        if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
         {
-            RBUSLOG_WARN("Response from remote method indicates the call failed!!");
-            if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
-            {
-                returnCode = CCSPError_to_rbusError(legacyRetCode);
-            }
+            returnCode = CCSPError_to_rbusError(legacyRetCode);
         }
-        rbusMessage_Release(response);
     }
+    rbusMessage_Release(response);
 
     return returnCode;
 }
 
-rbusError_t rbusTable_removeRow(
+rbusError_t rbusTable_removeRows(
     rbusHandle_t handle,
-    char const* rowName)
+    int numRows,
+    char const** rowNames)
 {
     rbusCoreError_t err;
     int returnCode = 0;
+    int32_t numRemoved = 0;
     rbusMessage request, response;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*) handle;
     rbusLegacyReturn_t legacyRetCode = RBUS_LEGACY_ERR_FAILURE;
+    int i;
 
     VERIFY_NULL(handle);
-    VERIFY_NULL(rowName);
+    VERIFY_NULL(rowNames);
 
     if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
         return RBUS_ERROR_INVALID_HANDLE;
 
-    RBUSLOG_DEBUG("%s: %s", __FUNCTION__, rowName);
+    if(numRows <= 0)
+        return RBUS_ERROR_INVALID_INPUT;
+
+    for(i = 0; i < numRows; ++i)
+        VERIFY_NULL(rowNames[i]);
+
+    RBUSLOG_DEBUG("%s: %s and %d more rows", __FUNCTION__, rowNames[0], numRows-1);
 
     rbusMessage_Init(&request);
     rbusMessage_SetInt32(request, 0);/*TODO: this should be the session ID*/
-    rbusMessage_SetString(request, rowName);/*TODO: do we need to append the name as well as pass the name as the 1st arg to rbus_invokeRemoteMethod2 ?*/
+    rbusMessage_SetInt32(request, numRows);
+    for(i = 0; i < numRows; ++i)
+        rbusMessage_SetString(request, rowNames[i]);
+
     /* Find direct connection status */
-    rtConnection myConn = rbuscore_FindClientPrivateConnection(rowName);
-        
+    rtConnection myConn = rbuscore_FindClientPrivateConnection(rowNames[0]);
+
     if (NULL == myConn)
         myConn = handleInfo->m_connection;
 
     if((err = rbus_invokeRemoteMethod2(myConn,
-        rowName,
-        METHOD_DELETETBLROW, 
+        rowNames[0], /*all the rows belong to the provider owning the first one*/
+        METHOD_DELETETBLROWS, 
         request, 
         rbusConfig_ReadSetTimeout(),
         &response)) != RBUSCORE_SUCCESS)
     {
-        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, rowName);
+        RBUSLOG_ERROR("%s by %s failed; Received error %d from RBUS Daemon for the object %s", __FUNCTION__, handle->componentName, err, rowNames[0]);
         return rbusCoreError_to_rbusError(err);
     }
-    else
-    {
-        rbusMessage_GetInt32(response, &returnCode);
-        legacyRetCode = (rbusLegacyReturn_t)returnCode;
 
-        RBUSLOG_INFO("%s rbus_invokeRemoteMethod2 success response returnCode:%d", __FUNCTION__, returnCode);
-        if((returnCode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    rbusMessage_GetInt32(response, &returnCode);
+
+    /*a provider without METHOD_DELETETBLROWS answers with the error code alone*/
+    if(rbusMessage_GetInt32(response, &numRemoved) != RT_OK)
+    {
+        rbusMessage_Release(response);
+        RBUSLOG_INFO("%s %s does not support removing rows in bulk", __FUNCTION__, rowNames[0]);
+        for(i = 0; i < numRows; ++i)
         {
-            returnCode = RBUS_ERROR_SUCCESS;
-            RBUSLOG_DEBUG("Successfully Set the Value");
+            rbusError_t rc = rbusTable_removeRow(handle, rowNames[i]);
+            if(rc != RBUS_ERROR_SUCCESS)
+                return rc;
         }
-        else
+        return RBUS_ERROR_SUCCESS;
+    }
+
+    legacyRetCode = (rbusLegacyReturn_t)returnCode;
+
+    RBUSLOG_INFO("%s rbus_invokeRemoteMethod2 success response returnCode:%d numRemoved:%d", __FUNCTION__, returnCode, numRemoved);
+    if((returnCode == RBUS_ERROR_SUCCESS) || (legacyRetCode == RBUS_LEGACY_ERR_SUCCESS))
+    {
+        returnCode = RBUS_ERROR_SUCCESS;
+    }
+    else
+    {
+        RBUSLOG_WARN("Response from remote method indicates the call failed after removing %d rows", numRemoved);
+        if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
         {
-            RBUSLOG_WARN("Response from remote method indicates the call failed!!");
-            if(legacyRetCode > RBUS_LEGACY_ERR_SUCCESS)
-            {
-                returnCode = CCSPError_to_rbusError(legacyRetCode);
-            }
+            returnCode = CCSPError_to_rbusError(legacyRetCode);
         }
-        rbusMessage_Release(response);
     }
+    rbusMessage_Release(response);
 
     return returnCode;
 }
@@ -4040,6 +5067,115 @@ rbusError_t rbusTable_unregisterRow(
     return RBUS_ERROR_SUCCESS;
 }
 
+static int compareInstNums(const void* a, const void* b)
+{
+    uint32_t x = *(uint32_t const*)a;
+    uint32_t y = *(uint32_t const*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+rbusError_t rbusTable_registerRows(
+    rbusHandle_t handle,
+    char const* tableName,
+    int numRows,
+    uint32_t const* instNums,
+    char const** aliasNames)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    char rowName[RBUS_MAX_NAME_LENGTH] = {0};
+    uint32_t* sorted;
+    int rc;
+    int i;
+
+    VERIFY_NULL(handleInfo);
+    VERIFY_NULL(tableName);
+    VERIFY_NULL(instNums);
+
+    if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
+        return RBUS_ERROR_INVALID_HANDLE;
+
+    if(numRows <= 0)
+        return RBUS_ERROR_INVALID_INPUT;
+
+    elementNode* tableInstElem = retrieveInstanceElement(handleInfo->elementRoot, tableName);
+
+    if(!tableInstElem)
+    {
+        RBUSLOG_WARN("%s: table does not exist %s", __FUNCTION__, tableName);
+        return RBUS_ERROR_INVALID_INPUT;
+    }
+
+    /*validate every row before registering any*/
+    for(i = 0; i < numRows; ++i)
+    {
+        rc = snprintf(rowName, RBUS_MAX_NAME_LENGTH, "%s%u", tableName, instNums[i]);
+        if(rc < 0 || rc >= RBUS_MAX_NAME_LENGTH)
+        {
+            RBUSLOG_WARN("%s: invalid table name %s", __FUNCTION__, tableName);
+            return RBUS_ERROR_INVALID_INPUT;
+        }
+
+        if(retrieveInstanceElement(handleInfo->elementRoot, rowName))
+        {
+            RBUSLOG_WARN("%s: row already exists %s", __FUNCTION__, rowName);
+            return RBUS_ERROR_INVALID_INPUT;
+        }
+    }
+
+    sorted = rt_malloc(sizeof(uint32_t) * numRows);
+    memcpy(sorted, instNums, sizeof(uint32_t) * numRows);
+    qsort(sorted, numRows, sizeof(uint32_t), compareInstNums);
+    for(i = 1; i < numRows; ++i)
+    {
+        if(sorted[i] == sorted[i-1])
+            break;
+    }
+    if(i < numRows)
+    {
+        RBUSLOG_WARN("%s: instance number %u appears more than once in %s", __FUNCTION__, sorted[i], tableName);
+        free(sorted);
+        return RBUS_ERROR_INVALID_INPUT;
+    }
+    free(sorted);
+
+    RBUSLOG_DEBUG("%s: register %d table rows in %s", __FUNCTION__, numRows, tableName);
+    registerTableRows(handle, tableInstElem, tableName, numRows, aliasNames, instNums);
+    return RBUS_ERROR_SUCCESS;
+}
+
+rbusError_t rbusTable_unregisterRows(
+    rbusHandle_t handle,
+    int numRows,
+    char const** rowNames)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    int i;
+
+    VERIFY_NULL(handleInfo);
+    VERIFY_NULL(rowNames);
+
+    if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
+        return RBUS_ERROR_INVALID_HANDLE;
+
+    if(numRows <= 0)
+        return RBUS_ERROR_INVALID_INPUT;
+
+    /*validate every row before unregistering any*/
+    for(i = 0; i < numRows; ++i)
+    {
+        VERIFY_NULL(rowNames[i]);
+
+        if(!retrieveInstanceElement(handleInfo->elementRoot, rowNames[i]))
+        {
+            RBUSLOG_DEBUG("%s: row does not exists %s", __FUNCTION__, rowNames[i]);
+            return RBUS_ERROR_INVALID_INPUT;
+        }
+    }
+
+    unregisterTableRows(handle, numRows, rowNames);
+    return RBUS_ERROR_SUCCESS;
+}
+
 rbusError_t rbusTable_getRowNames(
     rbusHandle_t handle,
     char const* tableName,
@@ -4303,6 +5439,7 @@ static rbusMessage rbusEvent_CreateSubscribePayload(rbusEventSubscription_t* sub
     rbusMessage payload = NULL;
 
     rbusMessage_Init(&payload);
+    rbusMessage_SetCaps(payload, RBUS_MESSAGE_CAP_TLV);
 
     rbusMessage_SetInt32(payload, componentId);
     rbusMessage_SetInt32(payload, sub->interval);
@@ -4342,7 +5479,7 @@ static rbusError_t rbusEvent_SubscribeWithRetries(
     int destNotFoundTimeout;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
 
-    if ((rbusEventSubscription_find(handleInfo->eventSubs, eventName, filter, interval, duration))||
+    if ((rbusEventSubscription_find(handleInfo, eventName, filter, interval, duration))||
             (rbusAsyncSubscribe_GetSubscription(handle, eventName, filter)))
     {
         return RBUS_ERROR_SUBSCRIPTION_ALREADY_EXIST;
@@ -4425,7 +5562,7 @@ static rbusError_t rbusEvent_SubscribeWithRetries(
     {
         int initial_value = 0;
         
-        rtVector_PushBack(handleInfo->eventSubs, sub);
+        rbusEventSubscription_add(handleInfo, sub);
 
         if(publishOnSubscribe)
         {
@@ -4527,9 +5664,7 @@ rbusError_t rbusEvent_Unsubscribe(
 
     RBUSLOG_DEBUG("%s: %s", __FUNCTION__, eventName);
 
-    /*the use of rtVector is inefficient here.  I have to loop through the vector to find the sub by name, 
-        then call RemoveItem, which loops through again to find the item by address to destroy */
-    sub = rbusEventSubscription_find(handleInfo->eventSubs, eventName, NULL, 0, 0);
+    sub = rbusEventSubscription_find(handleInfo, eventName, NULL, 0, 0);
 
     if(sub)
     {
@@ -4542,7 +5677,7 @@ rbusError_t rbusEvent_Unsubscribe(
             rbusMessage_Release(payload);
         }
 
-        rtVector_RemoveItem(handleInfo->eventSubs, sub, rbusEventSubscription_free);
+        rbusEventSubscription_remove(handleInfo, sub, rbusEventSubscription_free);
 
         if(coreerr == RBUSCORE_SUCCESS)
         {
@@ -4687,9 +5822,7 @@ rbusError_t rbusEvent_UnsubscribeEx(
 
         RBUSLOG_INFO("%s: %s", __FUNCTION__, subscription[i].eventName);
 
-        /*the use of rtVector is inefficient here.  I have to loop through the vector to find the sub by name, 
-            then call RemoveItem, which loops through again to find the item by address to destroy */
-        sub = rbusEventSubscription_find(handleInfo->eventSubs, subscription[i].eventName, subscription[i].filter, subscription[i].interval, subscription[i].duration);
+        sub = rbusEventSubscription_find(handleInfo, subscription[i].eventName, subscription[i].filter, subscription[i].interval, subscription[i].duration);
         if(sub)
         {
             rbusCoreError_t coreerr;
@@ -4704,7 +5837,7 @@ rbusError_t rbusEvent_UnsubscribeEx(
                 rbusMessage_Release(payload);
             }
 
-            rtVector_RemoveItem(handleInfo->eventSubs, sub, rbusEventSubscription_free);
+            rbusEventSubscription_remove(handleInfo, sub, rbusEventSubscription_free);
 
             if(coreerr != RBUSCORE_SUCCESS)
             {
@@ -4745,6 +5878,22 @@ rbusError_t rbusEvent_UnsubscribeEx(
     return errorcode;
 }
 
+/*true if sub1 and sub2 would be sent the same event message*/
+static bool rbusEvent_SamePayload(rbusSubscription_t* sub1, int result1, rbusSubscription_t* sub2, int result2)
+{
+    if(sub1 == sub2)
+        return true;
+    if(sub1->componentId != sub2->componentId ||
+       sub1->interval != sub2->interval ||
+       sub1->duration != sub2->duration ||
+       sub1->tlv != sub2->tlv ||
+       strcmp(sub1->eventName, sub2->eventName) != 0)
+        return false;
+    if(!sub1->filter || !sub2->filter)
+        return !sub1->filter && !sub2->filter;
+    return result1 == result2 && rbusFilter_Compare(sub1->filter, sub2->filter) == 0;
+}
+
 rbusError_t  rbusEvent_Publish(
   rbusHandle_t          handle,
   rbusEvent_t*          eventData)
@@ -4755,6 +5904,12 @@ rbusError_t  rbusEvent_Publish(
     rbusSubscription_t* subscription;
     rbusValue_t newVal = NULL;
     rbusValue_t oldVal = NULL;
+    rbusSubscription_t** subs;
+    int* results;
+    char const** listeners;
+    size_t numSubs = 0;
+    int numPublish = 0;
+    int i, j;
 
     VERIFY_NULL(handle);
     VERIFY_NULL(eventData);
@@ -4793,21 +5948,28 @@ rbusError_t  rbusEvent_Publish(
         }
     }
 
-    /*Loop through element's subscriptions*/
+    rtList_GetSize(el->subscriptions, &numSubs);
+    if(numSubs == 0)
+        return RBUS_ERROR_NOSUBSCRIBERS;
+    subs = rt_malloc(sizeof(rbusSubscription_t*) * numSubs);
+    results = rt_malloc(sizeof(int) * numSubs);
+    listeners = rt_malloc(sizeof(char const*) * numSubs);
+
+    /*Loop through element's subscriptions, collecting the ones this event goes to*/
     rtList_GetFront(el->subscriptions, &listItem);
     while(listItem)
     {
-        bool publish = true;
-
         rtListItem_GetData(listItem, (void**)&subscription);
+        rtListItem_GetNext(listItem, &listItem);
         if(!subscription || !subscription->eventName || !subscription->listener)
         {
             RBUSLOG_INFO("rbusEvent_Publish failed: null subscriber data");
             if(errOut == RBUSCORE_SUCCESS)
                 errOut = RBUSCORE_ERROR_GENERAL;
-            rtListItem_GetNext(listItem, &listItem);
+            continue;
         }
 
+        results[numPublish] = 0;
         if(eventData->type == RBUS_EVENT_VALUE_CHANGED)
         {
 
@@ -4825,53 +5987,101 @@ rbusError_t  rbusEvent_Publish(
                 int newResult = rbusFilter_Apply(subscription->filter, newVal);
                 int oldResult = rbusFilter_Apply(subscription->filter, oldVal);
 
-                if(newResult != oldResult)
-                {
-                    /*set 'filter' to true/false implying that either the filter has started or stopped matching*/
-                    rbusValue_t filterResult = NULL;
-                    rbusValue_Init(&filterResult);
-                    rbusValue_SetBoolean(filterResult, newResult != 0);
-                    rbusObject_SetValue(eventData->data, "filter", filterResult);
-                    rbusValue_Release(filterResult);                    
-                }
-                else
-                {
-                    publish =  false;
-                }
+                if(newResult == oldResult)
+                    continue;
+                results[numPublish] = newResult != 0;
+            }
+        }
+        subs[numPublish++] = subscription;
+    }
+
+    /*Subscribers whose event message would be byte for byte identical share one serialization
+      and one multicast send; the broker fans it out to each listener*/
+    for(i = 0; i < numPublish; ++i)
+    {
+        rbusMessage msg;
+        int numListeners = 0;
+
+        if(!subs[i])
+            continue;
+        subscription = subs[i];
+        for(j = i; j < numPublish; ++j)
+        {
+            if(subs[j] && rbusEvent_SamePayload(subscription, results[i], subs[j], results[j]))
+            {
+                listeners[numListeners++] = subs[j]->listener;
+                if(j != i)
+                    subs[j] = NULL;
             }
         }
 
-        if(publish)
+        if(eventData->type == RBUS_EVENT_VALUE_CHANGED && subscription->filter)
         {
-            rbusMessage msg;
-            rbusMessage_Init(&msg);
+            /*set 'filter' to true/false implying that either the filter has started or stopped matching*/
+            rbusValue_t filterResult = NULL;
+            rbusValue_Init(&filterResult);
+            rbusValue_SetBoolean(filterResult, results[i] != 0);
+            rbusObject_SetValue(eventData->data, "filter", filterResult);
+            rbusValue_Release(filterResult);
+        }
 
-            rbusEventData_appendToMessage(eventData, subscription->filter, subscription->interval, subscription->duration, subscription->componentId, msg);
+        rbusMessage_Init(&msg);
 
-            RBUSLOG_DEBUG("rbusEvent_Publish: publishing event %s to listener %s", subscription->eventName, subscription->listener);
+        rbusEventData_appendToMessage(eventData, subscription->filter, subscription->interval, subscription->duration, subscription->componentId, subscription->tlv, msg);
 
-            err = rbus_publishSubscriberEvent(
-                handleInfo->componentName,  
-                subscription->eventName/*use the same eventName the consumer subscribed with; not event instance name eventData->name*/, 
-                subscription->listener, 
-                msg);
+        RBUSLOG_DEBUG("rbusEvent_Publish: publishing event %s to %d listeners", subscription->eventName, numListeners);
 
-            rbusMessage_Release(msg);
+        err = rbus_publishSubscriberEvents(
+            handleInfo->componentName,  
+            subscription->eventName/*use the same eventName the consumer subscribed with; not event instance name eventData->name*/, 
+            listeners,
+            numListeners,
+            msg);
 
-            if(err != RBUSCORE_SUCCESS)
-            {
-                if(errOut == RBUSCORE_SUCCESS)
-                    errOut = err;
-                RBUSLOG_INFO("rbusEvent_Publish failed: rbus_publishSubscriberEvent return error %d", err);
-            }
-        }   
+        rbusMessage_Release(msg);
 
-        rtListItem_GetNext(listItem, &listItem);
+        if(err != RBUSCORE_SUCCESS)
+        {
+            if(errOut == RBUSCORE_SUCCESS)
+                errOut = err;
+            RBUSLOG_INFO("rbusEvent_Publish failed: rbus_publishSubscriberEvents return error %d", err);
+        }
     }
 
+    free(subs);
+    free(results);
+    free(listeners);
+
     return errOut == RBUSCORE_SUCCESS ? RBUS_ERROR_SUCCESS: RBUS_ERROR_BUS_ERROR;
 }
 
+rbusError_t rbus_setValueChanged(
+    rbusHandle_t handle,
+    char const* name,
+    rbusValue_t value)
+{
+    struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
+    elementNode* el;
+
+    VERIFY_NULL(handle);
+    VERIFY_NULL(name);
+
+    if (handleInfo->m_handleType != RBUS_HWDL_TYPE_REGULAR)
+        return RBUS_ERROR_INVALID_HANDLE;
+
+    el = retrieveInstanceElement(handleInfo->elementRoot, name);
+    if(!el)
+    {
+        RBUSLOG_WARN("%s: retrieveElement return NULL for %s", __FUNCTION__, name);
+        return RBUS_ERROR_ELEMENT_DOES_NOT_EXIST;
+    }
+    if(el->type != RBUS_ELEMENT_TYPE_PROPERTY)
+        return RBUS_ERROR_INVALID_INPUT;
+
+    rbusValueChange_NotifyChanged(handle, el, value);
+    return RBUS_ERROR_SUCCESS;
+}
+
 rbusError_t rbusMethod_InvokeInternal(
     rbusHandle_t handle, 
     char const* methodName, 
@@ -4893,6 +6103,7 @@ rbusError_t rbusMethod_InvokeInternal(
     RBUSLOG_DEBUG("%s: %s", __FUNCTION__, methodName);
 
     rbusMessage_Init(&request);
+    rbusMessage_SetCaps(request, RBUS_MESSAGE_CAP_TLV);
     rbusMessage_SetInt32(request, 0);/*TODO: this should be the session ID*/
     rbusMessage_SetString(request, methodName); /*TODO: do we need to append the name as well as pass the name as the 1st arg to rbus_invokeRemoteMethod2 ?*/
 
@@ -4968,13 +6179,13 @@ typedef struct _rbusMethodInvokeAsyncData_t
     int timeout;
 } rbusMethodInvokeAsyncData_t;
 
-static void* rbusMethod_InvokeAsyncThreadFunc(void *p)
+static void rbusMethod_InvokeAsyncTaskFunc(void *p)
 {
     rbusError_t err;
     rbusMethodInvokeAsyncData_t* data = p;
     rbusObject_t outParams = NULL;
     if(!data)
-        return NULL;
+        return;
     err = rbusMethod_InvokeInternal(
         data->handle,
         data->methodName, 
@@ -4989,8 +6200,6 @@ static void* rbusMethod_InvokeAsyncThreadFunc(void *p)
         rbusObject_Release(outParams);
     free(data->methodName);
     free(data);
-
-    return NULL;
 }
 
 rbusError_t rbusMethod_InvokeAsync(
@@ -5001,9 +6210,8 @@ rbusError_t rbusMethod_InvokeAsync(
     int timeout)
 {
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
-    pthread_t pid;
     rbusMethodInvokeAsyncData_t* data;
-    int err = 0;
+    rbusError_t err;
 
     VERIFY_NULL(handle);
     VERIFY_NULL(methodName);
@@ -5021,15 +6229,13 @@ rbusError_t rbusMethod_InvokeAsync(
     data->callback = callback;
     data->timeout = timeout > 0 ? (timeout * 1000) : rbusConfig_ReadSetTimeout(); /* convert seconds to milliseconds */
 
-    if((err = pthread_create(&pid, NULL, rbusMethod_InvokeAsyncThreadFunc, data)) != 0)
-    {
-        RBUSLOG_ERROR("%s pthread_create failed: err=%d", __FUNCTION__, err);
-        return RBUS_ERROR_BUS_ERROR;
-    }
-
-    if((err = pthread_detach(pid)) != 0)
+    if((err = rbusExecutor_Run(rbusMethod_InvokeAsyncTaskFunc, data, true)) != RBUS_ERROR_SUCCESS)
     {
-        RBUSLOG_ERROR("%s pthread_detach failed: err=%d", __FUNCTION__, err);
+        RBUSLOG_ERROR("%s rbusExecutor_Run failed: err=%d", __FUNCTION__, err);
+        rbusObject_Release(data->inParams);
+        free(data->methodName);
+        free(data);
+        return err;
     }
 
     return RBUS_ERROR_SUCCESS;
@@ -5041,6 +6247,7 @@ rbusError_t rbusMethod_SendAsyncResponse(
     rbusObject_t outParams)
 {
     rbusMessage response;
+    rbusBuffer_t block;
 
     VERIFY_NULL(asyncHandle);
     rbusValue_t value1, value2;
@@ -5058,7 +6265,9 @@ rbusError_t rbusMethod_SendAsyncResponse(
         rbusObject_SetValue(outParams, "error_code", value1);
         rbusObject_SetValue(outParams, "error_string", value2);
     }
-    rbusObject_appendToMessage(outParams, response);
+    block = rbusTlvBlock_Begin((asyncHandle->caps & RBUS_MESSAGE_CAP_TLV) != 0);
+    rbusTlvBlock_AppendObject(block, outParams, response);
+    rbusTlvBlock_End(block, response);
     rbus_sendResponse(&asyncHandle->hdr, response);
     rbusValue_Release(value1);
     rbusValue_Release(value2);
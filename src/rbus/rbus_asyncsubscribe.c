@@ -19,7 +19,9 @@
 #define _GNU_SOURCE 1
 #include "rbus_asyncsubscribe.h"
 #include "rbus_config.h"
+#include "rbus_executor.h"
 #include "rbus_log.h"
+#include <rtVector.h>
 #include <rtTime.h>
 #include <rtList.h>
 #include <rtMemory.h>
@@ -49,6 +51,7 @@ typedef struct AsyncSubscribeRetrier_t
 {
     rtList items;
     pthread_cond_t condItemAdded;
+    pthread_cond_t condItemDone;
     pthread_mutex_t mutexQueue;
     int isRunning;
     pthread_t threadId;
@@ -61,6 +64,7 @@ typedef struct AsyncSubscription_t
     int nextWaitTime;
     rtTime_t startTime;
     rtTime_t nextRetryTime;
+    bool inFlight;          /*a subscribe attempt is running on the executor*/
 } AsyncSubscription_t;
 
 static AsyncSubscribeRetrier_t* gRetrier = NULL;
@@ -128,7 +132,7 @@ static int rbusAsyncSubscribeRetrier_DetermineNextSendTime(rtTime_t* nextSendTim
 
         RBUSLOG_INFO("%s item=%s", __FUNCTION__, rtTime_ToString(&item->nextRetryTime, tbuff));
 
-        if(rtTime_Compare(&item->nextRetryTime, nextSendTime) < 0)
+        if(!item->inFlight && rtTime_Compare(&item->nextRetryTime, nextSendTime) < 0)
         {
           *nextSendTime = item->nextRetryTime;
         }
@@ -155,114 +159,141 @@ static int rbusAsyncSubscribeRetrier_DetermineNextSendTime(rtTime_t* nextSendTim
     return 0;//meaning there's nothing past due currently
 }
 
+/*runs one subscribe attempt on the executor so a slow provider doesn't hold up the other pending subscriptions*/
+static void rbusAsyncSubscribeRetrier_SendSubscriptionRequest(void* p)
+{
+    AsyncSubscription_t* item = p;
+    rbusEventSubscription_t* subscription = NULL;
+    rbusError_t responseErr = RBUS_ERROR_SUCCESS;
+    rbusCoreError_t coreerr;
+    rtTime_t now;
+    int elapsed;
+    int providerError;
+
+    RBUSLOG_INFO("%s: %s subscribing", __FUNCTION__, item->subscription->eventName);
+
+    coreerr = rbus_subscribeToEvent(NULL, item->subscription->eventName, 
+                _event_callback_handler, item->payload, item->subscription, &providerError);
+
+    rtTime_Now(&now);
+
+    elapsed = rtTime_Elapsed(&item->startTime, &now);
+
+    LOCK();
+    item->inFlight = false;
+
+    if(coreerr == RBUSCORE_ERROR_DESTINATION_UNREACHABLE &&  /*the only error that means provider not found yet*/
+     elapsed < rbusConfig_Get()->subscribeTimeout)    /*if we haven't timeout out yet*/
+    {
+        if(item->nextWaitTime == 0)
+            item->nextWaitTime = 1000; //miliseconds
+        else
+            item->nextWaitTime *= 2;//just double the time
+
+        //apply a limit to our doubling
+        if(item->nextWaitTime > rbusConfig_Get()->subscribeMaxWait)
+          item->nextWaitTime = rbusConfig_Get()->subscribeMaxWait;
+
+        //update nextRetryTime to nextWaitTime miliseconds from now, without exceeding subscribeTimeout
+        if(elapsed + item->nextWaitTime < rbusConfig_Get()->subscribeTimeout)
+        {
+            rtTime_Later(&now, item->nextWaitTime, &item->nextRetryTime);
+        }
+        else
+        {
+            //its possible to have the odd situation, based on how subscribeTimeout/subscribeMaxWait are configured, 
+            //where this final retry happens very close to the previous retry (e.g. ... wait 60, sub, wait 60, sub, wait 1, sub)
+            rtTime_Later(&item->startTime, rbusConfig_Get()->subscribeTimeout, &item->nextRetryTime);
+        }
+
+        RBUSLOG_INFO("%s: %s no provider. retry in %d ms with %d left", 
+            __FUNCTION__, 
+            item->subscription->eventName, 
+            rtTime_Elapsed(&now, &item->nextRetryTime), 
+            rbusConfig_Get()->subscribeTimeout - elapsed );
+    }
+    else
+    {
+        if(coreerr == RBUSCORE_SUCCESS)
+        {
+            RBUSLOG_INFO("%s: %s subscribe retries succeeded", __FUNCTION__, item->subscription->eventName);
+            responseErr = RBUS_ERROR_SUCCESS;
+        }
+        else
+        {
+            if(coreerr == RBUSCORE_ERROR_DESTINATION_UNREACHABLE)
+            {
+                RBUSLOG_INFO("%s: %s all subscribe retries failed and no provider found", __FUNCTION__, item->subscription->eventName);
+                RBUSLOG_WARN("EVENT_SUBSCRIPTION_FAIL_NO_PROVIDER_COMPONENT  %s", item->subscription->eventName);/*RDKB-33658-AC7*/
+                responseErr = RBUS_ERROR_TIMEOUT;
+            }
+            else if(providerError != RBUS_ERROR_SUCCESS)
+            {
+                RBUSLOG_INFO("%s: %s subscribe retries failed due provider error %d", __FUNCTION__, item->subscription->eventName, providerError);
+                RBUSLOG_WARN("EVENT_SUBSCRIPTION_FAIL_INVALID_INPUT  %s", item->subscription->eventName);/*RDKB-33658-AC9*/
+                responseErr = providerError;
+            }
+            else
+            {  
+                RBUSLOG_INFO("%s: %s subscribe retries failed due to core error %d", __FUNCTION__, item->subscription->eventName, coreerr);
+                responseErr = RBUS_ERROR_BUS_ERROR;
+            }
+        }
+
+        subscription = item->subscription;
+        item->subscription = NULL;/*ownership no longer ours*/
+        rtList_RemoveItemWithData(gRetrier->items, item, rbusAsyncSubscribeRetrier_FreeSubscription);
+    }
+
+    //wake anyone waiting for this attempt and let the retrier schedule the item's next retry
+    ERROR_CHECK(pthread_cond_broadcast(&gRetrier->condItemDone));
+    ERROR_CHECK(pthread_cond_signal(&gRetrier->condItemAdded));
+    UNLOCK();
+
+    /*called once the item is out of the list so the handler is free to unsubscribe*/
+    if(subscription)
+        _subscribe_async_callback_handler(subscription->handle, subscription, responseErr);
+}
+
+/*called with the lock held, hands every item that is due to the executor*/
 static void rbusAsyncSubscribeRetrier_SendSubscriptionRequests()
 {
     rtListItem li;
     rtTime_t now;
+    rtVector due;
+    size_t i;
 
     RBUSLOG_DEBUG("%s enter", __FUNCTION__);
 
     rtTime_Now(&now);
+    rtVector_Create(&due);
 
     rtList_GetFront(gRetrier->items, &li);
-
     while(li)
     {
         AsyncSubscription_t* item;
 
         rtListItem_GetData(li, (void**)&item);
 
-        if(rtTime_Compare(&item->nextRetryTime, &now) <= 0)
+        if(!item->inFlight && rtTime_Compare(&item->nextRetryTime, &now) <= 0)
         {
-            rbusCoreError_t coreerr;
-            int elapsed;
-            int providerError;
-
-            RBUSLOG_INFO("%s: %s subscribing", __FUNCTION__, item->subscription->eventName);
-
-            coreerr = rbus_subscribeToEvent(NULL, item->subscription->eventName, 
-                        _event_callback_handler, item->payload, item->subscription, &providerError);
-
-            rtTime_Now(&now);
-
-            elapsed = rtTime_Elapsed(&item->startTime, &now);
-
-            if(coreerr == RBUSCORE_ERROR_DESTINATION_UNREACHABLE &&  /*the only error that means provider not found yet*/
-             elapsed < rbusConfig_Get()->subscribeTimeout)    /*if we haven't timeout out yet*/
-            {
-                if(item->nextWaitTime == 0)
-                    item->nextWaitTime = 1000; //miliseconds
-                else
-                    item->nextWaitTime *= 2;//just double the time
-
-                //apply a limit to our doubling
-                if(item->nextWaitTime > rbusConfig_Get()->subscribeMaxWait)
-                  item->nextWaitTime = rbusConfig_Get()->subscribeMaxWait;
-
-                //update nextRetryTime to nextWaitTime miliseconds from now, without exceeding subscribeTimeout
-                if(elapsed + item->nextWaitTime < rbusConfig_Get()->subscribeTimeout)
-                {
-                    rtTime_Later(&now, item->nextWaitTime, &item->nextRetryTime);
-                }
-                else
-                {
-                    //its possible to have the odd situation, based on how subscribeTimeout/subscribeMaxWait are configured, 
-                    //where this final retry happens very close to the previous retry (e.g. ... wait 60, sub, wait 60, sub, wait 1, sub)
-                    rtTime_Later(&item->startTime, rbusConfig_Get()->subscribeTimeout, &item->nextRetryTime);
-                }
-
-                RBUSLOG_INFO("%s: %s no provider. retry in %d ms with %d left", 
-                    __FUNCTION__, 
-                    item->subscription->eventName, 
-                    rtTime_Elapsed(&now, &item->nextRetryTime), 
-                    rbusConfig_Get()->subscribeTimeout - elapsed );
-            }
-            else
-            {
-                rbusError_t responseErr;
-                rtListItem tmp;
-
-                if(coreerr == RBUSCORE_SUCCESS)
-                {
-                    RBUSLOG_INFO("%s: %s subscribe retries succeeded", __FUNCTION__, item->subscription->eventName);
-                    responseErr = RBUS_ERROR_SUCCESS;
-                }
-                else
-                {
-                    if(coreerr == RBUSCORE_ERROR_DESTINATION_UNREACHABLE)
-                    {
-                        RBUSLOG_INFO("%s: %s all subscribe retries failed and no provider found", __FUNCTION__, item->subscription->eventName);
-                        RBUSLOG_WARN("EVENT_SUBSCRIPTION_FAIL_NO_PROVIDER_COMPONENT  %s", item->subscription->eventName);/*RDKB-33658-AC7*/
-                        responseErr = RBUS_ERROR_TIMEOUT;
-                    }
-                    else if(providerError != RBUS_ERROR_SUCCESS)
-                    {
-                        RBUSLOG_INFO("%s: %s subscribe retries failed due provider error %d", __FUNCTION__, item->subscription->eventName, providerError);
-                        RBUSLOG_WARN("EVENT_SUBSCRIPTION_FAIL_INVALID_INPUT  %s", item->subscription->eventName);/*RDKB-33658-AC9*/
-                        responseErr = providerError;
-                    }
-                    else
-                    {  
-                        RBUSLOG_INFO("%s: %s subscribe retries failed due to core error %d", __FUNCTION__, item->subscription->eventName, coreerr);
-                        responseErr = RBUS_ERROR_BUS_ERROR;
-                    }
-                }
-
-                _subscribe_async_callback_handler(item->subscription->handle, item->subscription, responseErr);
-
-                item->subscription = NULL;/*ownership no longer ours*/
-
-                //store the next item, because we are removing this li item from list
-                rtListItem_GetNext(li, &tmp); 
-
-                rtList_RemoveItem(gRetrier->items, li, rbusAsyncSubscribeRetrier_FreeSubscription);
-
-                li = tmp;
-                continue;//li is already the next item so avoid GetNext below
-          }
+            item->inFlight = true;
+            rtVector_PushBack(due, item);
         }
         rtListItem_GetNext(li, &li);    
     }
+
+    //items stay in the list while in flight, remove and close wait for them to come back
+    UNLOCK();
+    for(i = 0; i < rtVector_Size(due); ++i)
+    {
+        AsyncSubscription_t* item = rtVector_At(due, i);
+        if(rbusExecutor_Run(rbusAsyncSubscribeRetrier_SendSubscriptionRequest, item, true) != RBUS_ERROR_SUCCESS)
+            rbusAsyncSubscribeRetrier_SendSubscriptionRequest(item);
+    }
+    LOCK();
+
+    rtVector_Destroy(due, NULL);
     RBUSLOG_DEBUG("%s exit", __FUNCTION__);
 }
 
@@ -276,9 +307,7 @@ static void* AsyncSubscribeRetrier_threadFunc(void* data)
 
         while(rbusAsyncSubscribeRetrier_DetermineNextSendTime(&nextSendTime))
         {
-            UNLOCK();
             rbusAsyncSubscribeRetrier_SendSubscriptionRequests();
-            LOCK();
         }
 
         if(gRetrier->isRunning)
@@ -326,6 +355,7 @@ static void rbusAsyncSubscribeRetrier_Create()
     ERROR_CHECK(pthread_condattr_init(&cattrib));
     ERROR_CHECK(pthread_condattr_setclock(&cattrib, CLOCK_MONOTONIC));
     ERROR_CHECK(pthread_cond_init(&gRetrier->condItemAdded, &cattrib));
+    ERROR_CHECK(pthread_cond_init(&gRetrier->condItemDone, &cattrib));
     ERROR_CHECK(pthread_condattr_destroy(&cattrib));
 
     ERROR_CHECK(pthread_create(&gRetrier->threadId, NULL, AsyncSubscribeRetrier_threadFunc, NULL));
@@ -347,6 +377,7 @@ static void rbusAsyncSubscribeRetrier_Destroy()
 
     ERROR_CHECK(pthread_mutex_destroy(&gRetrier->mutexQueue));
     ERROR_CHECK(pthread_cond_destroy(&gRetrier->condItemAdded));
+    ERROR_CHECK(pthread_cond_destroy(&gRetrier->condItemDone));
     rtList_Destroy(gRetrier->items, rbusAsyncSubscribeRetrier_FreeSubscription);
 
     free(gRetrier);
@@ -373,6 +404,7 @@ void rbusAsyncSubscribe_AddSubscription(rbusEventSubscription_t* subscription, r
     item->subscription = subscription;
     item->payload = payload;
     item->nextWaitTime = 0;
+    item->inFlight = false;
 
     rtTime_Now(&item->startTime);
     item->nextRetryTime = item->startTime; /*set to now also so we do our first sub immediately*/
@@ -394,7 +426,11 @@ bool rbusAsyncSubscribe_RemoveSubscription(rbusEventSubscription_t* subscription
     bool sub_removed = false;
     if(!gRetrier || subscription == NULL)
         return false;
+    AsyncSubscription_t* item;
     LOCK();
+    //an attempt in flight is using the item so wait for it, it may finish the subscription and remove it itself
+    while((item = rtList_Find(gRetrier->items, subscription, rbusAsyncSubscribeRetrier_CompareSubscription)) && item->inFlight)
+        ERROR_CHECK(pthread_cond_wait(&gRetrier->condItemDone, &gRetrier->mutexQueue));
     err = rtList_RemoveItemByCompare(gRetrier->items, subscription,
         rbusAsyncSubscribeRetrier_CompareSubscription, rbusAsyncSubscribeRetrier_FreeSubscription);
     if(err == RT_OK)
@@ -429,6 +465,7 @@ bool rbusAsyncSubscribe_GetSubscription(rbusHandle_t handle, char const* eventNa
 void rbusAsyncSubscribe_CloseHandle(rbusHandle_t handle)
 {
     size_t size1, size;
+    AsyncSubscription_t* item;
 
     if(!gRetrier)
         return;
@@ -439,9 +476,18 @@ void rbusAsyncSubscribe_CloseHandle(rbusHandle_t handle)
 
     rtList_GetSize(gRetrier->items, &size1);
 
-    //remove all items with this handle
-    rtList_RemoveItemByCompare(gRetrier->items, handle, 
-                             rbusAsyncSubscribeRetrier_CompareHandle, rbusAsyncSubscribeRetrier_FreeSubscription);
+    //remove all items with this handle, waiting on any that have an attempt in flight
+    while((item = rtList_Find(gRetrier->items, handle, rbusAsyncSubscribeRetrier_CompareHandle)))
+    {
+        if(item->inFlight)
+        {
+            ERROR_CHECK(pthread_cond_wait(&gRetrier->condItemDone, &gRetrier->mutexQueue));
+        }
+        else
+        {
+            rtList_RemoveItemWithData(gRetrier->items, item, rbusAsyncSubscribeRetrier_FreeSubscription);
+        }
+    }
 
     //if list is empty, we can destruct
     rtList_GetSize(gRetrier->items, &size);
@@ -120,7 +120,10 @@ void rbusBuffer_Reserve(rbusBuffer_t buff, int len)
     int posNext = buff->posWrite+len;
     if(posNext > buff->lenAlloc)
     {
-        buff->lenAlloc = (posNext/BUFFER_BLOCK_SIZE+1)*BUFFER_BLOCK_SIZE;
+        /*double so a buffer written a field at a time is only copied a logarithmic number of times*/
+        buff->lenAlloc *= 2;
+        if(posNext > buff->lenAlloc)
+            buff->lenAlloc = (posNext/BUFFER_BLOCK_SIZE+1)*BUFFER_BLOCK_SIZE;
         if(buff->data == buff->block1)
         {
             buff->data = rt_malloc(buff->lenAlloc);
@@ -137,14 +140,50 @@ void rbusBuffer_Reserve(rbusBuffer_t buff, int len)
 void rbusBuffer_WriteTypeLengthValue(
   rbusBuffer_t      buff,
   rbusValueType_t   type,
-  uint16_t          length,
+  uint32_t          length,
   void const*       value)
 {
   uint16_t letype = rbusHostToLittleInt16(type);
-  uint16_t lelength = rbusHostToLittleInt16(length);
-  rbusBuffer_Write(buff, &letype, sizeof(uint16_t));
-  rbusBuffer_Write(buff, &lelength, sizeof(uint16_t));
-  rbusBuffer_Write(buff, value, length);
+  uint16_t lelength = rbusHostToLittleInt16(length < RBUS_BUFFER_LENGTH_EXTENDED ? length : RBUS_BUFFER_LENGTH_EXTENDED);
+  uint8_t* p;
+
+  VERIFY_NULL(buff);
+  /*reserve the whole field once and copy straight in rather than through rbusBuffer_Write per part*/
+  rbusBuffer_Reserve(buff, sizeof(uint16_t) * 2 + (length >= RBUS_BUFFER_LENGTH_EXTENDED ? sizeof(uint32_t) : 0) + length);
+  p = buff->data + buff->posWrite;
+  memcpy(p, &letype, sizeof(uint16_t));
+  p += sizeof(uint16_t);
+  memcpy(p, &lelength, sizeof(uint16_t));
+  p += sizeof(uint16_t);
+  if(length >= RBUS_BUFFER_LENGTH_EXTENDED)
+  {
+    uint32_t lelength32 = rbusHostToLittleInt32(length);
+    memcpy(p, &lelength32, sizeof(uint32_t));
+    p += sizeof(uint32_t);
+  }
+  if(length && value)
+  {
+    memcpy(p, value, length);
+    p += length;
+  }
+  buff->posWrite = p - buff->data;
+}
+
+int rbusBuffer_ReadTypeLength(rbusBuffer_t const buff, uint16_t* type, uint32_t* length)
+{
+    uint16_t letype;
+    uint16_t lelength;
+
+    if(!buff || buff->posRead + (int)sizeof(uint16_t) * 2 > buff->posWrite)
+        return -1;
+    memcpy(&letype, buff->data + buff->posRead, sizeof(uint16_t));
+    memcpy(&lelength, buff->data + buff->posRead + sizeof(uint16_t), sizeof(uint16_t));
+    buff->posRead += sizeof(uint16_t) * 2;
+    *type = rbusLittleToHostInt16(letype);
+    if(rbusLittleToHostInt16(lelength) == RBUS_BUFFER_LENGTH_EXTENDED)
+        return rbusBuffer_ReadUInt32(buff, length);
+    *length = rbusLittleToHostInt16(lelength);
+    return 0;
 }
 
 void rbusBuffer_WriteStringTLV(rbusBuffer_t buff, char const* s, int len)
@@ -257,7 +296,7 @@ int rbusBuffer_Read(rbusBuffer_t const buff, void* data, int len)
 {
     if((!buff) || (!data))
         return -1;
-    if(!(buff->posRead + len < buff->lenAlloc))
+    if(len < 0 || buff->posRead + len > buff->posWrite)
     {
         RBUSLOG_WARN("rbusBuffer_Read failed");
         return -1;
@@ -53,11 +53,23 @@ void rbusValue_Encode(rbusValue_t value, rbusBuffer_t buff);
 void rbusFilter_Encode(rbusFilter_t filter, rbusBuffer_t buff);
 int rbusFilter_Decode(rbusFilter_t* filter, rbusBuffer_t const buff);
 
+/*A property is encoded as its name followed by its value.  A list is a UINT32 count followed by
+  that many properties.  An object is its name, INT32 type, property list, UINT32 child count and
+  children.  A value of type RBUS_PROPERTY or RBUS_OBJECT is a zero length TLV followed by these.*/
+void rbusProperty_Encode(rbusProperty_t property, rbusBuffer_t buff);
+int rbusProperty_Decode(rbusProperty_t* property, rbusBuffer_t const buff);
+void rbusPropertyList_Encode(rbusProperty_t property, rbusBuffer_t buff);
+int rbusPropertyList_Decode(rbusProperty_t* property, rbusBuffer_t const buff);
+void rbusObject_Encode(rbusObject_t object, rbusBuffer_t buff);
+int rbusObject_Decode(rbusObject_t* object, rbusBuffer_t const buff);
+
 void rbusBuffer_Create(rbusBuffer_t* buff);
 void rbusBuffer_Destroy(rbusBuffer_t buff);
 void rbusBuffer_Reserve(rbusBuffer_t buff, int len);
 void rbusBuffer_Write(rbusBuffer_t buff, void const* data, int len);
-void rbusBuffer_WriteTypeLengthValue(rbusBuffer_t buff, rbusValueType_t type, uint16_t length, void const* value);
+/*Lengths of 0xFFFF and up are written as 0xFFFF followed by the real length in 32 bits*/
+#define RBUS_BUFFER_LENGTH_EXTENDED 0xFFFF
+void rbusBuffer_WriteTypeLengthValue(rbusBuffer_t buff, rbusValueType_t type, uint32_t length, void const* value);
 void rbusBuffer_WriteBooleanTLV(rbusBuffer_t buff, bool b);
 void rbusBuffer_WriteCharTLV(rbusBuffer_t buff, char c);
 void rbusBuffer_WriteByteTLV(rbusBuffer_t buff, unsigned char u);
@@ -76,6 +88,7 @@ void rbusBuffer_WriteDateTimeTLV(rbusBuffer_t buff, rbusDateTime_t const* tv);
 void rbusBuffer_WriteBytesTLV(rbusBuffer_t buff, uint8_t* bytes, int len);
 /*The Read functions return 0 on success or -1 on failure (reading that would result in memory overrun)*/
 int rbusBuffer_Read(rbusBuffer_t const buff, void* data, int len);
+int rbusBuffer_ReadTypeLength(rbusBuffer_t const buff, uint16_t* type, uint32_t* length);
 int rbusBuffer_ReadBoolean(rbusBuffer_t const buff, bool* b);
 int rbusBuffer_ReadChar(rbusBuffer_t const buff, char* c);
 int rbusBuffer_ReadByte(rbusBuffer_t const buff, unsigned char* u);
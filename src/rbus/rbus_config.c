@@ -30,8 +30,14 @@
 #define RBUS_SUBSCRIBE_TIMEOUT   600000     /*subscribe retry timeout in miliseconds*/
 #define RBUS_SUBSCRIBE_MAXWAIT   60000      /*subscribe retry max wait between retries in miliseconds*/
 #define RBUS_VALUECHANGE_PERIOD  2000       /*polling period for valuechange detector*/
+#define RBUS_VALUECHANGE_PERIOD_MIN 500     /*shortest polling period for params the valuechange detector sees changing*/
+#define RBUS_VALUECHANGE_PERIOD_MAX 8000    /*polling period for params whose provider calls rbus_setValueChanged*/
+#define RBUS_VALUECHANGE_THREADS 2          /*worker threads polling for the valuechange detector*/
+#define RBUS_EXECUTOR_THREADS    8          /*max threads running async work: method calls, subscribe retries, interval events*/
+#define RBUS_EXECUTOR_QUEUE      256        /*tasks the executor will queue before applying backpressure*/
 #define RBUS_GET_DEFAULT_TIMEOUT 15000      /* default timeout in miliseconds for GET API */
 #define RBUS_SET_DEFAULT_TIMEOUT 15000      /* default timeout in miliseconds for SET API */
+#define RBUS_DISCOVERY_CACHE_TTL 30000      /* lifetime in miliseconds of cached component discovery results */
 #define RBUS_GET_TIMEOUT_OVERRIDE "/tmp/rbus_timeout_get"
 #define RBUS_SET_TIMEOUT_OVERRIDE "/tmp/rbus_timeout_set"
 
@@ -64,8 +70,14 @@ void rbusConfig_CreateOnce()
     initInt(gConfig->subscribeTimeout,      RBUS_SUBSCRIBE_TIMEOUT);
     initInt(gConfig->subscribeMaxWait,      RBUS_SUBSCRIBE_MAXWAIT);
     initInt(gConfig->valueChangePeriod,     RBUS_VALUECHANGE_PERIOD);
+    initInt(gConfig->valueChangePeriodMin,  RBUS_VALUECHANGE_PERIOD_MIN);
+    initInt(gConfig->valueChangePeriodMax,  RBUS_VALUECHANGE_PERIOD_MAX);
+    initInt(gConfig->valueChangeThreads,    RBUS_VALUECHANGE_THREADS);
+    initInt(gConfig->executorThreads,       RBUS_EXECUTOR_THREADS);
+    initInt(gConfig->executorQueueDepth,    RBUS_EXECUTOR_QUEUE);
     initInt(gConfig->getTimeout,            RBUS_GET_DEFAULT_TIMEOUT);
     initInt(gConfig->setTimeout,            RBUS_SET_DEFAULT_TIMEOUT);
+    initInt(gConfig->discoveryCacheTTL,     RBUS_DISCOVERY_CACHE_TTL);
 }
 
 void rbusConfig_Destroy()
@@ -32,8 +32,14 @@ typedef struct _rbusConfig_t
     int             subscribeTimeout;   /* max time to attempt subscribe retries in milisecond*/
     int             subscribeMaxWait;   /* max time to wait between subscribe retries in miliseconds*/
     int             valueChangePeriod;  /* polling period for valuechange detector in miliseconds*/
+    int             valueChangePeriodMin; /* shortest polling period for params seen changing in miliseconds*/
+    int             valueChangePeriodMax; /* polling period for params whose provider notifies changes in miliseconds*/
+    int             valueChangeThreads; /* worker threads polling for the valuechange detector*/
+    int             executorThreads;    /* max threads running async work: method calls, subscribe retries, interval events*/
+    int             executorQueueDepth; /* tasks the executor queues before callers block or are refused*/
     int             getTimeout;         /* default timeout in miliseconds for GET API*/
     int             setTimeout;         /* default timeout in miliseconds for SET API*/
+    int             discoveryCacheTTL;  /* lifetime in miliseconds of cached element to component resolutions, 0 disables*/
 } rbusConfig_t;
 
 void rbusConfig_CreateOnce();
@@ -0,0 +1,221 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file
+ * the following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "rbus_discoverycache.h"
+#include "rbus_log.h"
+#include <rtHashMap.h>
+#include <rtMemory.h>
+#include <rtTime.h>
+#include <rtVector.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RBUS_DISCOVERYCACHE_MAX 1024
+
+/*component names are interned so a disconnect can invalidate every element it
+  owned without walking the map; entries of a dead component are dropped lazily*/
+typedef struct _rbusDiscoveryComponent
+{
+    char* name;
+    bool valid;
+} rbusDiscoveryComponent_t;
+
+typedef struct _rbusDiscoveryEntry
+{
+    rbusDiscoveryComponent_t* component;
+    rtTime_t expires;
+} rbusDiscoveryEntry_t;
+
+struct _rbusDiscoveryCache
+{
+    int ttl;
+    rtHashMap entries;
+    rtVector components;
+    pthread_mutex_t mutex;
+    rbusDiscoveryCacheStats_t stats;
+};
+
+static void rbusDiscoveryComponent_Destroy(void* p)
+{
+    rbusDiscoveryComponent_t* component = p;
+    free(component->name);
+    free(component);
+}
+
+static void rbusDiscoveryCache_Reset(rbusDiscoveryCache_t cache)
+{
+    if(cache->entries)
+        rtHashMap_Destroy(cache->entries);
+    if(cache->components)
+        rtVector_Destroy(cache->components, rbusDiscoveryComponent_Destroy);
+    rtHashMap_CreateEx(&cache->entries, 0, NULL, NULL, NULL, NULL, NULL, rtHashMap_Destroy_Func_Free);
+    rtVector_Create(&cache->components);
+}
+
+static rbusDiscoveryComponent_t* rbusDiscoveryCache_GetComponent(rbusDiscoveryCache_t cache, char const* name)
+{
+    size_t i;
+    size_t len = rtVector_Size(cache->components);
+    rbusDiscoveryComponent_t* component;
+
+    for(i = 0; i < len; ++i)
+    {
+        component = rtVector_At(cache->components, i);
+        if(component->valid && strcmp(component->name, name) == 0)
+            return component;
+    }
+    component = rt_malloc(sizeof(rbusDiscoveryComponent_t));
+    component->name = strdup(name);
+    component->valid = true;
+    rtVector_PushBack(cache->components, component);
+    return component;
+}
+
+void rbusDiscoveryCache_Create(rbusDiscoveryCache_t* cache, int ttl)
+{
+    *cache = rt_calloc(1, sizeof(struct _rbusDiscoveryCache));
+    (*cache)->ttl = ttl;
+    pthread_mutex_init(&(*cache)->mutex, NULL);
+    rbusDiscoveryCache_Reset(*cache);
+}
+
+void rbusDiscoveryCache_Destroy(rbusDiscoveryCache_t cache)
+{
+    if(!cache)
+        return;
+    rtHashMap_Destroy(cache->entries);
+    rtVector_Destroy(cache->components, rbusDiscoveryComponent_Destroy);
+    pthread_mutex_destroy(&cache->mutex);
+    free(cache);
+}
+
+bool rbusDiscoveryCache_Lookup(rbusDiscoveryCache_t cache, int numElements, char const** elements, char*** components)
+{
+    rtTime_t now;
+    int i;
+    bool hit = true;
+
+    *components = NULL;
+    if(!cache || cache->ttl <= 0 || numElements < 1)
+        return false;
+
+    rtTime_Now(&now);
+    pthread_mutex_lock(&cache->mutex);
+    for(i = 0; i < numElements && hit; ++i)
+    {
+        rbusDiscoveryEntry_t* entry = rtHashMap_Get(cache->entries, elements[i]);
+        if(!entry)
+        {
+            hit = false;
+        }
+        else if(!entry->component->valid || rtTime_Compare(&now, &entry->expires) >= 0)
+        {
+            rtHashMap_Remove(cache->entries, elements[i]);
+            cache->stats.invalidations++;
+            hit = false;
+        }
+    }
+    if(hit)
+    {
+        *components = rt_malloc(numElements * sizeof(char*));
+        for(i = 0; i < numElements; ++i)
+        {
+            rbusDiscoveryEntry_t* entry = rtHashMap_Get(cache->entries, elements[i]);
+            (*components)[i] = strdup(entry->component->name);
+        }
+        cache->stats.hits++;
+    }
+    else
+    {
+        cache->stats.misses++;
+    }
+    pthread_mutex_unlock(&cache->mutex);
+    return hit;
+}
+
+void rbusDiscoveryCache_Store(rbusDiscoveryCache_t cache, int numElements, char const** elements, char** components)
+{
+    rtTime_t expires;
+    int i;
+
+    if(!cache || cache->ttl <= 0)
+        return;
+
+    rtTime_Later(NULL, cache->ttl, &expires);
+    pthread_mutex_lock(&cache->mutex);
+    if(rtHashMap_GetSize(cache->entries) + numElements > RBUS_DISCOVERYCACHE_MAX ||
+       rtVector_Size(cache->components) > RBUS_DISCOVERYCACHE_MAX)
+    {
+        cache->stats.invalidations += rtHashMap_GetSize(cache->entries);
+        rbusDiscoveryCache_Reset(cache);
+    }
+    for(i = 0; i < numElements; ++i)
+    {
+        rbusDiscoveryEntry_t* entry;
+
+        /*unresolved names and partial paths are not cached*/
+        if(!components[i] || !components[i][0] || elements[i][strlen(elements[i])-1] == '.')
+            continue;
+        entry = rt_malloc(sizeof(rbusDiscoveryEntry_t));
+        entry->component = rbusDiscoveryCache_GetComponent(cache, components[i]);
+        entry->expires = expires;
+        rtHashMap_Set(cache->entries, elements[i], entry);
+    }
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+void rbusDiscoveryCache_RemoveComponent(rbusDiscoveryCache_t cache, char const* component)
+{
+    size_t i;
+    size_t len;
+
+    if(!cache)
+        return;
+    pthread_mutex_lock(&cache->mutex);
+    len = rtVector_Size(cache->components);
+    for(i = 0; i < len; ++i)
+    {
+        rbusDiscoveryComponent_t* entry = rtVector_At(cache->components, i);
+        if(entry->valid && strcmp(entry->name, component) == 0)
+        {
+            RBUSLOG_DEBUG("%s: dropping elements of %s", __FUNCTION__, component);
+            entry->valid = false;
+        }
+    }
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+void rbusDiscoveryCache_Clear(rbusDiscoveryCache_t cache)
+{
+    if(!cache)
+        return;
+    pthread_mutex_lock(&cache->mutex);
+    cache->stats.invalidations += rtHashMap_GetSize(cache->entries);
+    rbusDiscoveryCache_Reset(cache);
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+void rbusDiscoveryCache_GetStats(rbusDiscoveryCache_t cache, rbusDiscoveryCacheStats_t* stats)
+{
+    pthread_mutex_lock(&cache->mutex);
+    *stats = cache->stats;
+    stats->entries = (uint32_t)rtHashMap_GetSize(cache->entries);
+    pthread_mutex_unlock(&cache->mutex);
+}
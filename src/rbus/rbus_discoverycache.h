@@ -0,0 +1,50 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file
+ * the following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef RBUS_DISCOVERYCACHE_H
+#define RBUS_DISCOVERYCACHE_H
+
+#include "rbus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Per-handle cache of element name to component name, as resolved by rtrouted
+    for rbus_getExt and rbus_setMulti. Entries expire after the configured ttl
+    and are dropped when the owning component disconnects.
+*/
+typedef struct _rbusDiscoveryCache* rbusDiscoveryCache_t;
+
+void rbusDiscoveryCache_Create(rbusDiscoveryCache_t* cache, int ttl);
+void rbusDiscoveryCache_Destroy(rbusDiscoveryCache_t cache);
+
+/*on success fills components with one strdup'd name per element, freed by the caller;
+  fails unless every element has a live entry*/
+bool rbusDiscoveryCache_Lookup(rbusDiscoveryCache_t cache, int numElements, char const** elements, char*** components);
+void rbusDiscoveryCache_Store(rbusDiscoveryCache_t cache, int numElements, char const** elements, char** components);
+void rbusDiscoveryCache_RemoveComponent(rbusDiscoveryCache_t cache, char const* component);
+void rbusDiscoveryCache_Clear(rbusDiscoveryCache_t cache);
+void rbusDiscoveryCache_GetStats(rbusDiscoveryCache_t cache, rbusDiscoveryCacheStats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -37,11 +37,15 @@
     RBUSLOG_ERROR("Error %d:%s running command " #CMD, err, strerror(err)); \
   } \
 }
-#define LOCK() ERROR_CHECK(pthread_mutex_lock(&element_mutex))
-#define UNLOCK() ERROR_CHECK(pthread_mutex_unlock(&element_mutex))
+/*lookups only read the tree so they share the lock; anything that links or unlinks nodes takes it exclusively*/
+#define RDLOCK() ERROR_CHECK(pthread_rwlock_rdlock(&element_lock))
+#define WRLOCK() ERROR_CHECK(pthread_rwlock_wrlock(&element_lock))
+#define UNLOCK() ERROR_CHECK(pthread_rwlock_unlock(&element_lock))
+
+#define CHILD_INDEX_MIN 8   /*number of children at which a node starts indexing them by name*/
 
 elementNode* pruneNode = NULL;
-pthread_mutex_t element_mutex;
+pthread_rwlock_t element_lock;
 static int mutex_init = 0;
 
 //****************************** UTILITY FUNCTIONS ***************************//
@@ -56,6 +60,153 @@ char const* getTypeString(rbusElementType_t type)
     default: return "object"; break;
     }
 }
+
+/*copies the next dot separated token of name into token, skipping empty tokens the way strtok_r does.
+  returns where to continue from, or NULL when there are no tokens left.
+  a token too long for the buffer comes back empty so it matches nothing*/
+static char const* nextToken(char const* name, char* token, size_t size)
+{
+    size_t len;
+
+    while(*name == '.')
+        name++;
+    if(*name == 0)
+        return NULL;
+    len = strcspn(name, ".");
+    if(len < size)
+    {
+        memcpy(token, name, len);
+        token[len] = 0;
+    }
+    else
+    {
+        token[0] = 0;
+    }
+    return name + len;
+}
+
+/*childIndex keys are the children's own names, so the index neither copies nor frees them*/
+static const void* childIndexKeyCopy(const void* key)
+{
+    return key;
+}
+
+static void childIndexKeyDestroy(void* key)
+{
+    (void)key;
+}
+
+static elementNode* findChild(elementNode* parent, char const* name)
+{
+    elementNode* child;
+
+    if(parent->childIndex)
+        return (elementNode*)rtHashMap_Get(parent->childIndex, name);
+    for(child = parent->child; child; child = child->nextSibling)
+    {
+        if(strcmp(child->name, name) == 0)
+            return child;
+    }
+    return NULL;
+}
+
+/*token is a row alias in brackets, e.g. "[alias]"*/
+static elementNode* findChildByAlias(elementNode* parent, char const* token)
+{
+    elementNode* child;
+    size_t tlen = strlen(token);
+
+    if(tlen <= 2 || token[0] != '[' || token[tlen-1] != ']')
+        return NULL;
+    for(child = parent->child; child; child = child->nextSibling)
+    {
+        if(child->alias && strlen(child->alias) == tlen-2 && strncmp(child->alias, token+1, tlen-2) == 0)
+        {
+            RBUSLOG_DEBUG("tokenFound by alias %s!", child->alias);
+            return child;
+        }
+    }
+    return NULL;
+}
+
+/*appends node to the end of parent's child list*/
+static void linkChild(elementNode* parent, elementNode* node)
+{
+    elementNode* child;
+
+    node->parent = parent;
+    if(parent->child)
+    {
+        child = parent->child;
+        while(child->nextSibling)
+            child = child->nextSibling;
+        child->nextSibling = node;
+    }
+    else
+    {
+        parent->child = node;
+    }
+    parent->numChildren++;
+
+    if(parent->childIndex)
+    {
+        if(!rtHashMap_Contains(parent->childIndex, node->name))
+            rtHashMap_Set(parent->childIndex, node->name, node);
+    }
+    else if(parent->numChildren >= CHILD_INDEX_MIN)
+    {
+        rtHashMap_CreateEx(&parent->childIndex, 0, NULL, NULL, childIndexKeyCopy, childIndexKeyDestroy, NULL, NULL);
+        for(child = parent->child; child; child = child->nextSibling)
+        {
+            if(!rtHashMap_Contains(parent->childIndex, child->name))
+                rtHashMap_Set(parent->childIndex, child->name, child);
+        }
+    }
+}
+
+static void unlinkChild(elementNode* parent, elementNode* node)
+{
+    elementNode* child;
+
+    if(parent->child == node)
+    {
+        parent->child = node->nextSibling;
+    }
+    else
+    {
+        for(child = parent->child; child; child = child->nextSibling)
+        {
+            if(child->nextSibling == node)
+            {
+                child->nextSibling = node->nextSibling;
+                break;
+            }
+        }
+        if(!child)
+            return;
+    }
+    parent->numChildren--;
+
+    if(parent->childIndex && rtHashMap_Get(parent->childIndex, node->name) == node)
+        rtHashMap_Remove(parent->childIndex, node->name);
+}
+
+static elementNode* createChild(elementNode* parent, char const* name)
+{
+    elementNode* node;
+    char fullName[RBUS_MAX_NAME_LENGTH];
+
+    node = getEmptyElementNode();
+    /*the root's name is the component name, which isn't part of element names*/
+    if(parent->parent && parent->fullName)
+        snprintf(fullName, RBUS_MAX_NAME_LENGTH, "%s.%s", parent->fullName, name);
+    else
+        snprintf(fullName, RBUS_MAX_NAME_LENGTH, "%s", name);
+    node->fullName = strdup(fullName);
+    node->name = strdup(name);
+    linkChild(parent, node);
+    return node;
+}
 //****************************************************************************//
 
 
@@ -86,6 +237,10 @@ static void freeElementRecurse(elementNode* node)
         freeElementRecurse(tmp);
     }
 
+    if (node->childIndex)
+    {
+        rtHashMap_Destroy(node->childIndex);
+    }
     if (node->name)
     {
         free(node->name);
@@ -126,25 +281,13 @@ void freeElementNode(elementNode* node)
 
     if(parent)
     {
-        if(parent->child == node)
-        {
-            parent->child = node->nextSibling;
-        }
-        else
-        {
-            child = parent->child;
-            while(child)
-            {
-                if(child->nextSibling == node)
-                {
-                    child->nextSibling = node->nextSibling;
-                    break;
-                }
-                child = child->nextSibling;
-            }
-        }
+        unlinkChild(parent, node);
     }
 
+    if (node->childIndex)
+    {
+        rtHashMap_Destroy(node->childIndex);
+    }
     if (node->name)
     {
         free(node->name);
@@ -223,21 +366,18 @@ static void replicateAcrossTableRowInstances(elementNode* newNode);
 
 elementNode* insertElement(elementNode* root, rbusDataElement_t* elem)
 {
-    char* token = NULL;
+    char token[RBUS_MAX_NAME_LENGTH];
+    char const* next = NULL;
     char* name = NULL;
-    char* saveptr = NULL;
     elementNode* currentNode = root;
-    elementNode* tempNode = NULL;
-    elementNode* nextNode = NULL;
-    int ret = 0, createChild = 0;
-    char buff[RBUS_MAX_NAME_LENGTH];
-    pthread_mutexattr_t attrib;
+    elementNode* childNode = NULL;
+    pthread_rwlockattr_t attrib;
 
     if(!mutex_init)
     {
-       ERROR_CHECK(pthread_mutexattr_init(&attrib));
-       ERROR_CHECK(pthread_mutexattr_settype(&attrib, PTHREAD_MUTEX_ERRORCHECK));
-       ERROR_CHECK(pthread_mutex_init(&element_mutex, &attrib));
+       ERROR_CHECK(pthread_rwlockattr_init(&attrib));
+       ERROR_CHECK(pthread_rwlock_init(&element_lock, &attrib));
+       ERROR_CHECK(pthread_rwlockattr_destroy(&attrib));
        mutex_init = 1;
     }
 
@@ -245,9 +385,7 @@ elementNode* insertElement(elementNode* root, rbusDataElement_t* elem)
     {
         return NULL;
     }
-    LOCK();
-    nextNode = currentNode->child;
-    createChild = 1;
+    WRLOCK();
 
     RBUSLOG_DEBUG("<%s>: Request to insert element [%s]!!", __FUNCTION__, elem->name);
 
@@ -278,313 +416,133 @@ elementNode* insertElement(elementNode* root, rbusDataElement_t* elem)
         }
     }
 
-    token = strtok_r(name, ".", &saveptr);
-
-    while( token != NULL )
+    next = name;
+    while((next = nextToken(next, token, sizeof(token))) != NULL)
     {
-        if(nextNode == NULL)
+        childNode = findChild(currentNode, token);
+        if(childNode == NULL)
         {
-            if(createChild)
-            {
-                RBUSLOG_DEBUG("Create child [%s]", token);
-                tempNode = getEmptyElementNode();
-                tempNode->parent = currentNode;
-                if(currentNode == root)    
-                {
-                    tempNode->fullName = strdup(token);
-                }
-                else
-                {
-                    snprintf(buff, RBUS_MAX_NAME_LENGTH, "%s.%s", currentNode->fullName, token);
-                    tempNode->fullName = strdup(buff);
-                }
-                tempNode->name = strdup(token);
-                currentNode->child = tempNode;
-                currentNode = tempNode;
-                nextNode = currentNode->child;
-                createChild = 1;
-            }
+            RBUSLOG_DEBUG("Create child [%s]", token);
+            childNode = createChild(currentNode, token);
+            RBUSLOG_DEBUG("Full name [%s]", childNode->fullName);
         }
-        while(nextNode != NULL)
-        {
-            RBUSLOG_DEBUG("child name=[%s], Token = [%s]", nextNode->name, token);
-            if(strcmp(nextNode->name, token) == 0)
-            {
-                currentNode = nextNode;
-                nextNode = currentNode->child;
-                createChild = 1;
-                break;
-            }
-            else
-            {
-                currentNode = nextNode;
-                nextNode = currentNode->nextSibling;
-                createChild = 0;
-                if(nextNode == NULL)
-                {
-                    RBUSLOG_DEBUG("Create Sibling [%s]", token);
-                    tempNode = getEmptyElementNode();
-                    tempNode->parent = currentNode->parent;
-                    if(currentNode->parent->fullName)
-                        snprintf(buff, RBUS_MAX_NAME_LENGTH, "%s.%s", currentNode->parent->fullName, token);
-                    else
-                        snprintf(buff, RBUS_MAX_NAME_LENGTH, "%s", token);
-                    RBUSLOG_DEBUG("Full name [%s]", buff);
-                    tempNode->fullName = strdup(buff);
-                    tempNode->name = strdup(token);
-                    currentNode->nextSibling = tempNode;
-                    currentNode = tempNode;
-                    createChild = 1;
-                }
-            }
-        }
-        token = strtok_r(NULL, ".", &saveptr);
+        currentNode = childNode;
     }
-    if(ret == 0)
+
+    currentNode->type = elem->type;
+    currentNode->cbTable = elem->cbTable;
+
+    /* See the big comment near the top of this function.
+       We add {i} as a child object of the table.
+       This will be the row template used to instantiate rows from.
+       Its presumed a provider will register more elements under this, such as
+        Device.WiFi.AccessPoint.{i}.Foo etc,...
+     */
+    if(elem->type == RBUS_ELEMENT_TYPE_TABLE && findChild(currentNode, "{i}") == NULL)
     {
-        currentNode->type = elem->type;
-        currentNode->cbTable = elem->cbTable;
-
-        /* See the big comment near the top of this function.
-           We add {i} as a child object of the table.
-           This will be the row template used to instantiate rows from.
-           Its presumed a provider will register more elements under this, such as
-            Device.WiFi.AccessPoint.{i}.Foo etc,...
-         */
-        if(elem->type == RBUS_ELEMENT_TYPE_TABLE)
-        {
-            elementNode* rowTemplate = getEmptyElementNode();
-            rowTemplate->parent = currentNode;
-            rowTemplate->name = strdup("{i}");
-            snprintf(buff, RBUS_MAX_NAME_LENGTH, "%s.%s", currentNode->fullName, rowTemplate->name);
-            rowTemplate->fullName = strdup(buff);
-            currentNode->child = rowTemplate;
-        }
+        createChild(currentNode, "{i}");
     }
     free(name);
     UNLOCK();
 
-    if(ret == 0)
-    {
-        replicateAcrossTableRowInstances(currentNode);
+    replicateAcrossTableRowInstances(currentNode);
 
-        return currentNode;
-    }
-    else
-    {
-        return NULL;
-    }
+    return currentNode;
 }
 
 elementNode* retrieveElement(elementNode* root, const char* elmentName)
 {
-    char* token = NULL;
-    char* name = NULL;
-    char* saveptr = NULL;
+    char token[RBUS_MAX_NAME_LENGTH];
+    char const* next = elmentName;
     elementNode* currentNode = root;
-    elementNode* nextNode = NULL;
-    int tokenFound = 0;
+    elementNode* childNode = NULL;
 
-    LOCK();
     RBUSLOG_DEBUG("<%s>: Request to retrieve element [%s]", __FUNCTION__, elmentName);
-    if(currentNode == NULL)
+    if(currentNode == NULL || elmentName == NULL)
     {
         return NULL;
     }
 
-    name = strdup(elmentName);
-
-    nextNode = currentNode->child;
-
+    RDLOCK();
     /*TODO if name is a table row with an alias containing a dot, this will break (e.g. "Foo.[alias.1]")*/
-    token = strtok_r(name, ".", &saveptr);
-    while( token != NULL)
+    while((next = nextToken(next, token, sizeof(token))) != NULL)
     {
         RBUSLOG_DEBUG("Token = [%s]", token);
-        tokenFound = 0;
-        if(nextNode == NULL)
-        {
-            break;
-        }
 
-        RBUSLOG_DEBUG("child name=[%s], Token = [%s]", nextNode->name, token);
-        /*
-        if(nextNode->type == RBUS_ELEMENT_TYPE_TABLE)
-        {
-            assert(strcmp(nextNode->name, "{i}") == 0);
-            tokenFound = 1;
-            currentNode = nextNode;
-            nextNode = currentNode->child;
-        }
-        else*/
-        if(strcmp(nextNode->name, token) == 0)
-        {
-            RBUSLOG_DEBUG("tokenFound!");
-            tokenFound = 1;
-            currentNode = nextNode;
-            nextNode = currentNode->child;
-        }
+        /* retrieveElement should only return regististration elements, not table row instantiated elements */
+        if(currentNode->type == RBUS_ELEMENT_TYPE_TABLE)
+            childNode = findChild(currentNode, "{i}");
         else
-        {
-            currentNode = nextNode;
-            nextNode = currentNode->nextSibling;
-
-            while(nextNode != NULL)
-            {
-                RBUSLOG_DEBUG("child name=[%s], Token = [%s]", nextNode->name, token);
-                if(strcmp(nextNode->name, token) == 0)
-                {
-                    RBUSLOG_DEBUG("tokenFound!");
-                    tokenFound = 1;
-                    currentNode = nextNode;
-                    nextNode = currentNode->child;
-                    break;
-                }
-                else
-                {
-                    currentNode = nextNode;
-                    nextNode = currentNode->nextSibling;
-                }
-            }
-        }
-
-        token = strtok_r(NULL, ".", &saveptr);
-
-        if(token && nextNode && nextNode->parent && nextNode->parent->type == RBUS_ELEMENT_TYPE_TABLE)
-        {
-            /* retrieveElement should only return regististration elements, not table row instantiated elements */
-            token = "{i}";
-        }
-    }
+            childNode = findChild(currentNode, token);
 
-    free(name);
-    UNLOCK();
-
-    if(tokenFound)
-    {
-        RBUSLOG_DEBUG("Found Element with param name [%s]", currentNode->name);
-        return currentNode;
+        if(childNode == NULL)
+            break;
+        currentNode = childNode;
     }
-    else
+    if(childNode)
     {
-        return NULL;
+        RBUSLOG_DEBUG("Found Element with param name [%s]", childNode->name);
     }
+    UNLOCK();
+
+    return childNode;
 }
 
 elementNode* retrieveInstanceElement(elementNode* root, const char* elmentName)
 {
-    char* token = NULL;
-    char* name = NULL;
-    char* saveptr = NULL;
+    char token[RBUS_MAX_NAME_LENGTH];
+    char const* next = elmentName;
     elementNode* currentNode = root;
-    elementNode* nextNode = NULL;
-    int tokenFound = 0;
+    elementNode* childNode = NULL;
     bool isWildcard = false;
 
     RBUSLOG_DEBUG("<%s>: Request to retrieve element [%s]", __FUNCTION__, elmentName);
-    LOCK();
-    if(currentNode == NULL)
+    if(currentNode == NULL || elmentName == NULL)
     {
         return NULL;
     }
 
-    name = strdup(elmentName);
-
-    nextNode = currentNode->child;
-
+    RDLOCK();
     /*TODO if name is a table row with an alias containing a dot, this will break (e.g. "Foo.[alias.1]")*/
-    token = strtok_r(name, ".", &saveptr);
-    while( token != NULL)
+    while((next = nextToken(next, token, sizeof(token))) != NULL)
     {
         RBUSLOG_DEBUG("Token = [%s]", token);
-        tokenFound = 0;
-
-        if(nextNode == NULL)
-        {
-            break;
-        }
 
-        RBUSLOG_DEBUG("child name=[%s], Token = [%s]", nextNode->name, token);
-
-        if(strcmp(nextNode->name, token) == 0)
-        {
-            RBUSLOG_DEBUG("tokenFound!");
-            tokenFound = 1;
-            currentNode = nextNode;
-            nextNode = currentNode->child;
-        }
-        else
-        {
-            currentNode = nextNode;
-            nextNode = currentNode->nextSibling;
-
-            while(nextNode != NULL)
-            {
-                RBUSLOG_DEBUG("child name=[%s], Token = [%s]", nextNode->name, token);
-                if(strcmp(nextNode->name, token) == 0)
-                {
-                    RBUSLOG_DEBUG("tokenFound!");
-                    tokenFound = 1;
-                    currentNode = nextNode;
-                    nextNode = currentNode->child;
-                    break;
-                }
-                else
-                {
-                    /*check the alias if its a table row*/
-                    if(nextNode->parent->type == RBUS_ELEMENT_TYPE_TABLE)
-                    {
-                        if(nextNode->alias)
-                        {
-                            size_t tlen = strlen(token);
-                            if(tlen > 2 && token[0] == '[' && token[tlen-1] == ']')
-                            {
-                                if(strlen(nextNode->alias) == tlen-2 && strncmp(nextNode->alias, token+1, tlen-2) == 0)
-                                {
-                                    RBUSLOG_DEBUG("tokenFound by alias %s!", nextNode->alias);
-                                    tokenFound = 1;
-                                    currentNode = nextNode;
-                                    nextNode = currentNode->child;
-                                    break;
-                                }
-                            }
-                        }
-                    }
-
-                    currentNode = nextNode;
-                    nextNode = currentNode->nextSibling;
-                }
-            }
-        }
-
-        token = strtok_r(NULL, ".", &saveptr);
-
-        if(token && nextNode && nextNode->parent && nextNode->parent->type == RBUS_ELEMENT_TYPE_TABLE) 
+        if(currentNode->type == RBUS_ELEMENT_TYPE_TABLE)
         {
             if(!isWildcard && !strcmp(token,"*"))
                 isWildcard = true;
-            
+
             /* retrieveInstanceElement should return only the registration element if the table has a getHandler installed (used by MtaAgent/TR104)
                 of if wildcard query */
-            if(isWildcard || nextNode->parent->cbTable.getHandler)
+            if(isWildcard || currentNode->cbTable.getHandler)
             {
-                token = "{i}";
+                childNode = findChild(currentNode, "{i}");
             }
-        }        
-    }
-
-    free(name);
-    UNLOCK();
+            else
+            {
+                childNode = findChild(currentNode, token);
+                /*check the alias if its a table row*/
+                if(childNode == NULL)
+                    childNode = findChildByAlias(currentNode, token);
+            }
+        }
+        else
+        {
+            childNode = findChild(currentNode, token);
+        }
 
-    if(tokenFound)
-    {
-        RBUSLOG_DEBUG("Found Element with param name [%s]", currentNode->name);
-        return currentNode;
+        if(childNode == NULL)
+            break;
+        currentNode = childNode;
     }
-    else
+    if(childNode)
     {
-        return NULL;
+        RBUSLOG_DEBUG("Found Element with param name [%s]", childNode->name);
     }
+    UNLOCK();
+
+    return childNode;
 }
 
 static void removeElementInternal(elementNode* rowNode, elementNode** chain, int numChain)
@@ -632,56 +590,40 @@ static void removeElementInternal(elementNode* rowNode, elementNode** chain, int
             }
 
             /* remove the matching node (either the template or a specific row (if not template)*/
-            childNode = currentNode->child;
-            
-            while(childNode)
+            childNode = findChild(currentNode, chainNode->name);
+            if(childNode)
             {
-                if(strcmp(childNode->name, chainNode->name) == 0)
+                if(numChain-i-1 > 0)
                 {
-                    if(numChain-i-1 > 0)
-                    {
-                        removeElementInternal(childNode, &chain[i+1], numChain-i-1);
-                    }
-                    else
-                    {
-                        freeElementNode(childNode);
-                    }
-                    break;
+                    removeElementInternal(childNode, &chain[i+1], numChain-i-1);
+                }
+                else
+                {
+                    freeElementNode(childNode);
                 }
-                childNode = childNode->nextSibling;
             }
             break;
         }
         else
         {
             /*search for node in children*/
-            elementNode* childNode = currentNode->child;
+            childNode = findChild(currentNode, chainNode->name);
 
-            while(childNode)
+            if(!childNode)
             {
-                if(strcmp(childNode->name, chainNode->name) == 0)
-                {
-                    if(i == numChain-1)
-                    {
-                        freeElementNode(childNode);
-                        return;
-                    }
-                    else
-                    {
-                        /*go deeper*/
-                        currentNode = childNode;
-                        i++;
-                    }
-                    break;
-                }
-                childNode = childNode->nextSibling;
+                RBUSLOG_INFO("Couldn't find node %s\n", chainNode->fullName);
+                return;
             }
 
-            if(!childNode)
+            if(i == numChain-1)
             {
-                RBUSLOG_INFO("Couldn't find node %s\n", chainNode->fullName);
+                freeElementNode(childNode);
                 return;
             }
+
+            /*go deeper*/
+            currentNode = childNode;
+            i++;
         }
     }
 }
@@ -692,7 +634,7 @@ void removeElement(elementNode* element)
     int numChain = 0;
     VERIFY_NULL(element);
     RBUSLOG_DEBUG("removeElement %s\n", element->fullName);
-    LOCK();
+    WRLOCK();
     createElementChain(element, &chain, &numChain);
     if(numChain > 1)
         removeElementInternal(chain[0], &chain[1], numChain-1);
@@ -905,20 +847,9 @@ static elementNode* duplicateNode(elementNode* sourceNode, elementNode* parentNo
     node->name = strdup(name);
     node->type = sourceNode->type;
     node->cbTable = sourceNode->cbTable;
-    node->parent = parentNode;
 
     /*add new node to the parent's child list*/
-    if(parentNode->child)
-    {
-        child = parentNode->child;
-        while(child->nextSibling)
-            child = child->nextSibling;
-        child->nextSibling = node;
-    }
-    else
-    {
-        parentNode->child = node;
-    }
+    linkChild(parentNode, node);
 
     /*duplicate children of sourceNode*/
     child = sourceNode->child;
@@ -968,7 +899,7 @@ elementNode* instantiateTableRow(elementNode* tableNode, uint32_t instNum, char
     if(!tableNode)
         return NULL;
 
-    LOCK();
+    WRLOCK();
 #if DEBUG_ELEMENTS
     RBUSLOG_INFO("%s: table=%s instNum=%u alias=%s", __FUNCTION__, tableNode->fullName, instNum, alias);
     printElement(tableNode, 0);
@@ -987,18 +918,13 @@ elementNode* instantiateTableRow(elementNode* tableNode, uint32_t instNum, char
 
     /*find the row template which has name="{i}"*/
 
-    rowTemplate = tableNode->child;
-    while(rowTemplate)
-    {
-        if(strcmp(rowTemplate->name, "{i}") == 0)
-            break;
-        rowTemplate = rowTemplate->nextSibling;
-    }
+    rowTemplate = findChild(tableNode, "{i}");
 
     if(!rowTemplate)
     {
         assert(false);
         RBUSLOG_ERROR("%s ERROR: row template not found for table %s", __FUNCTION__, tableNode->fullName);
+        UNLOCK();
         return NULL;
     }
 
@@ -1029,7 +955,7 @@ elementNode* instantiateTableRow(elementNode* tableNode, uint32_t instNum, char
 void deleteTableRow(elementNode* rowNode)
 {
     VERIFY_NULL(rowNode);
-    LOCK();
+    WRLOCK();
     elementNode* parent = rowNode->parent;
     
     if(!parent)
@@ -1098,19 +1024,7 @@ void replicateAcrossTableRowInstancesInternal(elementNode* rowNode, elementNode*
         else
         {
             /*search for node in children*/
-            elementNode* childNode = currentNode->child;
-
-            while(childNode)
-            {
-                if(strcmp(childNode->name, chain[i]->name) == 0)
-                {
-                    break;
-                }
-                else
-                {
-                    childNode = childNode->nextSibling;
-                }
-            }
+            elementNode* childNode = findChild(currentNode, chain[i]->name);
 
             if(childNode)
             {
@@ -1133,7 +1047,7 @@ void replicateAcrossTableRowInstances(elementNode* newNode)
     int numChain = 0;
     int i = 0;
 
-    LOCK();
+    WRLOCK();
     createElementChain(newNode, &chain, &numChain);
 
     for(i = 0; i < numChain; ++i)
@@ -1177,7 +1091,7 @@ void rbusElement_mutex_destroy(void)
 {
     if(mutex_init)
     {
-      ERROR_CHECK(pthread_mutex_destroy(&element_mutex));
+      ERROR_CHECK(pthread_rwlock_destroy(&element_lock));
       mutex_init = 0;
     }
 }
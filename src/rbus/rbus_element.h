@@ -24,6 +24,7 @@
 #include <rbus.h>
 #include <rtList.h>
 #include <rtVector.h>
+#include <rtHashMap.h>
 #include <rtTime.h>
 #include "rbus_log.h"
 #include <pthread.h>
@@ -64,6 +65,8 @@ typedef struct elementNode
     elementNode*            parent;         /* Up */
     elementNode*            child;          /* Downward */
     elementNode*            nextSibling;    /* Right */
+    rtHashMap               childIndex;     /* Children by name, created once there are enough of them */
+    uint32_t                numChildren;    /* Length of the child/nextSibling list */
     elementNode*            nextPrune;
     rbusElementType_t       type;           /* Type w/ Object=0 */
     rbusCallbackTable_t     cbTable;        /* Callback table for the element */
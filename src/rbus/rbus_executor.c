@@ -0,0 +1,192 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file
+ * the following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "rbus_executor.h"
+#include "rbus_config.h"
+#include "rbus_log.h"
+#include <rtThreadPool.h>
+#include <rtMemory.h>
+#include <rtTime.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ERROR_CHECK(CMD) \
+{ \
+  int err; \
+  if((err=CMD) != 0) \
+  { \
+    RBUSLOG_ERROR("Error %d:%s running command " #CMD, err, strerror(err)); \
+  } \
+}
+
+#define EXECUTOR_THREAD_EXPIRE 30 /*seconds an idle worker is kept before it exits*/
+
+typedef struct _rbusExecutor rbusExecutor_t;
+
+typedef struct _rbusExecutorTask
+{
+    rbusExecutor_t* executor;
+    rbusExecutorFunc_t func;
+    void* userData;
+    rtTime_t queued;
+} rbusExecutorTask_t;
+
+struct _rbusExecutor
+{
+    rtThreadPool pool;
+    int queueDepth;
+    pthread_cond_t notFull;
+    uint64_t latencyTotal;      /*microseconds tasks spent queued, summed over tasksRun*/
+    rbusExecutorStats_t stats;
+};
+
+static pthread_mutex_t gMutex = PTHREAD_MUTEX_INITIALIZER;
+static rbusExecutor_t* gExecutor = NULL;
+static __thread bool sOnExecutor = false;
+
+static void rbusExecutor_Create()
+{
+    pthread_condattr_t cattrib;
+    int threads = rbusConfig_Get()->executorThreads;
+
+    gExecutor = rt_calloc(1, sizeof(rbusExecutor_t));
+    gExecutor->queueDepth = rbusConfig_Get()->executorQueueDepth > 0 ? rbusConfig_Get()->executorQueueDepth : 1;
+    gExecutor->stats.threads = threads > 0 ? threads : 1;
+
+    ERROR_CHECK(pthread_condattr_init(&cattrib));
+    ERROR_CHECK(pthread_condattr_setclock(&cattrib, CLOCK_MONOTONIC));
+    ERROR_CHECK(pthread_cond_init(&gExecutor->notFull, &cattrib));
+    ERROR_CHECK(pthread_condattr_destroy(&cattrib));
+
+    rtThreadPool_Create(&gExecutor->pool, gExecutor->stats.threads, 0, EXECUTOR_THREAD_EXPIRE);
+    RBUSLOG_DEBUG("%s: threads=%u queue=%d", __FUNCTION__, gExecutor->stats.threads, gExecutor->queueDepth);
+}
+
+static void rbusExecutor_TaskFunc(void* p)
+{
+    rbusExecutorTask_t* task = p;
+    rbusExecutor_t* executor = task->executor;
+    rtTime_t now;
+    uint32_t latency;
+
+    rtTime_Now(&now);
+    latency = (uint32_t)((now.tv_sec - task->queued.tv_sec) * 1000000 + (now.tv_nsec - task->queued.tv_nsec) / 1000);
+
+    ERROR_CHECK(pthread_mutex_lock(&gMutex));
+    executor->stats.queueLength--;
+    executor->stats.tasksRun++;
+    executor->latencyTotal += latency;
+    if(latency > executor->stats.latencyMax)
+        executor->stats.latencyMax = latency;
+    ERROR_CHECK(pthread_cond_signal(&executor->notFull));
+    ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+
+    sOnExecutor = true;
+    task->func(task->userData);
+    sOnExecutor = false;
+    free(task);
+}
+
+rbusError_t rbusExecutor_Run(rbusExecutorFunc_t func, void* userData, bool wait)
+{
+    rbusExecutorTask_t* task;
+    rtError rc;
+
+    ERROR_CHECK(pthread_mutex_lock(&gMutex));
+    if(!gExecutor)
+        rbusExecutor_Create();
+
+    /*a task queueing more work must not wait on the queue it is holding up, it goes over the limit instead*/
+    while(wait && !sOnExecutor && gExecutor->stats.queueLength >= (uint32_t)gExecutor->queueDepth)
+        ERROR_CHECK(pthread_cond_wait(&gExecutor->notFull, &gMutex));
+
+    if(!wait && gExecutor->stats.queueLength >= (uint32_t)gExecutor->queueDepth)
+    {
+        gExecutor->stats.tasksRejected++;
+        RBUSLOG_WARN("%s: queue full (%d tasks)", __FUNCTION__, gExecutor->queueDepth);
+        ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+        return RBUS_ERROR_OUT_OF_RESOURCES;
+    }
+
+    task = rt_malloc(sizeof(rbusExecutorTask_t));
+    task->executor = gExecutor;
+    task->func = func;
+    task->userData = userData;
+    rtTime_Now(&task->queued);
+
+    gExecutor->stats.queueLength++;
+    if(gExecutor->stats.queueLength > gExecutor->stats.queueLengthMax)
+        gExecutor->stats.queueLengthMax = gExecutor->stats.queueLength;
+
+    rc = rtThreadPool_RunTask(gExecutor->pool, rbusExecutor_TaskFunc, task);
+    if(rc != RT_OK && rc != RT_ERROR_THREADPOOL_TASK_PENDING)
+    {
+        gExecutor->stats.queueLength--;
+        gExecutor->stats.tasksRejected++;
+        ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+        RBUSLOG_ERROR("%s: rtThreadPool_RunTask failed %d", __FUNCTION__, rc);
+        free(task);
+        return RBUS_ERROR_OUT_OF_RESOURCES;
+    }
+    ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+    return RBUS_ERROR_SUCCESS;
+}
+
+void rbusExecutor_Destroy()
+{
+    rbusExecutor_t* executor;
+
+    ERROR_CHECK(pthread_mutex_lock(&gMutex));
+    executor = gExecutor;
+    gExecutor = NULL;
+    ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+
+    if(!executor)
+        return;
+
+    /*let queued work finish, it holds references to handles being closed; from inside a task
+      we can't wait for ourselves so the pool and executor are left to wind down on their own*/
+    if(sOnExecutor)
+    {
+        rtThreadPool_Destroy(executor->pool, 0);
+        return;
+    }
+    rtThreadPool_Destroy(executor->pool, -1);
+    ERROR_CHECK(pthread_cond_destroy(&executor->notFull));
+    free(executor);
+}
+
+rbusError_t rbus_getExecutorStats(rbusExecutorStats_t* stats)
+{
+    if(!stats)
+        return RBUS_ERROR_INVALID_INPUT;
+
+    ERROR_CHECK(pthread_mutex_lock(&gMutex));
+    if(gExecutor)
+    {
+        *stats = gExecutor->stats;
+        stats->latencyAvg = gExecutor->stats.tasksRun ? (uint32_t)(gExecutor->latencyTotal / gExecutor->stats.tasksRun) : 0;
+    }
+    else
+    {
+        memset(stats, 0, sizeof(rbusExecutorStats_t));
+    }
+    ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+    return RBUS_ERROR_SUCCESS;
+}
@@ -0,0 +1,45 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file
+ * the following copyright and licenses apply:
+ *
+ * Copyright 2016 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef RBUS_EXECUTOR_H
+#define RBUS_EXECUTOR_H
+
+#include "rbus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Process-wide bounded executor for work rbus does in the background
+    (async method calls, async subscribe retries, interval publishing).
+    Runs on an rtThreadPool of RBUS_EXECUTOR_THREADS threads and queues at most
+    RBUS_EXECUTOR_QUEUE tasks.  Created on first use, destroyed by the last rbus_close.
+*/
+typedef void (*rbusExecutorFunc_t)(void* userData);
+
+/*queue func to run on the executor. when the queue is full, block until there is room
+  if wait is true, else fail with RBUS_ERROR_OUT_OF_RESOURCES*/
+rbusError_t rbusExecutor_Run(rbusExecutorFunc_t func, void* userData, bool wait);
+void rbusExecutor_Destroy();
+
+#ifdef __cplusplus
+}
+#endif
+#endif
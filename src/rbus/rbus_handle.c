@@ -61,7 +61,22 @@ void rbusHandleList_ClientDisconnect(char const* clientListener)
 {
     size_t i;
     size_t len;
+    char component[RTMSG_HEADER_MAX_TOPIC_LENGTH] = {0};
+    char const* inbox;
     VERIFY_NULL(clientListener,return);
+
+    /*listeners are "<component>.<process>.INBOX.<pid>"; the component named the connection
+      and is the name element discovery resolved to*/
+    inbox = strstr(clientListener, ".INBOX.");
+    if(inbox)
+    {
+        char const* process = inbox;
+        while(process > clientListener && *(process - 1) != '.')
+            process--;
+        if(process > clientListener && (size_t)(process - 1 - clientListener) < sizeof(component))
+            memcpy(component, clientListener, process - 1 - clientListener);
+    }
+
     if(gHandleList)/*this could theoretically be null if advisory event comes in between the time rbus_close calls 
                   rbusHandleList_Remove and rbus_unregisterClientDisconnectHandler*/
     {
@@ -69,6 +84,8 @@ void rbusHandleList_ClientDisconnect(char const* clientListener)
         for(i = 0; i < len; i++)
         {
             struct _rbusHandle* handle = (struct _rbusHandle*)rtVector_At(gHandleList, i);
+            if(handle->discoveryCache && component[0])
+                rbusDiscoveryCache_RemoveComponent(handle->discoveryCache, component);
             if(handle->subscriptions)
             {
                 /*assuming this doesn't reenter this api which could possibly deadlock*/
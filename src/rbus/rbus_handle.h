@@ -21,8 +21,11 @@
 
 #include "rbus_element.h"
 #include "rbus_subscriptions.h"
+#include "rbus_discoverycache.h"
 #include <rtConnection.h>
 #include <rtVector.h>
+#include <rtHashMap.h>
+#include <pthread.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,14 +56,20 @@ struct _rbusHandle
   int32_t               componentId;
   elementNode*          elementRoot;
 
-  /* consumer side subscriptions FIXME - 
-    this needs to be an associative map instead of list/vector*/
+  /* consumer side subscriptions, in subscribe order, and indexed by
+    eventName, filter, interval and duration for event dispatch.
+    eventSubsMutex guards both */
   rtVector              eventSubs; 
+  rtHashMap             eventSubsIndex;
+  pthread_mutex_t       eventSubsMutex;
 
   /* provider side subscriptions */
   rbusSubscriptions_t   subscriptions; 
 
   rtVector              messageCallbacks;
+
+  /* consumer side element to component resolutions for rbus_getExt and rbus_setMulti */
+  rbusDiscoveryCache_t  discoveryCache;
   rtConnection          m_connection;
   rbusHandleType_t      m_handleType;
 };
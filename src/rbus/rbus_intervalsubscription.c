@@ -17,9 +17,20 @@
  * limitations under the License.
 */
 
+/*
+    Interval subscriptions:
+    A single scheduler thread keeps every interval subscription in a min-heap ordered by the time its next
+    event is due.  When subscriptions come due they are grouped by listener and each group is published by
+    one task on the rbus executor, so a slow getHandler doesn't hold up other listeners and the number of
+    threads doesn't grow with the number of subscriptions.
+    A new subscription joins the phase of an existing one with the same listener and interval so their
+    events go out together.  How late each publish starts is tracked and the worst case is logged.
+*/
+
 #define _GNU_SOURCE 1 //needed for pthread_mutexattr_settype
 #include "rbus_intervalsubscription.h"
 #include "rbus_config.h"
+#include "rbus_executor.h"
 #include "rbus_handle.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -42,38 +53,65 @@
   } \
 }
 #define VERIFY_NULL(T)      if(NULL == T){ return; }
+#define LOCK() ERROR_CHECK(pthread_mutex_lock(&gMutex))
+#define UNLOCK() ERROR_CHECK(pthread_mutex_unlock(&gMutex))
+
+#define INTERVAL_JITTER_WARN 100    /*log when a publish starts this many miliseconds late or more*/
+#define INTERVAL_BATCH_MAX 32       /*split a listener's due events into tasks of at most this many*/
 
 rtVector gRecord = NULL;
 static pthread_mutex_t gMutex = PTHREAD_MUTEX_INITIALIZER;
 typedef struct sRecord
 {
-    int running;
-    pthread_mutex_t  mutex;
-    pthread_t        thread;
-    pthread_cond_t   cond;
     rbusHandle_t     handle;
     elementNode const* node;
-    rbusProperty_t   property;
     rbusSubscription_t* sub;
+    rtTime_t         nextDue;   /*when the next event should be published*/
+    int              heapIndex; /*position in the scheduler heap, -1 while being published*/
+    int              count;     /*events published so far*/
+    bool             busy;      /*an executor task is publishing it*/
+    bool             complete;  /*the duration complete event was sent*/
+    bool             removed;
+    int              jitterMax; /*latest start of a publish in miliseconds*/
 } sRecord;
 
-void rbusEventData_appendToMessage(rbusEvent_t* event, rbusFilter_t filter, int32_t interval, int32_t duration, int32_t componentId, rbusMessage msg);
+typedef struct sScheduler
+{
+    int              running;
+    pthread_t        thread;
+    pthread_cond_t   cond;      /*wakes the scheduler when the heap changes*/
+    pthread_cond_t   idle;      /*broadcast when a publish task finishes*/
+    sRecord**        heap;
+    size_t           heapSize;
+    size_t           heapCapacity;
+    int              jitterMax;
+    int              jitterLogged; /*jitterMax when last logged*/
+} sScheduler;
+
+static sScheduler* gSched = NULL;
+
+void rbusEventData_appendToMessage(rbusEvent_t* event, rbusFilter_t filter, int32_t interval, int32_t duration, int32_t componentId, bool tlv, rbusMessage msg);
 extern rbusError_t get_recursive_wildcard_handler (rbusHandle_t handle, char const *parameterName, const char* pRequestingComp, rbusProperty_t properties, int *pCount);
-static void init_thread(sRecord* sub_rec)
+
+static void* SchedulerThreadFunc(void* data);
+
+static void init_scheduler()
 {
-    pthread_mutexattr_t attrib;
     pthread_condattr_t cattrib;
 
-    sub_rec->running = 0;
+    if(gSched)
+        return;
 
-    ERROR_CHECK(pthread_mutexattr_init(&attrib));
-    ERROR_CHECK(pthread_mutexattr_settype(&attrib, PTHREAD_MUTEX_ERRORCHECK));
-    ERROR_CHECK(pthread_mutex_init(&sub_rec->mutex, &attrib));
+    gSched = rt_calloc(1, sizeof(sScheduler));
 
     ERROR_CHECK(pthread_condattr_init(&cattrib));
     ERROR_CHECK(pthread_condattr_setclock(&cattrib, CLOCK_MONOTONIC));
-    ERROR_CHECK(pthread_cond_init(&sub_rec->cond, &cattrib));
+    ERROR_CHECK(pthread_cond_init(&gSched->cond, &cattrib));
+    ERROR_CHECK(pthread_cond_init(&gSched->idle, &cattrib));
     ERROR_CHECK(pthread_condattr_destroy(&cattrib));
+
+    gSched->running = 1;
+    pthread_create(&gSched->thread, NULL, SchedulerThreadFunc, NULL);
 }
 
 static void sub_Free(void* p)
@@ -81,9 +119,11 @@ static void sub_Free(void* p)
     sRecord* rec = (sRecord*)p;
     if(rec)
     {
-        ERROR_CHECK(pthread_mutex_destroy(&rec->mutex));
-        ERROR_CHECK(pthread_cond_destroy(&rec->cond));
-        rbusProperty_Release(rec->property);
+        if(rec->count)
+        {
+            RBUSLOG_INFO("%s: %s for %s published %d events, worst jitter %d ms", __FUNCTION__,
+                rec->sub ? rec->sub->eventName : "", rec->sub ? rec->sub->listener : "", rec->count, rec->jitterMax);
+        }
         rec->sub = NULL;
         free(rec);
     }
@@ -102,121 +142,274 @@ static sRecord* sub_find(rbusSubscription_t* sub)
     return NULL;
 }
 
-/* Publishing event based on subscriber interval */
-static void* PublishingThreadFunc(void* rec)
+/*min-heap of records ordered by nextDue; callers hold gMutex*/
+static void heap_swap(size_t a, size_t b)
 {
-    RBUSLOG_DEBUG("\n %s: start\n", __FUNCTION__);
-    struct sRecord *sub_rec = (struct sRecord*)rec;
-    int count = 0;
-    int duration_count = 0;
+    sRecord* tmp = gSched->heap[a];
+    gSched->heap[a] = gSched->heap[b];
+    gSched->heap[b] = tmp;
+    gSched->heap[a]->heapIndex = (int)a;
+    gSched->heap[b]->heapIndex = (int)b;
+}
+
+static void heap_siftUp(size_t i)
+{
+    while(i > 0)
+    {
+        size_t parent = (i - 1) / 2;
+        if(rtTime_Compare(&gSched->heap[i]->nextDue, &gSched->heap[parent]->nextDue) >= 0)
+            break;
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+static void heap_siftDown(size_t i)
+{
+    for(;;)
+    {
+        size_t child = 2 * i + 1;
+        if(child >= gSched->heapSize)
+            break;
+        if(child + 1 < gSched->heapSize &&
+           rtTime_Compare(&gSched->heap[child + 1]->nextDue, &gSched->heap[child]->nextDue) < 0)
+            child++;
+        if(rtTime_Compare(&gSched->heap[child]->nextDue, &gSched->heap[i]->nextDue) >= 0)
+            break;
+        heap_swap(i, child);
+        i = child;
+    }
+}
+
+static void heap_push(sRecord* rec)
+{
+    if(gSched->heapSize == gSched->heapCapacity)
+    {
+        gSched->heapCapacity = gSched->heapCapacity ? gSched->heapCapacity * 2 : 16;
+        gSched->heap = rt_realloc(gSched->heap, gSched->heapCapacity * sizeof(sRecord*));
+    }
+    rec->heapIndex = (int)gSched->heapSize;
+    gSched->heap[gSched->heapSize++] = rec;
+    heap_siftUp(rec->heapIndex);
+    ERROR_CHECK(pthread_cond_signal(&gSched->cond));
+}
+
+static void heap_remove(sRecord* rec)
+{
+    size_t i = (size_t)rec->heapIndex;
+    if(rec->heapIndex < 0)
+        return;
+    rec->heapIndex = -1;
+    if(i != --gSched->heapSize)
+    {
+        gSched->heap[i] = gSched->heap[gSched->heapSize];
+        gSched->heap[i]->heapIndex = (int)i;
+        heap_siftDown(i);
+        heap_siftUp(i);
+    }
+}
+
+/* Get the values and publish one event; returns true when the subscription's duration is complete */
+static bool PublishEvent(sRecord* sub_rec)
+{
+    int actualCount = 0;
+    int result = 0;
+    char *tmpptr = NULL;
     bool duration_complete = false;
     rbusCoreError_t error;
     rbusSubscription_t* sub = sub_rec->sub;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)sub_rec->handle;
-    ERROR_CHECK(pthread_mutex_lock(&sub_rec->mutex));
-    while(sub_rec->running)
+
+    rbusProperty_t properties = NULL;
+    rbusObject_t data;
+    rbusObject_Init(&data, NULL);
+    rbusProperty_Init(&properties, "numberOfEntries", NULL);
+    result = get_recursive_wildcard_handler(handleInfo, sub->eventName,
+            "IntervalThread", properties, &actualCount);
+    rbusProperty_SetInt32(properties, actualCount);
+    tmpptr = strchr(sub->eventName, '*');
+    if (tmpptr)
     {
-        int err;
-        int actualCount = 0;
-        int result = 0;
-        char *tmpptr = NULL;
-        rtTime_t timeout;
-        rtTimespec_t ts;
-        rtTime_Later(NULL, (sub->interval*1000), &timeout);
-        err = pthread_cond_timedwait(&sub_rec->cond,
-                &sub_rec->mutex,
-                rtTime_ToTimespec(&timeout, &ts));
+        rbusObject_SetProperty(data, properties);
+    }
+    else
+    {
+        rbusObject_SetProperty(data, rbusProperty_GetNext(properties)); /*"numberOfEntries" property not requried for normal event*/
+    }
+    rbusProperty_Release(properties);
+    if(result != RBUS_ERROR_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s: failed to get details of %s", __FUNCTION__, sub->eventName);
+        rbusObject_Release(data);
+        return false;
+    }
 
-        if(err != 0 && err != ETIMEDOUT)
+    rbusEvent_t event = {0};
+    event.name = sub->eventName;
+    event.data = data;
+    event.type = RBUS_EVENT_INTERVAL;
+    /* Handling subscription with duration */
+    if (sub->duration != 0)
+    {
+        int duration_count = sub->duration/sub->interval;
+        if (sub_rec->count >= duration_count)
         {
-            RBUSLOG_ERROR("Error %d:%s running command pthread_cond_timedwait", err, strerror(err));
+            /* Update event type after duration timeout*/
+            event.type = RBUS_EVENT_DURATION_COMPLETE;
+            duration_complete = true;
         }
+    }
 
-        rbusProperty_t properties = NULL;
-        rbusObject_t data;
-        rbusObject_Init(&data, NULL);
-        rbusProperty_Init(&properties, "numberOfEntries", NULL);
-        result = get_recursive_wildcard_handler(handleInfo, sub->eventName,
-                "IntervalThread", properties, &actualCount);
-        rbusProperty_SetInt32(properties, actualCount);
-        tmpptr = strchr(sub->eventName, '*');
-        if (tmpptr)
-        {
-            rbusObject_SetProperty(data, properties);
-        }
-        else
-        {
-            rbusObject_SetProperty(data, rbusProperty_GetNext(properties)); /*"numberOfEntries" property not requried for normal event*/
-        }
-        rbusProperty_Release(properties);
-        if(result != RBUS_ERROR_SUCCESS)
+    rbusMessage msg;
+    rbusMessage_Init(&msg);
+    rbusEventData_appendToMessage(&event, sub->filter, sub->interval, sub->duration, sub->componentId, sub->tlv, msg);
+
+    RBUSLOG_DEBUG("rbusEvent_Publish: publishing event %s to listener %s interval %d", sub->eventName, sub->listener, sub->interval);
+    error = rbus_publishSubscriberEvent(
+            handleInfo->componentName,
+            sub->eventName/*use the same eventName the consumer subscribed with; not event instance name eventData->name*/,
+            sub->listener,
+            msg);
+
+    rbusMessage_Release(msg);
+    rbusObject_Release(data);
+    if(error != RBUSCORE_SUCCESS)
+    {
+        RBUSLOG_ERROR("%s: rbusEvent_Publish failed with result=%d", __FUNCTION__, error);
+    }
+    sub_rec->count++;
+    return duration_complete;
+}
+
+/* Publish the due events of one listener, then put the subscriptions back on the heap */
+static void PublishTaskFunc(void* data)
+{
+    rtVector batch = (rtVector)data;
+    size_t i;
+
+    for(i = 0; i < rtVector_Size(batch); ++i)
+    {
+        sRecord* rec = (sRecord*)rtVector_At(batch, i);
+        int jitter = rtTime_Elapsed(&rec->nextDue, NULL);
+
+        if(jitter > rec->jitterMax)
+            rec->jitterMax = jitter;
+        rec->complete = PublishEvent(rec);
+    }
+
+    LOCK();
+    for(i = 0; i < rtVector_Size(batch); ++i)
+    {
+        sRecord* rec = (sRecord*)rtVector_At(batch, i);
+        int interval = rec->sub->interval * 1000;
+
+        rec->busy = false;
+        if(rec->jitterMax > gSched->jitterMax)
+            gSched->jitterMax = rec->jitterMax;
+        if(rec->removed)
+            continue;/*the remover is waiting for us to finish and frees it*/
+        if(rec->complete)
         {
-            RBUSLOG_ERROR("%s: failed to get details of %s", __FUNCTION__, sub->eventName);
-            rbusObject_Release(data);
+            struct _rbusHandle* handleInfo = (struct _rbusHandle*)rec->handle;
+            rbusSubscription_t* sub = rec->sub;
+            rtVector_RemoveItem(gRecord, rec, sub_Free);
+            rbusSubscriptions_removeSubscription(handleInfo->subscriptions, sub);
             continue;
         }
-
-        rbusEvent_t event = {0};
-        event.name = sub->eventName;
-        event.data = data;
-        event.type = RBUS_EVENT_INTERVAL;
-        /* Handling subscription with duration */
-        if (sub->duration != 0)
+        /*keep to the original phase, skipping any periods we were too late for*/
+        do
         {
-            duration_count = sub->duration/sub->interval;
-            if (count >= duration_count)
-            {
-                /* Update event type after duration timeout*/
-                event.type = RBUS_EVENT_DURATION_COMPLETE;
-                duration_complete = true;
-            }
-        }
+            rtTime_Later(&rec->nextDue, interval, &rec->nextDue);
+        } while(rtTime_Compare(&rec->nextDue, NULL) <= 0);
+        heap_push(rec);
+    }
+    if(gSched->jitterMax >= INTERVAL_JITTER_WARN && gSched->jitterMax >= 2 * gSched->jitterLogged)
+    {
+        RBUSLOG_WARN("%s: interval events now published up to %d ms late", __FUNCTION__, gSched->jitterMax);
+        gSched->jitterLogged = gSched->jitterMax;
+    }
+    ERROR_CHECK(pthread_cond_broadcast(&gSched->idle));
+    UNLOCK();
 
-        rbusMessage msg;
-        rbusMessage_Init(&msg);
-        rbusEventData_appendToMessage(&event, sub->filter, sub->interval, sub->duration, sub->componentId, msg);
+    rtVector_Destroy(batch, NULL);
+}
+
+/* Wait for subscriptions to come due and hand them to the executor, one task per listener (or per INTERVAL_BATCH_MAX of its events) */
+static void* SchedulerThreadFunc(void* data)
+{
+    (void)data;
+    RBUSLOG_DEBUG("%s: start", __FUNCTION__);
+    LOCK();
+    while(gSched->running)
+    {
+        int err = 0;
+        rtTimespec_t ts;
+        rtVector batches;
+        size_t i, j;
 
-        RBUSLOG_DEBUG("rbusEvent_Publish: publishing event %s to listener %s interval %d", sub->eventName, sub->listener, sub->interval);
-        error = rbus_publishSubscriberEvent(
-                handleInfo->componentName,
-                sub->eventName/*use the same eventName the consumer subscribed with; not event instance name eventData->name*/,
-                sub->listener,
-                msg);
+        if(gSched->heapSize == 0)
+            err = pthread_cond_wait(&gSched->cond, &gMutex);
+        else if(rtTime_Compare(&gSched->heap[0]->nextDue, NULL) > 0)
+            err = pthread_cond_timedwait(&gSched->cond, &gMutex, rtTime_ToTimespec(&gSched->heap[0]->nextDue, &ts));
 
-        rbusMessage_Release(msg);
-        rbusObject_Release(data);
-        if(error != RBUSCORE_SUCCESS)
+        if(err != 0 && err != ETIMEDOUT)
         {
-            RBUSLOG_ERROR("%s: rbusEvent_Publish failed with result=%d", __FUNCTION__, result);
+            RBUSLOG_ERROR("Error %d:%s running command pthread_cond_timedwait", err, strerror(err));
         }
 
-        if (duration_complete)
-        {
+        if(!gSched->running)
             break;
+
+        rtVector_Create(&batches);
+        while(gSched->heapSize && rtTime_Compare(&gSched->heap[0]->nextDue, NULL) <= 0)
+        {
+            sRecord* rec = gSched->heap[0];
+            rtVector batch = NULL;
+
+            heap_remove(rec);
+            rec->busy = true;
+            for(j = 0; j < rtVector_Size(batches); ++j)
+            {
+                rtVector b = (rtVector)rtVector_At(batches, j);
+                sRecord* first = (sRecord*)rtVector_At(b, 0);
+                if(rtVector_Size(b) < INTERVAL_BATCH_MAX && first->handle == rec->handle &&
+                   strcmp(first->sub->listener, rec->sub->listener) == 0)
+                {
+                    batch = b;
+                    break;
+                }
+            }
+            if(!batch)
+            {
+                rtVector_Create(&batch);
+                rtVector_PushBack(batches, batch);
+            }
+            rtVector_PushBack(batch, rec);
         }
-        else
+        /*the records are busy so they stay put; unlocked because a full executor queue blocks us*/
+        UNLOCK();
+        for(i = 0; i < rtVector_Size(batches); ++i)
         {
-            count++;
+            if(rbusExecutor_Run(PublishTaskFunc, rtVector_At(batches, i), true) != RBUS_ERROR_SUCCESS)
+                PublishTaskFunc(rtVector_At(batches, i));
         }
+        LOCK();
+        rtVector_Destroy(batches, NULL);
     }
-    ERROR_CHECK(pthread_mutex_unlock(&sub_rec->mutex));
-    if(duration_complete) {
-        ERROR_CHECK(pthread_mutex_lock(&gMutex));
-        rbusSubscriptions_removeSubscription(handleInfo->subscriptions, sub);
-        rtVector_RemoveItem(gRecord, sub_rec, sub_Free);
-        ERROR_CHECK(pthread_mutex_unlock(&gMutex));
-    }
-    RBUSLOG_DEBUG("%s: stop\n", __FUNCTION__);
+    UNLOCK();
+    RBUSLOG_DEBUG("%s: stop", __FUNCTION__);
     return NULL;
 }
 
-/* Add Subscription Record to global record and start subscription thread */
+/* Add Subscription Record to global record and schedule its first event */
 rbusError_t rbusInterval_AddSubscriptionRecord(
         rbusHandle_t handle,
         elementNode* propNode,
         rbusSubscription_t* sub)
 {
     sRecord *sub_rec = NULL;
+    size_t i;
+
     if(!propNode)
     {
         RBUSLOG_ERROR("%s: propNode NULL error", __FUNCTION__);
@@ -235,31 +428,59 @@ rbusError_t rbusInterval_AddSubscriptionRecord(
         return RBUS_ERROR_ACCESS_NOT_ALLOWED;
     }
 
-    ERROR_CHECK(pthread_mutex_lock(&gMutex));
+    LOCK();
     if (!gRecord)
         rtVector_Create(&gRecord);
+    init_scheduler();
 
     sub_rec = sub_find(sub);
-    ERROR_CHECK(pthread_mutex_unlock(&gMutex));
     if(!sub_rec)
     {
-        sub_rec = (sRecord*)rt_malloc(sizeof(sRecord));
+        int interval = sub->interval * 1000;
+        rtTime_t now;
+
+        sub_rec = (sRecord*)rt_calloc(1, sizeof(sRecord));
         sub_rec->handle = handle;
         sub_rec->node = propNode;
         sub_rec->sub = sub;
-        rbusProperty_Init(&sub_rec->property, propNode->fullName, NULL);
-        init_thread(sub_rec);
+        sub_rec->heapIndex = -1;
+        rtTime_Later(NULL, interval, &sub_rec->nextDue);
 
-        /* Thread create */
-        sub_rec->running = 1;
-        pthread_create(&sub_rec->thread, NULL, PublishingThreadFunc, (void *)sub_rec);
+        /*line up with a subscription of the same listener and interval so both go out in one task,
+          as long as that doesn't bring the first event forward by more than half an interval*/
+        for(i = 0; i < rtVector_Size(gRecord); ++i)
+        {
+            sRecord* rec = (sRecord*)rtVector_At(gRecord, i);
+            if(rec->handle == handle && rec->heapIndex >= 0 && rec->sub->interval == sub->interval &&
+               strcmp(rec->sub->listener, sub->listener) == 0)
+            {
+                sub_rec->nextDue = rec->nextDue;
+                rtTime_Now(&now);
+                if(rtTime_Elapsed(&now, &sub_rec->nextDue) < interval / 2)
+                    rtTime_Later(&sub_rec->nextDue, interval, &sub_rec->nextDue);
+                break;
+            }
+        }
 
         rtVector_PushBack(gRecord, sub_rec);
+        heap_push(sub_rec);
     }
+    UNLOCK();
     return RBUS_ERROR_SUCCESS; 
 }
 
-/* Delete Subscription Record from global record and stop it's running thread */
+/* take a record out of the schedule, waiting for a publish in progress; caller holds gMutex */
+static void sub_remove(sRecord* rec)
+{
+    rtVector_RemoveItem(gRecord, rec, NULL);
+    heap_remove(rec);
+    rec->removed = true;
+    while(rec->busy)
+        ERROR_CHECK(pthread_cond_wait(&gSched->idle, &gMutex));
+    sub_Free(rec);
+}
+
+/* Delete Subscription Record from global record and stop publishing it */
 void rbusInterval_RemoveSubscriptionRecord(
         rbusHandle_t handle,
         elementNode* propNode,
@@ -275,24 +496,55 @@ void rbusInterval_RemoveSubscriptionRecord(
     }
 
     sRecord* rec;
-    ERROR_CHECK(pthread_mutex_lock(&gMutex));
+    LOCK();
     rec = sub_find(sub);
-    ERROR_CHECK(pthread_mutex_unlock(&gMutex));
-
     if(rec)
     {
-        if(rec->running)
-        {
-            rec->running = 0;
-            ERROR_CHECK(pthread_cond_signal(&rec->cond));
-            ERROR_CHECK(pthread_join(rec->thread, NULL));
-        }
-        ERROR_CHECK(pthread_mutex_lock(&gMutex));
-        rtVector_RemoveItem(gRecord, rec, sub_Free);
-        ERROR_CHECK(pthread_mutex_unlock(&gMutex));
+        sub_remove(rec);
     }
     else
     {
         RBUSLOG_ERROR("%s: value not found\n", __FUNCTION__);
     }
+    UNLOCK();
+}
+
+/* Delete all Subscription Records of a handle, stopping the scheduler once none are left */
+void rbusInterval_CloseHandle(rbusHandle_t handle)
+{
+    size_t i = 0;
+    int running = 0;
+
+    if (!gRecord || !gSched)
+    {
+        return;
+    }
+
+    LOCK();
+    while(i < rtVector_Size(gRecord))
+    {
+        sRecord* rec = (sRecord*)rtVector_At(gRecord, i);
+        if(rec->handle == handle)
+            sub_remove(rec);
+        else
+            i++;
+    }
+    if(rtVector_Size(gRecord) == 0)
+    {
+        running = gSched->running;
+        gSched->running = 0;
+        ERROR_CHECK(pthread_cond_signal(&gSched->cond));
+    }
+    UNLOCK();
+
+    if(running)
+    {
+        /*publish tasks still finishing are done with gSched: their records would still be in gRecord*/
+        ERROR_CHECK(pthread_join(gSched->thread, NULL));
+        ERROR_CHECK(pthread_cond_destroy(&gSched->cond));
+        ERROR_CHECK(pthread_cond_destroy(&gSched->idle));
+        free(gSched->heap);
+        free(gSched);
+        gSched = NULL;
+    }
 }
@@ -20,13 +20,21 @@
 #include <rbus.h>
 #include <rtRetainable.h>
 #include <rtMemory.h>
+#include <rtHashMap.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 #include <stdarg.h>
+#include <endian.h>
+#include "rbus_buffer.h"
 
 #define VERIFY_NULL(T)    if(NULL == T){ return; }
 
+/*objects with at least this many properties look them up by name through a hash index*/
+#define RBUS_OBJECT_INDEX_MIN 16
+
+int rbusProperty_LinkGeneration();
+
 struct _rbusObject
 {
     rtRetainable retainable;
@@ -39,8 +47,49 @@ struct _rbusObject
                                   1) if parent is RBUS_OBJECT_SINGLE_INSTANCE | RBUS_OBJECT_MULTI_INSTANCE_ROW: 
                                         list of RBUS_OBJECT_SINGLE_INSTANCE and/or RBUS_OBJECT_MULTI_INSTANCE_TABLE
                                   2) if parent RBUS_OBJECT_MULTI_INSTANCE_TABLE: next is in a list of RBUS_OBJECT_MULTI_INSTANCE_ROW*/
+    rtHashMap index;             /*property name to first property with that name, built on demand for long lists*/
+    rbusProperty_t indexedTail;  /*last property added to index*/
+    int indexedGeneration;       /*property link generation the index was valid for*/
 };
 
+static void rbusObject_DropIndex(rbusObject_t object)
+{
+    if(object->index)
+    {
+        rtHashMap_Destroy(object->index);
+        object->index = NULL;
+    }
+    object->indexedTail = NULL;
+}
+
+/*look up a property through the index, first adding whatever was appended since the last lookup;
+  relinking or renaming any property changes the link generation and rebuilds the index*/
+static rbusProperty_t rbusObject_IndexLookup(rbusObject_t object, char const* name)
+{
+    int generation = rbusProperty_LinkGeneration();
+    rbusProperty_t prop;
+
+    if(object->index && object->indexedGeneration != generation)
+        rbusObject_DropIndex(object);
+    if(!object->index)
+    {
+        rtHashMap_Create(&object->index);
+        if(!object->index)
+            return NULL;
+    }
+    object->indexedGeneration = generation;
+
+    prop = object->indexedTail ? rbusProperty_GetNext(object->indexedTail) : object->properties;
+    for(; prop; prop = rbusProperty_GetNext(prop))
+    {
+        char const* propName = rbusProperty_GetName(prop);
+        if(propName && !rtHashMap_Contains(object->index, propName))
+            rtHashMap_Set(object->index, propName, prop);
+        object->indexedTail = prop;
+    }
+    return (rbusProperty_t)rtHashMap_Get(object->index, name);
+}
+
 rbusObject_t rbusObject_Init(rbusObject_t* pobject, char const* name)
 {
     rbusObject_t object;
@@ -73,6 +122,7 @@ void rbusObject_Destroy(rtRetainable* r)
     {
         rbusProperty_Release(object->properties);
     }
+    rbusObject_DropIndex(object);
 
     rbusObject_SetChildren(object, NULL);
     rbusObject_SetNext(object, NULL);
@@ -260,6 +310,7 @@ rbusProperty_t rbusObject_GetProperties(rbusObject_t object)
 void rbusObject_SetProperties(rbusObject_t object, rbusProperty_t properties)
 {
     VERIFY_NULL(object);
+    rbusObject_DropIndex(object);
     if(object->properties)
         rbusProperty_Release(object->properties);
     object->properties = properties;
@@ -271,6 +322,8 @@ rbusProperty_t rbusObject_GetProperty(rbusObject_t object, char const* name)
 {
     if(!object)
         return NULL;
+    if(object->properties && name && rbusProperty_Count(object->properties) >= RBUS_OBJECT_INDEX_MIN)
+        return rbusObject_IndexLookup(object, name);
     rbusProperty_t prop = object->properties;
     while(prop && strcmp(rbusProperty_GetName(prop), name))
         prop = rbusProperty_GetNext(prop);
@@ -460,6 +513,81 @@ void rbusObject_fwrite(rbusObject_t obj, int depth, FILE* fout)
     }
 }
 
+void rbusObject_Encode(rbusObject_t object, rbusBuffer_t buff)
+{
+    char const* name = (object && object->name) ? object->name : "";
+    uint32_t numChild = 0;
+    int posCount;
+    rbusObject_t child;
+
+    rbusBuffer_WriteStringTLV(buff, name, strlen(name) + 1);
+    rbusBuffer_WriteInt32TLV(buff, object ? object->type : RBUS_OBJECT_SINGLE_INSTANCE);
+    rbusPropertyList_Encode(object ? object->properties : NULL, buff);
+
+    /*the child count is patched in once the children have been written*/
+    rbusBuffer_WriteUInt32TLV(buff, 0);
+    posCount = buff->posWrite - sizeof(uint32_t);
+    for(child = object ? object->children : NULL; child; child = child->next, ++numChild)
+        rbusObject_Encode(child, buff);
+    numChild = htole32(numChild);
+    memcpy(buff->data + posCount, &numChild, sizeof(uint32_t));
+}
+
+int rbusObject_Decode(rbusObject_t* pobject, rbusBuffer_t const buff)
+{
+    uint16_t type;
+    uint32_t length;
+    int32_t objectType;
+    uint32_t numChild;
+    uint32_t i;
+    char const* name;
+    rbusProperty_t prop = NULL;
+    rbusObject_t object, previous = NULL;
+
+    *pobject = NULL;
+    if(rbusBuffer_ReadTypeLength(buff, &type, &length) < 0 || type != RBUS_STRING ||
+       length == 0 || length > (uint32_t)(buff->posWrite - buff->posRead) ||
+       buff->data[buff->posRead + length - 1] != 0)
+        return -1;
+    name = (char const*)buff->data + buff->posRead;
+    buff->posRead += length;
+
+    if(rbusBuffer_ReadTypeLength(buff, &type, &length) < 0 || type != RBUS_INT32 ||
+       rbusBuffer_ReadInt32(buff, &objectType) < 0 ||
+       rbusPropertyList_Decode(&prop, buff) < 0)
+        return -1;
+
+    if(objectType == RBUS_OBJECT_MULTI_INSTANCE)
+        rbusObject_InitMultiInstance(&object, name);
+    else
+        rbusObject_Init(&object, name);
+    object->properties = prop;
+
+    if(rbusBuffer_ReadTypeLength(buff, &type, &length) < 0 || type != RBUS_UINT32 ||
+       rbusBuffer_ReadUInt32(buff, &numChild) < 0)
+    {
+        rbusObject_Release(object);
+        return -1;
+    }
+    for(i = 0; i < numChild; ++i)
+    {
+        rbusObject_t child;
+        if(rbusObject_Decode(&child, buff) < 0)
+        {
+            rbusObject_Release(object);
+            return -1;
+        }
+        /*each child's reference is handed to its parent or previous sibling*/
+        if(previous)
+            previous->next = child;
+        else
+            object->children = child;
+        previous = child;
+    }
+    *pobject = object;
+    return 0;
+}
+
 #define DEFINE_OBJECT_PROPERTY_VALUE(T1, T2)\
 rbusValueError_t rbusObject_GetProperty##T1(rbusObject_t object, char const* name, T2* pdata)\
 {\
@@ -19,10 +19,13 @@
 
 #include <rbus.h>
 #include <rtRetainable.h>
+#include <rtAtomic.h>
 #include <rtMemory.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <endian.h>
+#include "rbus_buffer.h"
 
 #define VERIFY_NULL(T)      if(NULL == T){ return; }
 
@@ -32,8 +35,49 @@ struct _rbusProperty
     char* name;
     rbusValue_t value;
     struct _rbusProperty* next;
+    struct _rbusProperty* tail; /*last node of the list this node heads, as of generation*/
+    uint32_t count;             /*number of nodes from this one to tail*/
+    int generation;             /*sLinkGeneration when tail and count were cached*/
 };
 
+/*
+    Bumped whenever a link that already existed is replaced or a name changes, since that can take
+    nodes out of a list or rename them. Growing a list at its end does not bump it, so a tail cached
+    under the current generation is still in its list and the real end is found by walking forward.
+*/
+static atomic_int sLinkGeneration = 1;
+
+int rbusProperty_LinkGeneration()
+{
+    return sLinkGeneration;
+}
+
+/*find the last node of the list headed by property, caching it on the head so appends and counts
+  only walk what was added since the last call*/
+static rbusProperty_t rbusProperty_GetTail(rbusProperty_t property, uint32_t* count)
+{
+    int generation = sLinkGeneration;
+    rbusProperty_t last = property;
+    uint32_t n = 1;
+
+    if(property->tail && property->generation == generation)
+    {
+        last = property->tail;
+        n = property->count;
+    }
+    while(last->next)
+    {
+        last = last->next;
+        n++;
+    }
+    property->tail = last;
+    property->count = n;
+    property->generation = generation;
+    if(count)
+        *count = n;
+    return last;
+}
+
 rbusProperty_t rbusProperty_Init(rbusProperty_t* pproperty, char const* name, rbusValue_t value)
 {
     rbusProperty_t p = rt_calloc(1, sizeof(struct _rbusProperty));
@@ -154,6 +198,7 @@ char const* rbusProperty_GetName(rbusProperty_t property)
 void rbusProperty_SetName(rbusProperty_t property, char const* name)
 {
     VERIFY_NULL(property);
+    rt_atomic_fetch_add(&sLinkGeneration, 1);
     if(property->name)
         free(property->name);
     if(name)
@@ -186,7 +231,10 @@ void rbusProperty_SetNext(rbusProperty_t property, rbusProperty_t next)
 {
     VERIFY_NULL(property);
     if(property->next)
+    {
+        rt_atomic_fetch_add(&sLinkGeneration, 1);
         rbusProperty_Release(property->next);
+    }
     property->next = next;
     if(property->next)
         rbusProperty_Retain(property->next);
@@ -194,25 +242,103 @@ void rbusProperty_SetNext(rbusProperty_t property, rbusProperty_t next)
 
 void rbusProperty_Append(rbusProperty_t property, rbusProperty_t back)
 {
-    rbusProperty_t last = property;
-    VERIFY_NULL(last);
-    while(last->next)
-        last = last->next;
-    rbusProperty_SetNext(last, back);
+    VERIFY_NULL(property);
+    rbusProperty_SetNext(rbusProperty_GetTail(property, NULL), back);
 }
 
 uint32_t rbusProperty_Count(rbusProperty_t property)
 {
-    uint32_t count = 1;
-    rbusProperty_t prop = property;
-    if(!prop)
+    uint32_t count;
+    if(!property)
         return 0;
-    while(prop->next)
+    rbusProperty_GetTail(property, &count);
+    return count;
+}
+
+void rbusProperty_Encode(rbusProperty_t property, rbusBuffer_t buff)
+{
+    char const* name = property->name ? property->name : "";
+
+    rbusBuffer_WriteStringTLV(buff, name, strlen(name) + 1);
+    if(property->value)
+        rbusValue_Encode(property->value, buff);
+    else
+        rbusBuffer_WriteTypeLengthValue(buff, RBUS_NONE, 0, NULL);
+}
+
+int rbusProperty_Decode(rbusProperty_t* pproperty, rbusBuffer_t const buff)
+{
+    uint16_t type;
+    uint32_t length;
+    rbusProperty_t p;
+
+    if(rbusBuffer_ReadTypeLength(buff, &type, &length) < 0 || type != RBUS_STRING ||
+       length == 0 || length > (uint32_t)(buff->posWrite - buff->posRead) ||
+       buff->data[buff->posRead + length - 1] != 0)
+        return -1;
+    p = rbusProperty_Init(NULL, (char const*)buff->data + buff->posRead, NULL);
+    buff->posRead += length;
+    if(rbusValue_Decode(&p->value, buff) < 0)
     {
-        count++;
-        prop = prop->next;
+        rbusProperty_Release(p);
+        return -1;
     }
-    return count;
+    *pproperty = p;
+    return 0;
+}
+
+void rbusPropertyList_Encode(rbusProperty_t property, rbusBuffer_t buff)
+{
+    uint32_t count = 0;
+    int posCount;
+
+    /*the count is patched in once the list has been walked*/
+    rbusBuffer_WriteUInt32TLV(buff, 0);
+    posCount = buff->posWrite - sizeof(uint32_t);
+    for(; property; property = property->next, ++count)
+        rbusProperty_Encode(property, buff);
+    count = htole32(count);
+    memcpy(buff->data + posCount, &count, sizeof(uint32_t));
+}
+
+int rbusPropertyList_Decode(rbusProperty_t* pproperty, rbusBuffer_t const buff)
+{
+    uint16_t type;
+    uint32_t length;
+    uint32_t count;
+    uint32_t i;
+    rbusProperty_t first = NULL, last = NULL;
+
+    *pproperty = NULL;
+    if(rbusBuffer_ReadTypeLength(buff, &type, &length) < 0 || type != RBUS_UINT32 ||
+       length != sizeof(uint32_t) || rbusBuffer_ReadUInt32(buff, &count) < 0)
+        return -1;
+
+    /*link the nodes directly, handing each reference to the node before it, and leave
+      the head's tail cache pointing at the end so a later append doesn't walk the list*/
+    for(i = 0; i < count; ++i)
+    {
+        rbusProperty_t p;
+        if(rbusProperty_Decode(&p, buff) < 0)
+        {
+            if(first)
+                rbusProperty_Release(first);
+            return -1;
+        }
+        if(last)
+            last->next = p;
+        else
+            first = p;
+        last = p;
+    }
+    if(first)
+    {
+        first->tail = last;
+        first->count = count;
+        first->generation = sLinkGeneration;
+    }
+    *pproperty = first;
+    return 0;
 }
 
 rbusProperty_t rbusProperty_InitString(char const* name, char const* s)
@@ -36,7 +36,10 @@ struct _rbusSubscriptions
     elementNode* root;
     char* componentName;
     char* tmpDir;
-    rtList subList;
+    rtList subList;             /* all subscriptions, in the order they are saved to the cache */
+    rtHashMap listeners;        /* listener -> rtList of its subscriptions */
+    rtHashMap registrations;    /* registration element -> rtList of the subscriptions indexed under it */
+    rtList cached;              /* subscriptions loaded from the cache which haven't been resubscribed yet */
 };
 
 static void rbusSubscriptions_loadCache(rbusSubscriptions_t subscriptions);
@@ -89,6 +92,69 @@ static void subscriptionFree(void* p)
     free(sub);
 }
 
+static void subscriptionListDestroy(void* p)
+{
+    rtList_Destroy((rtList)p, NULL);
+}
+
+/*registrations is keyed by element pointer, so the map neither copies nor frees them*/
+static const void* registrationKeyCopy(const void* key)
+{
+    return key;
+}
+
+static void registrationKeyDestroy(void* key)
+{
+    (void)key;
+}
+
+static void subscriptionMapAdd(rtHashMap map, const void* key, rbusSubscription_t* sub)
+{
+    rtList list = rtHashMap_Get(map, key);
+
+    if(!list)
+    {
+        rtList_Create(&list);
+        rtHashMap_Set(map, key, list);
+    }
+    rtList_PushBack(list, sub, NULL);
+}
+
+static void subscriptionMapRemove(rtHashMap map, const void* key, rbusSubscription_t* sub)
+{
+    rtList list = rtHashMap_Get(map, key);
+    size_t size = 0;
+
+    if(!list)
+        return;
+    rtList_RemoveItemWithData(list, sub, NULL);
+    rtList_GetSize(list, &size);
+    if(size == 0)
+        rtHashMap_Remove(map, key);
+}
+
+/*adds sub to subList and the indexes*/
+static void rbusSubscriptions_linkSubscription(rbusSubscriptions_t subscriptions, rbusSubscription_t* sub)
+{
+    rtList_PushBack(subscriptions->subList, sub, NULL);
+    subscriptionMapAdd(subscriptions->listeners, sub->listener, sub);
+    if(sub->registration)
+        subscriptionMapAdd(subscriptions->registrations, sub->registration, sub);
+}
+
+/*removes sub from subList and the indexes without freeing it. returns false if sub wasn't in subList*/
+static bool rbusSubscriptions_unlinkSubscription(rbusSubscriptions_t subscriptions, rbusSubscription_t* sub)
+{
+    if(rtList_RemoveItemWithData(subscriptions->subList, sub, NULL) != RT_OK)
+        return false;
+    subscriptionMapRemove(subscriptions->listeners, sub->listener, sub);
+    if(sub->registration)
+        subscriptionMapRemove(subscriptions->registrations, sub->registration, sub);
+    if(!sub->tokens)/*loaded from cache*/
+        rtList_RemoveItemWithData(subscriptions->cached, sub, NULL);
+    return true;
+}
+
 void rbusSubscriptions_create(rbusSubscriptions_t* subscriptions, rbusHandle_t handle, char const* componentName, elementNode* root, const char* tmpDir)
 {
     *subscriptions = rt_malloc(sizeof(struct _rbusSubscriptions));
@@ -97,6 +163,10 @@ void rbusSubscriptions_create(rbusSubscriptions_t* subscriptions, rbusHandle_t h
     (*subscriptions)->componentName = strdup(componentName);
     (*subscriptions)->tmpDir = strdup(tmpDir);
     rtList_Create(&(*subscriptions)->subList);
+    rtHashMap_CreateEx(&(*subscriptions)->listeners, 0, NULL, NULL, NULL, NULL, NULL, subscriptionListDestroy);
+    rtHashMap_CreateEx(&(*subscriptions)->registrations, 0, rtHashMap_Hash_Func_Pointer, rtHashMap_Compare_Func_Pointer,
+        registrationKeyCopy, registrationKeyDestroy, NULL, subscriptionListDestroy);
+    rtList_Create(&(*subscriptions)->cached);
     rbusSubscriptions_loadCache(*subscriptions);
 }
 
@@ -104,6 +174,9 @@ void rbusSubscriptions_create(rbusSubscriptions_t* subscriptions, rbusHandle_t h
 void rbusSubscriptions_destroy(rbusSubscriptions_t subscriptions)
 {
     VERIFY_NULL(subscriptions);
+    rtList_Destroy(subscriptions->cached, NULL);
+    rtHashMap_Destroy(subscriptions->registrations);
+    rtHashMap_Destroy(subscriptions->listeners);
     rtList_Destroy(subscriptions->subList, subscriptionFree);
     free(subscriptions->componentName);
     free(subscriptions->tmpDir);
@@ -140,10 +213,15 @@ rbusSubscription_t* rbusSubscriptions_addSubscription(rbusSubscriptions_t subscr
     sub->interval = interval;
     sub->duration = duration;
     sub->autoPublish = autoPublish;
+    sub->tlv = false;
     sub->element = registryElem;
+    /*for an instance such as Device.WiFi.AccessPoint.1.SSID this is Device.WiFi.AccessPoint.{i}.SSID*/
+    sub->registration = retrieveElement(subscriptions->root, registryElem->fullName);
+    if(!sub->registration)
+        sub->registration = registryElem;
     sub->tokens = tokens;
     rtList_Create(&sub->instances);
-    rtList_PushBack(subscriptions->subList, sub, NULL);
+    rbusSubscriptions_linkSubscription(subscriptions, sub);
 
     rbusSubscriptions_onSubscriptionCreated(sub, subscriptions->root);
 
@@ -157,13 +235,21 @@ rbusSubscription_t* rbusSubscriptions_getSubscription(rbusSubscriptions_t subscr
 {
     rtListItem item;
     rbusSubscription_t* sub;
+    rtList list;
 
     RBUSLOG_DEBUG("%s: searching for %s %s", __FUNCTION__, listener, eventName);
 
     if(!subscriptions)
         return NULL;
 
-    rtList_GetFront(subscriptions->subList, &item);
+    list = rtHashMap_Get(subscriptions->listeners, listener);
+    if(!list)
+    {
+        RBUSLOG_DEBUG("%s: no sub found for %s %s", __FUNCTION__, listener, eventName);
+        return NULL;
+    }
+
+    rtList_GetFront(list, &item);
 
     while(item)
     {
@@ -188,26 +274,12 @@ rbusSubscription_t* rbusSubscriptions_getSubscription(rbusSubscriptions_t subscr
 /*remove an existing subscription*/
 void rbusSubscriptions_removeSubscription(rbusSubscriptions_t subscriptions, rbusSubscription_t* sub)
 {
-    rtListItem item;
-    rbusSubscription_t* sub2;
-
     VERIFY_NULL(subscriptions);
     VERIFY_NULL(sub);
-    RBUSLOG_DEBUG("%s: %s %s", __FUNCTION__, sub->listener, sub->eventName);
-
-    rtList_GetFront(subscriptions->subList, &item);
+    RBUSLOG_DEBUG("%s: removing %s %s", __FUNCTION__, sub->listener, sub->eventName);
 
-    while(item)
-    {
-        rtListItem_GetData(item, (void**)&sub2);
-        if(sub == sub2)
-        {
-            RBUSLOG_DEBUG("%s: removing %s %s", __FUNCTION__, sub->listener, sub->eventName);
-            rtList_RemoveItem(subscriptions->subList, item, subscriptionFree);
-            break;
-        }
-        rtListItem_GetNext(item, &item);
-    }    
+    if(rbusSubscriptions_unlinkSubscription(subscriptions, sub))
+        subscriptionFree(sub);
     rbusSubscriptions_saveCache(subscriptions);
 }
 
@@ -246,27 +318,39 @@ static void rbusSubscriptions_onSubscriptionCreated(rbusSubscription_t* sub, ele
 }
 
 /*  called after a new node instance is created 
- *  we go through the list of subscriptions and check to see if the 
- *  new node is picked up by any subscription eventName
+ *  we go through the subscriptions indexed under the node's registration element
+ *  and check to see if the new node is picked up by any subscription eventName.
+ *  registration is the element node was instantiated from. a new row's children are copies
+ *  of its template's children in the same order, so they are walked side by side
  */
-static void rbusSubscriptions_onElementCreated(rbusSubscriptions_t subscriptions, elementNode* node)
+static void rbusSubscriptions_onElementCreated(rbusSubscriptions_t subscriptions, elementNode* node, elementNode* registration)
 {
     if(node)
     {
         elementNode* child = node->child;
+        elementNode* regChild = registration ? registration->child : NULL;
 
         while(child)
         {
+            /*only subscriptions resolved to the same registration element can match*/
+            if(!regChild || strcmp(regChild->name, child->name) != 0)
+                regChild = retrieveElement(subscriptions->root, child->fullName);
+
             if(child->type == 0)
             {
-                rbusSubscriptions_onElementCreated(subscriptions, child);
+                rbusSubscriptions_onElementCreated(subscriptions, child, regChild);
             }
             else
             {
-                rtListItem item;
+                rtListItem item = NULL;
                 rbusSubscription_t* sub;
+                elementNode* registration = regChild;
+                rtList list = NULL;
 
-                rtList_GetFront(subscriptions->subList, &item);
+                if(registration)
+                    list = rtHashMap_Get(subscriptions->registrations, registration);
+                if(list)
+                    rtList_GetFront(list, &item);
 
                 while(item)
                 {
@@ -286,6 +370,7 @@ static void rbusSubscriptions_onElementCreated(rbusSubscriptions_t subscriptions
             }
 
             child = child->nextSibling;
+            regChild = regChild ? regChild->nextSibling : NULL;
         }
     }
 }
@@ -300,55 +385,26 @@ void rbusSubscriptions_onElementDeleted(rbusSubscriptions_t subscriptions, eleme
         while(child)
         {
             /*if child's type is a subscribable type*/
-            if(child->type != 0)
+            if(child->type != 0 && child->subscriptions)
             {
-                rtListItem item, tempitem;
+                rtListItem item;
                 rbusSubscription_t* sub;
-                bool val=false;
-                rbusSubscription_t* subscription = NULL;
 
-                rtList_GetFront(subscriptions->subList, &item);
+                /* the node's own list holds every subscription it is an instance of.
+                   removing a subscription also removes it from that list, so keep taking the front */
+                rtList_GetFront(child->subscriptions, &item);
 
-                /* go through all subscriptions */
                 while(item)
                 {
-                    rtListItem item2;
-                    elementNode* inst;
-
-                    rtListItem_GetNext(item, &tempitem);
                     rtListItem_GetData(item, (void**)&sub);
 
-                    rtList_GetFront(sub->instances, &item2);
-
-                    /* go through all instances in this subscription */
-                    while(item2)
-                    {
-                        rtListItem_GetData(item2, (void**)&inst);
-
-                        if(child == inst)
-                        {
-                            rtList_RemoveItem(sub->instances, item2, NULL);
-                            removeElementSubscription(child, sub);
-                            val = true;
-                            break;
-                        }
-                        rtListItem_GetNext(item2, &item2);
-                    }
+                    rtList_RemoveItemWithData(sub->instances, child, NULL);
+                    removeElementSubscription(child, sub);
 
                     /* RDKB-38389 : Removing the instance of the row to be removed from the subscriptions->subList linked list */
-                    if(val)
-                    {
-                        subscription = rbusSubscriptions_getSubscription(subscriptions, sub->listener, sub->eventName, sub->componentId, sub->filter);
-                        if(!subscription)
-                        {
-                            RBUSLOG_INFO("unsubscribing from event which isn't currectly subscribed to event=%s listener=%s", sub->eventName, sub->listener);
-                        }
-                        else
-                        {
-                            rbusSubscriptions_removeSubscription(subscriptions, subscription);
-                        }
-                    }
-                    item = tempitem;
+                    rbusSubscriptions_removeSubscription(subscriptions, sub);
+
+                    rtList_GetFront(child->subscriptions, &item);
                 }
             }
 
@@ -365,8 +421,31 @@ void rbusSubscriptions_onElementDeleted(rbusSubscriptions_t subscriptions, eleme
 
 void rbusSubscriptions_onTableRowAdded(rbusSubscriptions_t subscriptions, elementNode* node)
 {
+    rbusSubscriptions_onTableRowsAdded(subscriptions, &node, 1);
+}
+
+void rbusSubscriptions_onTableRowsAdded(rbusSubscriptions_t subscriptions, elementNode** nodes, int numNodes)
+{
+    elementNode* table = NULL;
+    elementNode* registration = NULL;
+    int i;
+
     VERIFY_NULL(subscriptions);
-    rbusSubscriptions_onElementCreated(subscriptions, node);
+    VERIFY_NULL(nodes);
+
+    for(i = 0; i < numNodes; ++i)
+    {
+        if(!nodes[i])
+            continue;
+
+        /*rows of the same table share their registration element, so it is only resolved once*/
+        if(nodes[i]->parent != table)
+        {
+            table = nodes[i]->parent;
+            registration = retrieveElement(subscriptions->root, nodes[i]->fullName);
+        }
+        rbusSubscriptions_onElementCreated(subscriptions, nodes[i], registration);
+    }
 }
 
 void rbusSubscriptions_onTableRowRemoved(rbusSubscriptions_t subscriptions, elementNode* node)
@@ -560,7 +639,8 @@ static void rbusSubscriptions_loadCache(rbusSubscriptions_t subscriptions)
         }
 
         rtList_Create(&sub->instances);
-        rtList_PushBack(subscriptions->subList, sub, NULL);
+        rbusSubscriptions_linkSubscription(subscriptions, sub);
+        rtList_PushBack(subscriptions->cached, sub, NULL);
 
         RBUSLOG_INFO("%s: loaded %s %s", __FUNCTION__, sub->listener, sub->eventName);
     }
@@ -705,34 +785,30 @@ void rbusSubscriptions_resubscribeElementCache(rbusHandle_t handle, rbusSubscrip
     VERIFY_NULL(el);
     RBUSLOG_DEBUG("%s: event %s", __FUNCTION__, elementName);
 
-    rtList_GetFront(subscriptions->subList, &item);
+    rtList_GetFront(subscriptions->cached, &item);
 
     while(item)
     {
+        rtListItem next;
+
         rtListItem_GetData(item, (void**)&sub);
+        rtListItem_GetNext(item, &next);
 
         VERIFY_NULL(sub);
 
-        if(sub->element == NULL && sub->tokens == NULL &&/*not already subscribed*/
-           _compareEventNameToElemName(sub->eventName, elementName) == 0)
+        if(_compareEventNameToElemName(sub->eventName, elementName) == 0)
         {
-            rtListItem next;
             rbusError_t err;
             RBUSLOG_INFO("%s: resubscribing %s for %s", __FUNCTION__, sub->eventName, sub->listener);
-            rtListItem_GetNext(item, &next);
-            rtList_RemoveItem(subscriptions->subList, item, NULL);/*remove before calling subscribeHandlerImpl to avoid dupes in cache file*/
+            rbusSubscriptions_unlinkSubscription(subscriptions, sub);/*remove before calling subscribeHandlerImpl to avoid dupes in cache file*/
             err = subscribeHandlerImpl(handle, true, el, sub->eventName, sub->listener, sub->componentId, sub->interval, sub->duration, sub->filter);
             /*TODO figure out what to do if we get an error resubscribing
             It's conceivable that a provider might not like the sub due to some state change between this and the previous process run
             */
             (void)err;
             subscriptionFree(sub);
-            item = next;
-        }
-        else
-        {
-            rtListItem_GetNext(item, &item);
         }
+        item = next;
     }
 }
 
@@ -742,74 +818,73 @@ void rbusSubscriptions_resubscribeRowElementCache(rbusHandle_t handle, rbusSubsc
     rbusSubscription_t* sub = NULL;
     elementNode* el = NULL;
     rbusError_t err = RBUS_ERROR_SUCCESS;
-    size_t size = 0;
-    unsigned int count = 0;
+    size_t len;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
 
-    if(subscriptions)
-    {
-        rtList_GetFront(subscriptions->subList, &item);
-        rtList_GetSize(subscriptions->subList, &size);
-    }
+    VERIFY_NULL(subscriptions);
+    VERIFY_NULL(rowNode);
+    len = strlen(rowNode->fullName);
 
-    while(item && (count < size))
+    rtList_GetFront(subscriptions->cached, &item);
+
+    while(item)
     {
-        /* This count matters otherwise, the sublist will go on forever as we push the new subscription at the end of the list */
-        count++;
+        rtListItem next = NULL;
+
         rtListItem_GetData(item, (void**)&sub);
-        if(sub)
+        rtListItem_GetNext(item, &next);
+        if(!sub)
+            break;
+
+        /*the row itself or something under it, but not Foo.10 for row Foo.1*/
+        if(strncmp(sub->eventName, rowNode->fullName, len) == 0 && (sub->eventName[len] == 0 || sub->eventName[len] == '.'))
         {
-            rtListItem next = NULL;
-            rtListItem_GetNext(item, &next);
-            if(strncmp(sub->eventName, rowNode->fullName, strlen(rowNode->fullName)) == 0)
+            el = retrieveInstanceElement(handleInfo->elementRoot, sub->eventName);
+            if(el)
             {
-                el = retrieveInstanceElement(handleInfo->elementRoot, sub->eventName);
-                if(el)
-                {
-                    RBUSLOG_INFO("%s: resubscribing %s for %s", __FUNCTION__, sub->eventName, sub->listener);
-                    rtList_RemoveItem(subscriptions->subList, item, NULL);
-                    err = subscribeHandlerImpl(handle, true, el, sub->eventName, sub->listener, sub->componentId, sub->interval, sub->duration, sub->filter);
-                    (void)err;
-                    subscriptionFree(sub);
-                }
+                RBUSLOG_INFO("%s: resubscribing %s for %s", __FUNCTION__, sub->eventName, sub->listener);
+                rbusSubscriptions_unlinkSubscription(subscriptions, sub);
+                err = subscribeHandlerImpl(handle, true, el, sub->eventName, sub->listener, sub->componentId, sub->interval, sub->duration, sub->filter);
+                (void)err;
+                subscriptionFree(sub);
             }
-
-            /* Move to Next */
-            item = next;
         }
-        else
-            break;
+
+        /* Move to Next */
+        item = next;
     }
 }
 
 void rbusSubscriptions_handleClientDisconnect(rbusHandle_t handle, rbusSubscriptions_t subscriptions, char const* listener)
 {
-    rtListItem item;
+    rtListItem item = NULL;
     rbusSubscription_t* sub;
     elementNode* el = NULL;
+    rtList list;
     struct _rbusHandle* handleInfo = (struct _rbusHandle*)handle;
 
     VERIFY_NULL(subscriptions);
     RBUSLOG_DEBUG("%s: %s", __FUNCTION__, listener);
 
-    rtList_GetFront(subscriptions->subList, &item);
+    /*unsubscribing removes the sub from this list, and the list itself once it is empty*/
+    list = rtHashMap_Get(subscriptions->listeners, listener);
+    if(list)
+        rtList_GetFront(list, &item);
 
     while(item)
     {
         rtListItem_GetData(item, (void**)&sub);
         rtListItem_GetNext(item, &item);
-        if(strcmp(sub->listener, listener) == 0)
+
+        /* RDKB-38389 : Checking for elementnode existence for which the eventname is subscribed */
+        el = retrieveInstanceElement(handleInfo->elementRoot, sub->eventName);
+        if(el)
         {
-            /* RDKB-38389 : Checking for elementnode existence for which the eventname is subscribed */
-            el = retrieveInstanceElement(handleInfo->elementRoot, sub->eventName);
-            if(el)
-            {
-                subscribeHandlerImpl(handle, false, sub->element, sub->eventName, sub->listener, sub->componentId, 0, 0, 0);
-            }
-            else
-            {
-                RBUSLOG_WARN("rbusSubscriptions_handleClientDisconnect: unexpected! element not found");
-            }
+            subscribeHandlerImpl(handle, false, sub->element, sub->eventName, sub->listener, sub->componentId, 0, 0, 0);
+        }
+        else
+        {
+            RBUSLOG_WARN("rbusSubscriptions_handleClientDisconnect: unexpected! element not found");
         }
     }
 }
@@ -41,8 +41,10 @@ typedef struct _rbusSubscription
     int32_t interval;           /* optional interval */
     int32_t duration;           /* optional duration */
     bool autoPublish;           /* auto publishing */
+    bool tlv;                   /* the subscriber reads event data as an rbusBuffer TLV block */
     TokenChain* tokens;         /* tokenized eventName for pattern matching */
     elementNode* element;       /* the registation element e.g. Device.WiFi.AccessPoint.{i}.AssociatedDevice.{i}.SignalStrength */
+    elementNode* registration;  /* element with every row as {i}, which new rows are matched through */
     rtList instances;           /* the instance elements e.g.   Device.WiFi.AccessPoint.1.AssociatedDevice.1.SignalStrength
                                                                 Device.WiFi.AccessPoint.1.AssociatedDevice.2.SignalStrength
                                                                 Device.WiFi.AccessPoint.2.AssociatedDevice.1.SignalStrength */
@@ -66,6 +68,9 @@ void rbusSubscriptions_removeSubscription(rbusSubscriptions_t subscriptions, rbu
 /*call right after a new row is added*/
 void rbusSubscriptions_onTableRowAdded(rbusSubscriptions_t subscriptions, elementNode* node);
 
+/*call right after several new rows are added*/
+void rbusSubscriptions_onTableRowsAdded(rbusSubscriptions_t subscriptions, elementNode** nodes, int numNodes);
+
 /*call right before an existing row is delete*/
 void rbusSubscriptions_onTableRowRemoved(rbusSubscriptions_t subscriptions, elementNode* node);
 
@@ -691,36 +691,34 @@ void rbusValue_SetTLV(rbusValue_t v, rbusValueType_t type, uint32_t length, void
 int rbusValue_Decode(rbusValue_t* value, rbusBuffer_t const buff)
 {
     uint16_t    type;
-    uint16_t    length;
+    uint32_t    length;
     rbusValue_t current;
 
-    rbusValue_Init(value);
-
-    if(!value)
+    if(!value || !buff)
         return -1;
+
+    rbusValue_Init(value);
     current = *value;
 
     // read value
-    rbusBuffer_ReadUInt16(buff, &type);
-    rbusBuffer_ReadUInt16(buff, &length);
-    if(!buff)
+    if(rbusBuffer_ReadTypeLength(buff, &type, &length) < 0)
         return -1;
-    current->type = type;
     switch(type)
     {
     /*Calling rbusValue_SetString/rbusValue_SetBytes so the value's internal buffer is created.*/
     case RBUS_STRING:
-        if(!(buff->posRead + length <= buff->lenAlloc))
+        /*length captures the null term*/
+        if(length == 0 || length > (uint32_t)(buff->posWrite - buff->posRead) ||
+           buff->data[buff->posRead + length - 1] != 0)
         {
             RBUSLOG_WARN("rbusValue_Decode failed");
             return -1;
         }
-        assert(strlen((char const*)buff->data + buff->posRead) + 1 == (size_t)length);/*length should captures null term*/
         rbusValue_SetString(current, (char const*)buff->data + buff->posRead);
         buff->posRead += length;
         return length;
     case RBUS_BYTES:
-        if(!(buff->posRead + length <= buff->lenAlloc))
+        if(length > (uint32_t)(buff->posWrite - buff->posRead))
         {
             RBUSLOG_WARN("rbusValue_Decode failed");
             return -1;
@@ -728,7 +726,34 @@ int rbusValue_Decode(rbusValue_t* value, rbusBuffer_t const buff)
         rbusValue_SetBytes(current, buff->data + buff->posRead, length);
         buff->posRead += length;
         return length;
-    /* For the other types, its ok to read directly into them and set the type below */
+    /*A list or object follows its type and length, which carry no value of their own*/
+    case RBUS_PROPERTY:
+    {
+        rbusProperty_t prop = NULL;
+        if(rbusPropertyList_Decode(&prop, buff) < 0)
+            return -1;
+        rbusValue_SetProperty(current, prop);
+        if(prop)
+            rbusProperty_Release(prop);
+        return 0;
+    }
+    case RBUS_OBJECT:
+    {
+        rbusObject_t obj = NULL;
+        if(rbusObject_Decode(&obj, buff) < 0)
+            return -1;
+        rbusValue_SetObject(current, obj);
+        rbusObject_Release(obj);
+        return 0;
+    }
+    case RBUS_NONE:
+        return 0;
+    }
+
+    /* For the other types, its ok to read directly into them and set the type */
+    current->type = type;
+    switch(type)
+    {
     case RBUS_BOOLEAN:
         return rbusBuffer_ReadBoolean(buff, &current->d.b);
     case RBUS_INT32:
@@ -758,7 +783,8 @@ int rbusValue_Decode(rbusValue_t* value, rbusBuffer_t const buff)
     case RBUS_DATETIME:
         return rbusBuffer_ReadDateTime(buff, &current->d.tv);
     default:
-        assert(false);
+        current->type = RBUS_NONE;
+        RBUSLOG_WARN("rbusValue_Decode failed: unknown type %d", type);
         return -1;
     }
 }
@@ -824,6 +850,17 @@ void rbusValue_Encode(rbusValue_t value, rbusBuffer_t buff)
     case RBUS_DATETIME:
         rbusBuffer_WriteDateTimeTLV(buff, &value->d.tv);
         break;
+    case RBUS_PROPERTY:
+        rbusBuffer_WriteTypeLengthValue(buff, RBUS_PROPERTY, 0, NULL);
+        rbusPropertyList_Encode(value->d.property, buff);
+        break;
+    case RBUS_OBJECT:
+        rbusBuffer_WriteTypeLengthValue(buff, RBUS_OBJECT, 0, NULL);
+        rbusObject_Encode(value->d.object, buff);
+        break;
+    case RBUS_NONE:
+        rbusBuffer_WriteTypeLengthValue(buff, RBUS_NONE, 0, NULL);
+        break;
     default:
         assert(false);
         break;
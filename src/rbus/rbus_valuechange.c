@@ -20,14 +20,19 @@
 /*
     Value-Change Detection:
     Simple API that allows you to add/remove parameters you wish to check value-change for.
-    Uses a single thread to poll parameter values across all rbus handles.
-    The thread is started on first param added and stopped on last param removed.
-    A poling period (default 30 seconds) helps to limit the cpu usage.
+    Params across all rbus handles are spread over a small pool of worker threads (valueChangeThreads),
+    each polling its own shard.  A worker is started when its shard gets its first param.
     Runs in the provider process, so the value are got with direct callbacks and not over the network.
     The technique is simple:
     1) when a param is added, get and cache its current value.
     2) on a background thread, periodically get the latest value and compare to cached value.
     3) if the value has change, publish an event.
+    Each param is polled on its own interval, kept on a timer wheel so a tick only visits the params due:
+    a param that changed is polled more often (down to valueChangePeriodMin), one that did not backs off
+    to valueChangePeriod.  A provider can also report a change itself with rbus_setValueChanged, which
+    wakes the worker right away; such params are then only polled every valueChangePeriodMax as a safety net.
+    Locks are never held across a getHandler call, so adding or removing a param only waits on a poll
+    of that same param.
 */
 
 #define _GNU_SOURCE 1 //needed for pthread_mutexattr_settype
@@ -43,6 +48,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <rtVector.h>
+#include <rtHashMap.h>
 #include <rtTime.h>
 #include <rtMemory.h>
 
@@ -57,189 +63,503 @@
 #define VERIFY_NULL(T)      if(NULL == T){ return; }
 #define LOCK() ERROR_CHECK(pthread_mutex_lock(&gVC->mutex))
 #define UNLOCK() ERROR_CHECK(pthread_mutex_unlock(&gVC->mutex))
+#define SHARD_LOCK(S) ERROR_CHECK(pthread_mutex_lock(&(S)->mutex))
+#define SHARD_UNLOCK(S) ERROR_CHECK(pthread_mutex_unlock(&(S)->mutex))
 
-typedef struct ValueChangeDetector_t
+#define VC_WHEEL_SLOTS 64          /*slots on the timer wheel*/
+#define VC_WHEEL_TICKS_PER_MIN 4    /*wheel ticks per valueChangePeriodMin*/
+#define VC_SHARDS_MAX 16            /*upper bound on valueChangeThreads*/
+
+typedef struct ValueChangeShard
 {
     int              running;
-    rtVector         params;
-    pthread_mutex_t  mutex;
     pthread_t        thread;
-    pthread_cond_t   cond;
-} ValueChangeDetector_t;
+    pthread_mutex_t  mutex;                 /*guards the shard and the poll state of its records*/
+    pthread_cond_t   cond;                  /*wakes the worker*/
+    pthread_cond_t   idle;                  /*broadcast each time the worker finishes polling a record*/
+    rtVector         wheel[VC_WHEEL_SLOTS]; /*records waiting for their next poll*/
+    int              wheelSlot;             /*slot processed on the last tick*/
+    rtTime_t         nextTick;
+    rtVector         notified;              /*ValueChangeNotify reported through rbus_setValueChanged*/
+    size_t           numParams;
+} ValueChangeShard;
 
 typedef struct ValueChangeRecord
 {
     rbusHandle_t handle;    //needed when calling rbus_getHandler and rbusEvent_Publish
     elementNode const* node;    //used to call the rbus_getHandler is contains
     rbusProperty_t property;    //the parameter with value that gets cached
+    ValueChangeShard* shard;    //the worker polling this param
+    struct ValueChangeRecord* prev; //links in gVC->records
+    struct ValueChangeRecord* next;
+    int interval;           //miliseconds between polls of this param
+    int slot;               //wheel slot the record is in, -1 while off the wheel
+    int rounds;             //wheel revolutions left before the record is due
+    int busy;               //number of times the record is in the worker's current batch
+    bool polling;           //the worker is polling it right now, outside the shard lock
+    bool removed;           //no longer watched, skip any pending poll and don't put it back on the wheel
+    bool orphaned;          //removed while busy, the worker frees it once done with its batch
+    bool notifies;          //the provider reports changes to this param itself
+    rtTime_t lastCheck;     //when the cached value was last refreshed
+    uint32_t pollCount;     //number of getHandler calls made to poll this param
+    uint64_t pollTime;      //total microseconds spent in those calls
+    uint32_t pollTimeMax;   //longest of those calls in microseconds
 } ValueChangeRecord;
 
+typedef struct ValueChangeNotify
+{
+    ValueChangeRecord* rec;
+    rbusValue_t value;      //the new value if the provider gave it, else NULL to get it
+} ValueChangeNotify;
+
+typedef struct ValueChangeDetector_t
+{
+    pthread_mutex_t  mutex;     /*guards params and records only, never held while polling*/
+    rtHashMap        params;    /*elementNode const* to ValueChangeRecord* */
+    ValueChangeRecord* records; /*all records, so a handle's params can be found on close*/
+    int              tick;      /*miliseconds between wheel slots*/
+    int              numShards;
+    ValueChangeShard shards[VC_SHARDS_MAX];
+} ValueChangeDetector_t;
+
 ValueChangeDetector_t* gVC = NULL;
 
+static int vcPeriodMin()
+{
+    int period = rbusConfig_Get()->valueChangePeriod;
+    int min = rbusConfig_Get()->valueChangePeriodMin;
+    return (min > 0 && min < period) ? min : period;
+}
+
+static int vcPeriodMax()
+{
+    int period = rbusConfig_Get()->valueChangePeriod;
+    int max = rbusConfig_Get()->valueChangePeriodMax;
+    return max > period ? max : period;
+}
+
+static const void* vcParams_KeyCopy(const void* data)
+{
+    return data;
+}
+
+static void vcParams_KeyDestroy(void* data)
+{
+    (void)data;
+}
+
 static void rbusValueChange_Init()
 {
     pthread_mutexattr_t attrib;
     pthread_condattr_t cattrib;
+    int i, j;
 
     RBUSLOG_DEBUG("%s", __FUNCTION__);
 
     if(gVC)
         return;
 
-    gVC = rt_malloc(sizeof(struct ValueChangeDetector_t));
-
-    gVC->running = 0;
-    gVC->params = NULL;
+    gVC = rt_calloc(1, sizeof(struct ValueChangeDetector_t));
 
-    rtVector_Create(&gVC->params);
+    rtHashMap_CreateEx(&gVC->params, 0, rtHashMap_Hash_Func_Pointer, rtHashMap_Compare_Func_Pointer,
+        vcParams_KeyCopy, vcParams_KeyDestroy, NULL, NULL);
+    gVC->records = NULL;
+    gVC->tick = vcPeriodMin() / VC_WHEEL_TICKS_PER_MIN;
+    if(gVC->tick < 1)
+        gVC->tick = 1;
+    gVC->numShards = rbusConfig_Get()->valueChangeThreads;
+    if(gVC->numShards < 1)
+        gVC->numShards = 1;
+    if(gVC->numShards > VC_SHARDS_MAX)
+        gVC->numShards = VC_SHARDS_MAX;
 
     ERROR_CHECK(pthread_mutexattr_init(&attrib));
     ERROR_CHECK(pthread_mutexattr_settype(&attrib, PTHREAD_MUTEX_ERRORCHECK));
-    ERROR_CHECK(pthread_mutex_init(&gVC->mutex, &attrib));
-
     ERROR_CHECK(pthread_condattr_init(&cattrib));
     ERROR_CHECK(pthread_condattr_setclock(&cattrib, CLOCK_MONOTONIC));
-    ERROR_CHECK(pthread_cond_init(&gVC->cond, &cattrib));
+
+    ERROR_CHECK(pthread_mutex_init(&gVC->mutex, &attrib));
+
+    for(i = 0; i < gVC->numShards; ++i)
+    {
+        ValueChangeShard* shard = &gVC->shards[i];
+        for(j = 0; j < VC_WHEEL_SLOTS; ++j)
+            rtVector_Create(&shard->wheel[j]);
+        rtVector_Create(&shard->notified);
+        ERROR_CHECK(pthread_mutex_init(&shard->mutex, &attrib));
+        ERROR_CHECK(pthread_cond_init(&shard->cond, &cattrib));
+        ERROR_CHECK(pthread_cond_init(&shard->idle, &cattrib));
+    }
+
     ERROR_CHECK(pthread_condattr_destroy(&cattrib));
+    ERROR_CHECK(pthread_mutexattr_destroy(&attrib));
+}
+
+static void vcNotify_Free(void* p)
+{
+    ValueChangeNotify* n = (ValueChangeNotify*)p;
+    if(n)
+    {
+        if(n->value)
+            rbusValue_Release(n->value);
+        free(n);
+    }
 }
 
 static void vcParams_Free(void* p)
 {
     ValueChangeRecord* rec = (ValueChangeRecord*)p;
     if(rec){
+        if(rec->pollCount)
+        {
+            RBUSLOG_INFO("%s: %s polled %u times, average %u us, max %u us", __FUNCTION__, rbusProperty_GetName(rec->property),
+                rec->pollCount, (uint32_t)(rec->pollTime / rec->pollCount), rec->pollTimeMax);
+        }
         rbusProperty_Release(rec->property);
         free(rec);
     }
 }
 
-static ValueChangeRecord* vcParams_Find(const elementNode* paramNode)
+/*put a record on its shard's wheel to be polled after delay miliseconds; caller holds the shard lock*/
+static void vcWheel_Schedule(ValueChangeRecord* rec, int delay)
+{
+    ValueChangeShard* shard = rec->shard;
+    int ticks = (delay + gVC->tick - 1) / gVC->tick;
+    if(ticks < 1)
+        ticks = 1;
+    rec->slot = (shard->wheelSlot + ticks) % VC_WHEEL_SLOTS;
+    rec->rounds = (ticks - 1) / VC_WHEEL_SLOTS;
+    rtVector_PushBack(shard->wheel[rec->slot], rec);
+}
+
+static void vcWheel_Unschedule(ValueChangeRecord* rec)
+{
+    if(rec->slot >= 0)
+    {
+        rtVector_RemoveItem(rec->shard->wheel[rec->slot], rec, NULL);
+        rec->slot = -1;
+    }
+}
+
+/*
+    Take a record out of its shard and free it.
+    The record must already be out of gVC->params so no new change reports can reach it.
+    If the shard's worker is polling it right now we wait for that one poll, unless we are being called
+    from inside it.  If the record is still in the worker's batch the worker frees it when it gets to it.
+*/
+static void vcParams_Remove(ValueChangeRecord* rec)
+{
+    ValueChangeShard* shard = rec->shard;
+    size_t i = 0;
+
+    SHARD_LOCK(shard);
+    while(i < rtVector_Size(shard->notified))
+    {
+        ValueChangeNotify* n = (ValueChangeNotify*)rtVector_At(shard->notified, i);
+        if(n->rec == rec)
+            rtVector_RemoveItem(shard->notified, n, vcNotify_Free);
+        else
+            i++;
+    }
+    vcWheel_Unschedule(rec);
+    shard->numParams--;
+    rec->removed = true;
+    if(!pthread_equal(pthread_self(), shard->thread))
+    {
+        while(rec->polling)
+            ERROR_CHECK(pthread_cond_wait(&shard->idle, &shard->mutex));
+    }
+    if(rec->busy)
+    {
+        rec->orphaned = true;
+        SHARD_UNLOCK(shard);
+        return;
+    }
+    SHARD_UNLOCK(shard);
+    vcParams_Free(rec);
+}
+
+/*unlink a record from the detector's index; caller holds gVC->mutex*/
+static void vcParams_Unlink(ValueChangeRecord* rec)
+{
+    rtHashMap_Remove(gVC->params, rec->node);
+    if(rec->prev)
+        rec->prev->next = rec->next;
+    else
+        gVC->records = rec->next;
+    if(rec->next)
+        rec->next->prev = rec->prev;
+    rec->prev = rec->next = NULL;
+}
+/*call the param's getHandler, accounting the time it took*/
+static int vcParams_Get(ValueChangeRecord* rec, rbusProperty_t property)
+{
+    rtTime_t start, end;
+    uint32_t us;
+    int result;
+
+    rbusGetHandlerOptions_t opts;
+    memset(&opts, 0, sizeof(rbusGetHandlerOptions_t));
+    opts.requestingComponent = "valueChangePollThread";
+
+    rtTime_Now(&start);
+    ELM_PRIVATE_LOCK(rec->node);
+    result = rec->node->cbTable.getHandler(rec->handle, property, &opts);
+    ELM_PRIVATE_UNLOCK(rec->node);
+    rtTime_Now(&end);
+
+    us = (uint32_t)((end.tv_sec - start.tv_sec) * 1000000 + (end.tv_nsec - start.tv_nsec) / 1000);
+    if(us > rec->pollTimeMax)
+    {
+        if(us / 1000 >= (uint32_t)gVC->tick)
+            RBUSLOG_WARN("%s: getHandler for %s took %u us", __FUNCTION__, rbusProperty_GetName(rec->property), us);
+        rec->pollTimeMax = us;
+    }
+    rec->pollTime += us;
+    rec->pollCount++;
+    return result;
+}
+
+/*
+    Compare the param's current value to the cached one and publish a value-change event if they differ.
+    newVal is the value reported by the provider, or NULL to get it from the getHandler.
+    Returns true if a change was detected.
+*/
+static bool vcParams_Check(ValueChangeRecord* rec, rbusValue_t newVal)
 {
+    rbusProperty_t property;
+    rbusValue_t oldVal;
+    int result;
+    bool changed = false;
+
+    rbusProperty_Init(&property,rbusProperty_GetName(rec->property), newVal);
+
+    if(!newVal)
+    {
+        result = vcParams_Get(rec, property);
+        if(result != RBUS_ERROR_SUCCESS)
+        {
+            RBUSLOG_WARN("%s: failed to get current value of %s", __FUNCTION__, rbusProperty_GetName(property));
+            rbusProperty_Release(property);
+            return false;
+        }
+    }
+
+    char* sValue = rbusValue_ToString(rbusProperty_GetValue(property), NULL, 0);
+    RBUSLOG_DEBUG("%s: %s=%s", __FUNCTION__, rbusProperty_GetName(property), sValue);
+    free(sValue);
+
+    newVal = rbusProperty_GetValue(property);
+    oldVal = rbusProperty_GetValue(rec->property);
+
+    if(rbusValue_Compare(newVal, oldVal))
+    {
+        rbusEvent_t event = {0};
+        rbusObject_t data;
+        rbusValue_t byVal = NULL;
+
+        RBUSLOG_INFO("%s: value change detected for %s", __FUNCTION__, rbusProperty_GetName(rec->property));
+
+        /* The "by" field is set to the component's name which made the last value change.
+           The source of a value-change could be an external component calling rbus_set or the provider internally updating
+           the value.  changeComp/changeTime are updated through the rbus_set path, but not through the provider internal path.
+           We must deduce if the provider has updated the value and reflect that change to the changeComp/changeTime, right here.
+           If we don't have a changeComp or we do but the changeTime is older than the last check of this param,
+           then we know it was the provider who updated the value we are now detecting.
+        */
+        if(rec->node->changeComp == NULL || 
+           (rtTime_Elapsed(&rec->node->changeTime, NULL) >= rtTime_Elapsed(&rec->lastCheck, NULL) &&
+           strcmp(rec->handle->componentName, rec->node->changeComp) == 0))
+        {
+            printf("VC detected provider-side value-change oldcomp=%s elapsed=%d period=%d\n", rec->node->changeComp, rtTime_Elapsed(&rec->node->changeTime, NULL), rec->interval);
+            setPropertyChangeComponent((elementNode*)rec->node, rec->handle->componentName);
+        }
+
+        rbusObject_Init(&data, NULL);
+        rbusObject_SetValue(data, "value", newVal);
+        rbusObject_SetValue(data, "oldValue", oldVal);
+
+        rbusValue_Init(&byVal);
+        rbusValue_SetString(byVal, rec->node->changeComp);
+        rbusObject_SetValue(data, "by", byVal);
+        rbusValue_Release(byVal);
+
+        event.name = rbusProperty_GetName(rec->property);
+        event.data = data;
+        event.type = RBUS_EVENT_VALUE_CHANGED;
+        result = rbusEvent_Publish(rec->handle, &event);
+
+        rbusObject_Release(data);
+
+        if(result != RBUS_ERROR_SUCCESS)
+        {
+            RBUSLOG_WARN("%s: rbusEvent_Publish failed with result=%d", __FUNCTION__, result);
+        }
+
+        /*update the record's property with new value*/
+        rbusProperty_SetValue(rec->property, rbusProperty_GetValue(property));
+        changed = true;
+    }
+    else
+    {
+        RBUSLOG_DEBUG("%s: value change not detected for %s", __FUNCTION__, rbusProperty_GetName(rec->property));
+    }
+    rtTime_Now(&rec->lastCheck);
+    rbusProperty_Release(property);
+    return changed;
+}
+
+/*move the records due on the next slot of the wheel to due; caller holds the shard lock*/
+static void vcWheel_Tick(ValueChangeShard* shard, rtVector due)
+{
+    rtVector slot;
     size_t i;
-    for(i=0; i < rtVector_Size(gVC->params); ++i)
+
+    shard->wheelSlot = (shard->wheelSlot + 1) % VC_WHEEL_SLOTS;
+    slot = shard->wheel[shard->wheelSlot];
+
+    i = 0;
+    while(i < rtVector_Size(slot))
     {
-        ValueChangeRecord* rec = (ValueChangeRecord*)rtVector_At(gVC->params, i);
-        if(rec && rec->node == paramNode)
-            return rec;
+        ValueChangeRecord* rec = (ValueChangeRecord*)rtVector_At(slot, i);
+        if(rec->rounds > 0)
+        {
+            rec->rounds--;
+            i++;
+        }
+        else
+        {
+            rtVector_RemoveItem(slot, rec, NULL);
+            rec->slot = -1;
+            rec->busy++;
+            rtVector_PushBack(due, rec);
+        }
     }
-    return NULL;
+}
+
+/*
+    Poll one record from the worker's batch, unless it was removed meanwhile.
+    Called without the shard lock; due is true if the record came off the wheel and needs rescheduling.
+*/
+static void vcParams_Poll(ValueChangeShard* shard, ValueChangeRecord* rec, rbusValue_t value, bool due)
+{
+    bool changed;
+
+    SHARD_LOCK(shard);
+    rec->polling = !rec->removed;
+    SHARD_UNLOCK(shard);
+
+    if(rec->polling)
+    {
+        changed = vcParams_Check(rec, value);
+
+        /*poll params that change more often and back off on those that do not*/
+        if(due && !rec->notifies)
+        {
+            if(changed)
+                rec->interval = rec->interval / 2 < vcPeriodMin() ? vcPeriodMin() : rec->interval / 2;
+            else
+                rec->interval = rec->interval * 2 > rbusConfig_Get()->valueChangePeriod ? rbusConfig_Get()->valueChangePeriod : rec->interval * 2;
+        }
+    }
+
+    SHARD_LOCK(shard);
+    if(rec->polling)
+    {
+        rec->polling = false;
+        if(due && !rec->removed && rec->slot < 0)
+            vcWheel_Schedule(rec, rec->interval);
+        ERROR_CHECK(pthread_cond_broadcast(&shard->idle));
+    }
+    if(--rec->busy == 0 && rec->orphaned)
+        vcParams_Free(rec);
+    SHARD_UNLOCK(shard);
 }
 
 static void* rbusValueChange_pollingThreadFunc(void *userData)
 {
-    (void)(userData);
+    ValueChangeShard* shard = (ValueChangeShard*)userData;
+    size_t i;
+
     RBUSLOG_DEBUG("%s: start", __FUNCTION__);
-    LOCK();
-    while(gVC->running)
+    SHARD_LOCK(shard);
+    rtTime_Later(NULL, gVC->tick, &shard->nextTick);
+    while(shard->running)
     {
-        size_t i;
         int err;
-        rtTime_t timeout;
         rtTimespec_t ts;
+        rtVector notified;
+        rtVector due;
 
-        rtTime_Later(NULL, rbusConfig_Get()->valueChangePeriod, &timeout);
-        
-        err = pthread_cond_timedwait(&gVC->cond, 
-                                    &gVC->mutex, 
-                                    rtTime_ToTimespec(&timeout, &ts));
+        if(shard->numParams == 0)
+        {
+            /*nothing to poll, sleep until a param is added*/
+            ERROR_CHECK(pthread_cond_wait(&shard->cond, &shard->mutex));
+            rtTime_Later(NULL, gVC->tick, &shard->nextTick);
+            continue;
+        }
+
+        err = pthread_cond_timedwait(&shard->cond, 
+                                    &shard->mutex, 
+                                    rtTime_ToTimespec(&shard->nextTick, &ts));
 
         if(err != 0 && err != ETIMEDOUT)
         {
             RBUSLOG_ERROR("Error %d:%s running command pthread_cond_timedwait", err, strerror(err));
         }
         
-        if(!gVC->running)
+        if(!shard->running)
         {
             break;
         }
 
-        for(i=0; i < rtVector_Size(gVC->params); ++i)
+        /*collect the work under the lock*/
+        notified = shard->notified;
+        rtVector_Create(&shard->notified);
+        for(i = 0; i < rtVector_Size(notified); ++i)
         {
-            rbusProperty_t property;
-            rbusValue_t newVal, oldVal;
-
-            ValueChangeRecord* rec = (ValueChangeRecord*)rtVector_At(gVC->params, i);
-            if(!rec)
-                continue;
-
-            rbusProperty_Init(&property,rbusProperty_GetName(rec->property), NULL);
-
-            rbusGetHandlerOptions_t opts;
-            memset(&opts, 0, sizeof(rbusGetHandlerOptions_t));
-            opts.requestingComponent = "valueChangePollThread";
-
-            ELM_PRIVATE_LOCK(rec->node);
-            int result = rec->node->cbTable.getHandler(rec->handle, property, &opts);
-            ELM_PRIVATE_UNLOCK(rec->node);
-
-            if(result != RBUS_ERROR_SUCCESS)
+            ValueChangeRecord* rec = ((ValueChangeNotify*)rtVector_At(notified, i))->rec;
+            rec->busy++;
+            if(!rec->notifies)
             {
-                RBUSLOG_WARN("%s: failed to get current value of %s", __FUNCTION__, rbusProperty_GetName(property));
-                continue;
+                /*from now on polling is only a safety net for this param*/
+                rec->notifies = true;
+                rec->interval = vcPeriodMax();
+                vcWheel_Unschedule(rec);
+                vcWheel_Schedule(rec, rec->interval);
             }
+        }
 
-            char* sValue = rbusValue_ToString(rbusProperty_GetValue(property), NULL, 0);
-            RBUSLOG_DEBUG("%s: %s=%s", __FUNCTION__, rbusProperty_GetName(property), sValue);
-            free(sValue);
-
-            newVal = rbusProperty_GetValue(property);
-            oldVal = rbusProperty_GetValue(rec->property);
-
-            if(rbusValue_Compare(newVal, oldVal))
-            {
-                rbusEvent_t event = {0};
-                rbusObject_t data;
-                rbusValue_t byVal = NULL;
-
-                RBUSLOG_INFO("%s: value change detected for %s", __FUNCTION__, rbusProperty_GetName(rec->property));
-
-                /* The "by" field is set to the component's name which made the last value change.
-                   The source of a value-change could be an external component calling rbus_set or the provider internally updating
-                   the value.  changeComp/changeTime are updated through the rbus_set path, but not through the provider internal path.
-                   We must deduce if the provider has updated the value and reflect that change to the changeComp/changeTime, right here.
-                   If we don't have a changeComp or we do but the changeTime is older then the current polling period,
-                   then we know it was the provider who updated the value we are now detecting.
-                */
-                if(rec->node->changeComp == NULL || 
-                   (rtTime_Elapsed(&rec->node->changeTime, NULL) >= rbusConfig_Get()->valueChangePeriod &&
-                   strcmp(rec->handle->componentName, rec->node->changeComp) == 0))
-                {
-                    printf("VC detected provider-side value-change oldcomp=%s elapsed=%d period=%d\n", rec->node->changeComp, rtTime_Elapsed(&rec->node->changeTime, NULL), rbusConfig_Get()->valueChangePeriod);
-                    setPropertyChangeComponent((elementNode*)rec->node, rec->handle->componentName);
-                }
-
-                rbusObject_Init(&data, NULL);
-                rbusObject_SetValue(data, "value", newVal);
-                rbusObject_SetValue(data, "oldValue", oldVal);
-
-                rbusValue_Init(&byVal);
-                rbusValue_SetString(byVal, rec->node->changeComp);
-                rbusObject_SetValue(data, "by", byVal);
-                rbusValue_Release(byVal);
-
-                event.name = rbusProperty_GetName(rec->property);
-                event.data = data;
-                event.type = RBUS_EVENT_VALUE_CHANGED;
-                result = rbusEvent_Publish(rec->handle, &event);
-
-                rbusObject_Release(data);
-
-                if(result != RBUS_ERROR_SUCCESS)
-                {
-                    RBUSLOG_WARN("%s: rbusEvent_Publish failed with result=%d", __FUNCTION__, result);
-                }
-
-                /*update the record's property with new value*/
-                rbusProperty_SetValue(rec->property, rbusProperty_GetValue(property));
-                rbusProperty_Release(property);
-            }
-            else
+        rtVector_Create(&due);
+        if(rtTime_Compare(&shard->nextTick, NULL) <= 0)
+        {
+            /*if slow getHandlers made us fall behind a whole revolution, don't try to catch up*/
+            if(rtTime_Elapsed(&shard->nextTick, NULL) > gVC->tick * VC_WHEEL_SLOTS)
+                rtTime_Now(&shard->nextTick);
+            while(rtTime_Compare(&shard->nextTick, NULL) <= 0)
             {
-                RBUSLOG_DEBUG("%s: value change not detected for %s", __FUNCTION__, rbusProperty_GetName(rec->property));
-                rbusProperty_Release(property);
+                vcWheel_Tick(shard, due);
+                rtTime_Later(&shard->nextTick, gVC->tick, &shard->nextTick);
             }
         }
+        SHARD_UNLOCK(shard);
+
+        /*poll without the lock so adding, removing and reporting params never waits on a getHandler*/
+        for(i = 0; i < rtVector_Size(notified); ++i)
+        {
+            ValueChangeNotify* n = (ValueChangeNotify*)rtVector_At(notified, i);
+            vcParams_Poll(shard, n->rec, n->value, false);
+        }
+        for(i = 0; i < rtVector_Size(due); ++i)
+        {
+            vcParams_Poll(shard, (ValueChangeRecord*)rtVector_At(due, i), NULL, true);
+        }
+
+        SHARD_LOCK(shard);
+        rtVector_Destroy(due, NULL);
+        rtVector_Destroy(notified, vcNotify_Free);
     }
-    UNLOCK();
+    SHARD_UNLOCK(shard);
     RBUSLOG_DEBUG("%s: stop", __FUNCTION__);
     return NULL;
 }
@@ -247,6 +567,8 @@ static void* rbusValueChange_pollingThreadFunc(void *userData)
 void rbusValueChange_AddPropertyNode(rbusHandle_t handle, elementNode* propNode)
 {
     ValueChangeRecord* rec;
+    ValueChangeShard* shard;
+    int i;
 
     if(!gVC)
     {
@@ -278,26 +600,23 @@ void rbusValueChange_AddPropertyNode(rbusHandle_t handle, elementNode* propNode)
 
     LOCK();//############ LOCK ############
 
-    rec = vcParams_Find(propNode);
+    rec = (ValueChangeRecord*)rtHashMap_Get(gVC->params, propNode);
 
     UNLOCK();//############ UNLOCK ############
 
     if(!rec)
     {
-        rec = (ValueChangeRecord*)rt_malloc(sizeof(ValueChangeRecord));
+        rec = (ValueChangeRecord*)rt_calloc(1, sizeof(ValueChangeRecord));
         rec->handle = handle;
         rec->node = propNode;
+        rec->interval = rbusConfig_Get()->valueChangePeriod;
+        rec->slot = -1;
 
         rbusProperty_Init(&rec->property, propNode->fullName, NULL);
 
-        rbusGetHandlerOptions_t opts;
-        memset(&opts, 0, sizeof(rbusGetHandlerOptions_t));
-        opts.requestingComponent = "valueChangePollThread";
         /*get and cache the current value
           the polling thread will periodically re-get and compare to detect value changes*/
-        ELM_PRIVATE_LOCK(propNode);
-        int result = propNode->cbTable.getHandler(handle, rec->property, &opts);
-        ELM_PRIVATE_UNLOCK(propNode);
+        int result = vcParams_Get(rec, rec->property);
 
         if(result != RBUS_ERROR_SUCCESS)
         {
@@ -306,6 +625,7 @@ void rbusValueChange_AddPropertyNode(rbusHandle_t handle, elementNode* propNode)
             rec = NULL;
             return;
         }
+        rtTime_Now(&rec->lastCheck);
 
         char* sValue;
         RBUSLOG_DEBUG("%s: %s=%s", __FUNCTION__, propNode->fullName, (sValue = rbusValue_ToString(rbusProperty_GetValue(rec->property), NULL, 0)));
@@ -313,15 +633,38 @@ void rbusValueChange_AddPropertyNode(rbusHandle_t handle, elementNode* propNode)
 
         LOCK();//############ LOCK ############
 
-        rtVector_PushBack(gVC->params, rec);
-
-        /* start polling thread if needed */
+        if(rtHashMap_Get(gVC->params, propNode))
+        {
+            /*added by another thread while we got the value*/
+            UNLOCK();//############ UNLOCK ############
+            vcParams_Free(rec);
+            return;
+        }
+        rtHashMap_Set(gVC->params, propNode, rec);
+        rec->next = gVC->records;
+        if(gVC->records)
+            gVC->records->prev = rec;
+        gVC->records = rec;
+
+        /* give it to the least loaded worker, starting it if needed */
+        shard = &gVC->shards[0];
+        for(i = 1; i < gVC->numShards; ++i)
+        {
+            if(gVC->shards[i].numParams < shard->numParams)
+                shard = &gVC->shards[i];
+        }
+        rec->shard = shard;
 
-        if(!gVC->running)
+        SHARD_LOCK(shard);
+        shard->numParams++;
+        vcWheel_Schedule(rec, rec->interval);
+        if(!shard->running)
         {
-            gVC->running = 1;
-            pthread_create(&gVC->thread, NULL, rbusValueChange_pollingThreadFunc, NULL);
+            shard->running = 1;
+            pthread_create(&shard->thread, NULL, rbusValueChange_pollingThreadFunc, shard);
         }
+        ERROR_CHECK(pthread_cond_signal(&shard->cond));
+        SHARD_UNLOCK(shard);
 
         UNLOCK();//############ UNLOCK ############
     }
@@ -330,7 +673,6 @@ void rbusValueChange_AddPropertyNode(rbusHandle_t handle, elementNode* propNode)
 void rbusValueChange_RemovePropertyNode(rbusHandle_t handle, elementNode* propNode)
 {
     ValueChangeRecord* rec;
-    bool stopThread = false;
 
     (void)(handle);
     VERIFY_NULL(propNode);
@@ -342,35 +684,59 @@ void rbusValueChange_RemovePropertyNode(rbusHandle_t handle, elementNode* propNo
     }
 
     LOCK();//############ LOCK ############
-    rec = vcParams_Find(propNode);
+    rec = (ValueChangeRecord*)rtHashMap_Get(gVC->params, propNode);
+    if(rec)
+        vcParams_Unlink(rec);
+    UNLOCK();//############ UNLOCK ############
+
     if(rec)
     {
-        rtVector_RemoveItem(gVC->params, rec, vcParams_Free);
-        /* if there's nothing left to poll then shutdown the polling thread */
-        if(gVC->running && rtVector_Size(gVC->params) == 0)
-        {
-            stopThread = true;
-            gVC->running = 0;
-        }
-        else 
-        {
-            stopThread = false;
-        }
+        vcParams_Remove(rec);
     }
     else
     {
         RBUSLOG_WARN("%s: value change param not found: %s", __FUNCTION__, propNode->fullName);
     }
-    UNLOCK();//############ UNLOCK ############
-    if(stopThread)
+}
+
+void rbusValueChange_NotifyChanged(rbusHandle_t handle, elementNode const* propNode, rbusValue_t value)
+{
+    ValueChangeRecord* rec;
+
+    (void)(handle);
+    VERIFY_NULL(propNode);
+
+    if(!gVC)
+    {
+        return;
+    }
+
+    /*queued for the param's worker; neither lock is held while polling, so the caller never waits on
+      a getHandler and may hold locks its own getHandler needs*/
+    LOCK();//############ LOCK ############
+    rec = (ValueChangeRecord*)rtHashMap_Get(gVC->params, propNode);
+    if(rec)
     {
-        ERROR_CHECK(pthread_cond_signal(&gVC->cond));
-        ERROR_CHECK(pthread_join(gVC->thread, NULL));
+        ValueChangeNotify* n = rt_malloc(sizeof(ValueChangeNotify));
+        n->rec = rec;
+        n->value = value;
+        if(value)
+            rbusValue_Retain(value);
+        SHARD_LOCK(rec->shard);
+        rtVector_PushBack(rec->shard->notified, n);
+        ERROR_CHECK(pthread_cond_signal(&rec->shard->cond));
+        SHARD_UNLOCK(rec->shard);
     }
+    UNLOCK();//############ UNLOCK ############
 }
 
 void rbusValueChange_CloseHandle(rbusHandle_t handle)
 {
+    ValueChangeRecord* rec;
+    rtVector removed;
+    size_t i;
+    int j;
+
     RBUSLOG_DEBUG("%s", __FUNCTION__);
 
     if(!gVC)
@@ -379,47 +745,56 @@ void rbusValueChange_CloseHandle(rbusHandle_t handle)
     }
 
     //remove all params for this bus handle
+    rtVector_Create(&removed);
     LOCK();//############ LOCK ############
-    size_t i = 0;
-    while(i < rtVector_Size(gVC->params))
+    rec = gVC->records;
+    while(rec)
     {
-        ValueChangeRecord* rec = (ValueChangeRecord*)rtVector_At(gVC->params, i);
-        if(rec && rec->handle == handle)
+        ValueChangeRecord* next = rec->next;
+        if(rec->handle == handle)
         {
-            rtVector_RemoveItem(gVC->params, rec, vcParams_Free);
-        }
-        else
-        {
-            //only i++ here because rtVector_RemoveItem does a right shift on all the elements after remove index
-            i++; 
+            vcParams_Unlink(rec);
+            rtVector_PushBack(removed, rec);
         }
+        rec = next;
     }
+    UNLOCK();//############ UNLOCK ############
+    for(i = 0; i < rtVector_Size(removed); ++i)
+        vcParams_Remove((ValueChangeRecord*)rtVector_At(removed, i));
+    rtVector_Destroy(removed, NULL);
 
     //clean up everything once all params are removed
     //but check the size to ensure we do not clean up if params for other rbus handles exist
-    if(rtVector_Size(gVC->params) == 0)
+    LOCK();//############ LOCK ############
+    if(rtHashMap_GetSize(gVC->params) != 0)
     {
-        if(gVC->running)
-        {
-            gVC->running = 0;
-            UNLOCK();//############ UNLOCK ############
-            ERROR_CHECK(pthread_cond_signal(&gVC->cond));
-            ERROR_CHECK(pthread_join(gVC->thread, NULL));
-        }
-        else
-        {
-            UNLOCK();//############ UNLOCK ############
-        }
-        ERROR_CHECK(pthread_mutex_destroy(&gVC->mutex));
-        ERROR_CHECK(pthread_cond_destroy(&gVC->cond));
-        rtVector_Destroy(gVC->params, NULL);
-        gVC->params = NULL;
-        free(gVC);
-        gVC = NULL;
+        UNLOCK();//############ UNLOCK ############
+        return;
     }
-    else
+    UNLOCK();//############ UNLOCK ############
+
+    for(j = 0; j < gVC->numShards; ++j)
     {
-        UNLOCK();//############ UNLOCK ############
+        ValueChangeShard* shard = &gVC->shards[j];
+        int running;
+
+        SHARD_LOCK(shard);
+        running = shard->running;
+        shard->running = 0;
+        ERROR_CHECK(pthread_cond_signal(&shard->cond));
+        SHARD_UNLOCK(shard);
+        if(running)
+            ERROR_CHECK(pthread_join(shard->thread, NULL));
+
+        ERROR_CHECK(pthread_mutex_destroy(&shard->mutex));
+        ERROR_CHECK(pthread_cond_destroy(&shard->cond));
+        ERROR_CHECK(pthread_cond_destroy(&shard->idle));
+        rtVector_Destroy(shard->notified, vcNotify_Free);
+        for(i = 0; i < VC_WHEEL_SLOTS; ++i)
+            rtVector_Destroy(shard->wheel[i], NULL);
     }
+    ERROR_CHECK(pthread_mutex_destroy(&gVC->mutex));
+    rtHashMap_Destroy(gVC->params);
+    free(gVC);
+    gVC = NULL;
 }
-
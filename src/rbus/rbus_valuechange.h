@@ -28,6 +28,7 @@ extern "C" {
 
 void rbusValueChange_AddPropertyNode(rbusHandle_t handle, elementNode* propNode);
 void rbusValueChange_RemovePropertyNode(rbusHandle_t handle, elementNode* propNode);
+void rbusValueChange_NotifyChanged(rbusHandle_t handle, elementNode const* propNode, rbusValue_t value);
 void rbusValueChange_CloseHandle(rbusHandle_t handle);
 
 #ifdef __cplusplus
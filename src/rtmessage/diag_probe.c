@@ -37,6 +37,8 @@ int main(int argc, char * argv[])
             "%-20s - Log routing tree stats.\n"
             "%-20s - Log routing tree topics.\n"
             "%-20s - Log routing tree routes.\n"
+            "%-20s - Log route cache hits and misses.\n"
+            "%-20s - Reset route cache hits and misses.\n"
             "%-20s - Enable bus traffic logging.\n"
             "%-20s - Disable bus traffic logging.\n"
             "%-20s - Dump raw benchmark data to rtrouted logs.\n"
@@ -48,6 +50,8 @@ int main(int argc, char * argv[])
             RTROUTER_DIAG_CMD_LOG_ROUTING_STATS,
             RTROUTER_DIAG_CMD_LOG_ROUTING_TOPICS,
             RTROUTER_DIAG_CMD_LOG_ROUTING_ROUTES,
+            RTROUTER_DIAG_CMD_LOG_ROUTE_CACHE_STATS,
+            RTROUTER_DIAG_CMD_RESET_ROUTE_CACHE_STATS,
             RTROUTER_DIAG_CMD_ENABLE_TRAFFIC_MONITOR,
             RTROUTER_DIAG_CMD_DISABLE_TRAFFIC_MONITOR,
             RTROUTER_DIAG_CMD_DUMP_BENCHMARKING_DATA,
@@ -27,6 +27,7 @@
 #include "rtMessageHeader.h"
 #include "rtSocket.h"
 #include "rtList.h"
+#include "rtVector.h"
 #include "rtRetainable.h"
 #include "rtTime.h"
 #include "rtSemaphore.h"
@@ -60,7 +61,15 @@ typedef volatile int atomic_uint_least32_t;
 #include <sys/types.h>
 #include <sys/time.h>
 
-#define RTMSG_LISTENERS_MAX 64
+/*the low bits of a subscription id are the listener's slot so callbacks can be found without a scan*/
+#define RTMSG_LISTENER_SLOT_BITS 6
+#define RTMSG_LISTENERS_MAX (1 << RTMSG_LISTENER_SLOT_BITS)
+#define RTMSG_CALLBACK_THREADS_MAX 16
+#define RTMSG_PENDING_TABLE_CAPACITY 64
+/*largest encoded rtMessageHeader: fixed fields, round trip times and both topics*/
+#define RTMSG_SEND_HEADER_CAPACITY (52 + 2 * RTMSG_HEADER_MAX_TOPIC_LENGTH)
+/*messages written by one sendmsg, two iovecs each*/
+#define RTMSG_SEND_BATCH_MAX 32
 #ifdef  RDKC_BUILD
 #define RTMSG_SEND_BUFFER_SIZE (1024 * 8)
 #else
@@ -82,8 +91,23 @@ typedef volatile int atomic_uint_least32_t;
 #define DEFAULT_MAX_RETRIES 3
 #endif
 
+#define RTMSG_POOL_BUCKETS (RTCONNECTION_MESSAGE_POOL_BUCKETS - 1)
+
+/*payload capacity of each pooled bucket and how many free buffers each may cache*/
+static const uint32_t rtMessageInfoPool_Capacity[RTMSG_POOL_BUCKETS] = { 256, 1024, 4096, 16384, RTMSG_SEND_BUFFER_SIZE };
+static const uint32_t rtMessageInfoPool_MaxFree[RTMSG_POOL_BUCKETS] = { 32, 16, 8, 4, 2 };
+
 extern char* __progname;
 
+struct _rtMessageInfo;
+
+typedef struct _rtMessageInfoPool
+{
+  pthread_mutex_t                    mutex;
+  struct _rtMessageInfo*             free_list[RTMSG_POOL_BUCKETS];
+  rtConnectionMessagePoolStats       stats;
+} rtMessageInfoPool;
+
 struct _rtListener
 {
   int                     in_use;
@@ -91,15 +115,58 @@ struct _rtListener
   char*                   expression;
   uint32_t                subscription_id;
   rtMessageCallback       callback;
+  rtConnectionCallbackStats stats;
+  rtVector                aliases;  /*aliases the router accepted, re-added on reconnect*/
 };
 
+typedef struct _pending_request
+{
+  uint32_t sequence_number;
+  rtSemaphore sem;                  /*the requesting thread's wait object, shared by its batched requests*/
+  struct _rtMessageInfo* response;
+  int posted;                       /*sem was posted for this request*/
+  struct _pending_request* next;
+  /*asynchronous requests have no waiting thread; they complete through a callback instead*/
+  rtBinaryResponseCallback callback;
+  rtResponseCallback message_callback;
+  void* closure;
+  rtTime_t deadline;
+  struct _pending_request* async_prev;
+  struct _pending_request* async_next;
+}pending_request;
+
+/*requests waiting on a response, hashed by sequence number*/
+typedef struct
+{
+  pending_request**       slots;
+  uint32_t                capacity; /*power of two*/
+  uint32_t                count;
+} rtPendingTable;
+
+/*a message waiting to be written, lives on the sending thread's stack until done*/
+typedef struct _rtSendItem
+{
+  struct iovec            iov[2];
+  uint8_t                 header[RTMSG_SEND_HEADER_CAPACITY];
+  rtError                 err;
+  int                     done;
+  struct _rtSendItem*     next;
+} rtSendItem;
+
+typedef struct _rtCallbackWorker
+{
+  rtConnection            con;
+  pthread_t               thread;
+  pthread_mutex_t         mutex;
+  pthread_cond_t          cond;
+  rtList                  queue;
+} rtCallbackWorker;
+
 struct _rtConnection
 {
   int                     fd;
   struct sockaddr_storage local_endpoint;
   struct sockaddr_storage remote_endpoint;
-  uint8_t*                send_buffer;
-  int                     send_buffer_in_use;
   uint8_t*                recv_buffer;
   int                     recv_buffer_capacity;
   atomic_uint_least32_t   sequence_number;
@@ -109,15 +176,25 @@ struct _rtConnection
   char                    inbox_name[RTMSG_HEADER_MAX_TOPIC_LENGTH];
   struct _rtListener      listeners[RTMSG_LISTENERS_MAX];
   pthread_mutex_t         mutex;
-  rtList                  pending_requests_list;
-  rtList                  callback_message_list;
+  pthread_mutex_t         send_mutex;
+  pthread_cond_t          send_cond;
+  rtSendItem*             send_head;
+  rtSendItem*             send_tail;
+  int                     send_active;  /*a sender is writing the queue*/
+  rtPendingTable          pending_requests;
+  pending_request*        async_requests;   /*asynchronous entries of pending_requests, watched for timeouts*/
+  pthread_t               async_thread;
+  pthread_cond_t          async_cond;
+  rtTime_t                async_wake;       /*when the timeout thread next wakes, if async_wake_set*/
+  int                     async_wake_set;
+  int                     async_thread_started;
+  rtCallbackWorker*       callback_workers;
+  uint32_t                callback_worker_count;
+  rtConnectionCallbackStats callback_stats;
   rtMessageCallback       default_callback;
   void*                   default_closure;
   unsigned int            run_threads;
   pthread_t               reader_thread;
-  pthread_t               callback_thread;
-  pthread_mutex_t         callback_message_mutex;
-  pthread_cond_t          callback_message_cond;
   pthread_mutex_t         reconnect_mutex;
   rtTime_t                reader_reconnect_time;
   rtTime_t                sender_reconnect_time;
@@ -126,12 +203,12 @@ struct _rtConnection
   int                     reconnect_in_progress;
 #ifdef WITH_SPAKE2
   rtCipher*               cipher;
-  uint8_t*                encryption_buffer;
   uint8_t*                decryption_buffer;
   rtMessage               spakeconfig;
   int                     check_remote_router;
 #endif
   pid_t                   read_tid;
+  rtMessageInfoPool       message_pool;
 };
 
 typedef struct _rtMessageInfo
@@ -142,15 +219,12 @@ typedef struct _rtMessageInfo
   uint32_t                dataLength;
   uint32_t                dataCapacity;
   uint8_t*                data;
-  uint8_t                 block1[RTMSG_SEND_BUFFER_SIZE];
+  rtMessageInfoPool*      pool;
+  int                     bucket;   /*index into the pool, RTMSG_POOL_BUCKETS if data is a separate allocation*/
+  struct _rtMessageInfo*  next;     /*link in the pool's free list*/
+  uint8_t                 block1[]; /*dataCapacity bytes when pooled*/
 } rtMessageInfo;
 
-typedef struct 
-{
-  uint32_t sequence_number;
-  rtSemaphore sem;
-  rtMessageInfo* response;
-}pending_request;
 
 typedef struct _rtCallbackMessage
 {
@@ -173,28 +247,130 @@ static inline bool rtConnection_IsSecure(rtConnection con)
 #endif
 }
 
-static void rtMessageInfo_Init(rtMessageInfo** pim)
+static void rtMessageInfoPool_Init(rtMessageInfoPool* pool)
 {
-    (*pim) = rt_try_malloc(sizeof(struct _rtMessageInfo));
-    if(!(*pim))
-      return;
-    (*pim)->retainable.refCount = 0;
-    rtMessageHeader_Init(&(*pim)->header);
-    (*pim)->userData = NULL;
-    (*pim)->dataLength = 0;
-    (*pim)->dataCapacity = RTMSG_SEND_BUFFER_SIZE;
-    (*pim)->data = (*pim)->block1;
-    rtRetainable_retain(*pim);
+  int i;
+  pthread_mutex_init(&pool->mutex, NULL);
+  memset(&pool->stats, 0, sizeof(pool->stats));
+  for(i = 0; i < RTMSG_POOL_BUCKETS; ++i)
+  {
+    pool->free_list[i] = NULL;
+    pool->stats.buckets[i].capacity = rtMessageInfoPool_Capacity[i];
+  }
+}
+
+static void rtMessageInfoPool_Destroy(rtMessageInfoPool* pool)
+{
+  int i;
+  for(i = 0; i < RTMSG_POOL_BUCKETS; ++i)
+  {
+    while(pool->free_list[i])
+    {
+      rtMessageInfo* mi = pool->free_list[i];
+      pool->free_list[i] = mi->next;
+      free(mi);
+    }
+  }
+  pthread_mutex_destroy(&pool->mutex);
+}
+
+/*gets a message with room for payload_length bytes plus a terminating null*/
+static void rtMessageInfo_Init(rtMessageInfoPool* pool, uint32_t payload_length, rtMessageInfo** pim)
+{
+    rtMessageInfo* mi = NULL;
+    rtConnectionMessagePoolBucketStats* stats;
+    int bucket = 0;
+
+    while(bucket < RTMSG_POOL_BUCKETS && rtMessageInfoPool_Capacity[bucket] < payload_length + 1)
+      bucket++;
+    stats = &pool->stats.buckets[bucket];
+
+    pthread_mutex_lock(&pool->mutex);
+    if(bucket < RTMSG_POOL_BUCKETS && pool->free_list[bucket])
+    {
+      mi = pool->free_list[bucket];
+      pool->free_list[bucket] = mi->next;
+      stats->free--;
+      stats->reuses++;
+    }
+    else
+    {
+      stats->allocs++;
+    }
+    if(++stats->in_use > stats->high_water_mark)
+      stats->high_water_mark = stats->in_use;
+    pthread_mutex_unlock(&pool->mutex);
+
+    if(!mi)
+    {
+      if(bucket < RTMSG_POOL_BUCKETS)
+      {
+        mi = rt_try_malloc(sizeof(struct _rtMessageInfo) + rtMessageInfoPool_Capacity[bucket]);
+        if(mi)
+        {
+          mi->dataCapacity = rtMessageInfoPool_Capacity[bucket];
+          mi->data = mi->block1;
+        }
+      }
+      else
+      {
+        mi = rt_try_malloc(sizeof(struct _rtMessageInfo));
+        if(mi)
+        {
+          mi->dataCapacity = payload_length + 1;
+          mi->data = rt_try_malloc(mi->dataCapacity);
+          if(!mi->data)
+          {
+            free(mi);
+            mi = NULL;
+          }
+        }
+      }
+      if(!mi)
+      {
+        pthread_mutex_lock(&pool->mutex);
+        stats->in_use--;
+        pthread_mutex_unlock(&pool->mutex);
+        *pim = NULL;
+        return;
+      }
+      mi->pool = pool;
+      mi->bucket = bucket;
+    }
+
+    mi->retainable.refCount = 0;
+    rtMessageHeader_Init(&mi->header);
+    mi->userData = NULL;
+    mi->dataLength = 0;
+    mi->next = NULL;
+    rtRetainable_retain(mi);
+    *pim = mi;
 }
 
 static void rtMessageInfo_Destroy(rtRetainable* r)
 {
   rtMessageInfo* mi = (rtMessageInfo*)r;
+  rtMessageInfoPool* pool = mi->pool;
+  rtConnectionMessagePoolBucketStats* stats = &pool->stats.buckets[mi->bucket];
 
-  if(mi->data && mi->data != mi->block1)
-    free(mi->data);
+  pthread_mutex_lock(&pool->mutex);
+  stats->in_use--;
+  /*a pooled buffer whose data was handed off to the caller can't be reused*/
+  if(mi->bucket < RTMSG_POOL_BUCKETS && mi->data == mi->block1 && stats->free < rtMessageInfoPool_MaxFree[mi->bucket])
+  {
+    mi->next = pool->free_list[mi->bucket];
+    pool->free_list[mi->bucket] = mi;
+    stats->free++;
+    mi = NULL;
+  }
+  pthread_mutex_unlock(&pool->mutex);
 
-  free(mi);
+  if(mi)
+  {
+    if(mi->data && mi->data != mi->block1)
+      free(mi->data);
+    free(mi);
+  }
 }
 
 static void rtMessageInfo_Release(rtMessageInfo* mi)
@@ -207,6 +383,215 @@ static void rtMessageInfo_ListItemFree(void* p)
     rtMessageInfo_Release((rtMessageInfo*)p);
 }
 
+static void rtPendingTable_Init(rtPendingTable* table)
+{
+  table->slots = (pending_request **) rt_calloc(RTMSG_PENDING_TABLE_CAPACITY, sizeof(pending_request*));
+  table->capacity = RTMSG_PENDING_TABLE_CAPACITY;
+  table->count = 0;
+}
+
+static void rtPendingTable_Destroy(rtPendingTable* table)
+{
+  free(table->slots);
+  table->slots = NULL;
+  table->capacity = 0;
+  table->count = 0;
+}
+
+/*con->mutex must be held for all pending table access*/
+static void rtPendingTable_Grow(rtPendingTable* table)
+{
+  uint32_t capacity = table->capacity * 2;
+  uint32_t i;
+  pending_request** slots = (pending_request **) rt_try_calloc(capacity, sizeof(pending_request*));
+
+  /*keep the current size on failure, chains just get longer*/
+  if (!slots)
+    return;
+
+  for (i = 0; i < table->capacity; ++i)
+  {
+    pending_request* entry = table->slots[i];
+    while (entry)
+    {
+      pending_request* next = entry->next;
+      uint32_t slot = entry->sequence_number & (capacity - 1);
+      entry->next = slots[slot];
+      slots[slot] = entry;
+      entry = next;
+    }
+  }
+  free(table->slots);
+  table->slots = slots;
+  table->capacity = capacity;
+}
+
+static void rtPendingTable_Insert(rtPendingTable* table, pending_request* entry)
+{
+  uint32_t slot;
+
+  if (table->count >= table->capacity)
+    rtPendingTable_Grow(table);
+
+  slot = entry->sequence_number & (table->capacity - 1);
+  entry->next = table->slots[slot];
+  table->slots[slot] = entry;
+  table->count++;
+}
+
+static pending_request* rtPendingTable_Find(rtPendingTable* table, uint32_t sequence_number)
+{
+  pending_request* entry = table->slots[sequence_number & (table->capacity - 1)];
+  while (entry && entry->sequence_number != sequence_number)
+    entry = entry->next;
+  return entry;
+}
+
+static void rtPendingTable_Remove(rtPendingTable* table, pending_request* entry)
+{
+  pending_request** link = &table->slots[entry->sequence_number & (table->capacity - 1)];
+  while (*link && *link != entry)
+    link = &(*link)->next;
+  if (*link)
+  {
+    *link = entry->next;
+    table->count--;
+  }
+}
+
+static pthread_once_t g_wait_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_wait_key;
+
+static void rtConnection_ThreadSemaphoreFree(void* p)
+{
+  rtSemaphore_Destroy((rtSemaphore)p);
+}
+
+static void rtConnection_InitThreadSemaphoreKey()
+{
+  (void) pthread_key_create(&g_wait_key, rtConnection_ThreadSemaphoreFree);
+}
+
+/*each requesting thread keeps one semaphore for all its requests instead of creating one per call*/
+static rtSemaphore rtConnection_GetThreadSemaphore()
+{
+  rtSemaphore sem;
+
+  pthread_once(&g_wait_once, rtConnection_InitThreadSemaphoreKey);
+
+  sem = (rtSemaphore) pthread_getspecific(g_wait_key);
+  if (!sem)
+  {
+    if (rtSemaphore_Create(&sem) != RT_OK)
+      return NULL;
+    pthread_setspecific(g_wait_key, sem);
+  }
+  return sem;
+}
+
+/*consume posts that landed after the waiter stopped waiting so the next request starts clean.
+  con->mutex must not be held: a post the reader has committed to may still be on its way*/
+static void rtConnection_DrainThreadSemaphore(rtSemaphore sem, int count)
+{
+  while (count-- > 0)
+    rtSemaphore_Wait(sem);
+}
+
+/*con->mutex must be held. whoever unlinks an asynchronous entry owns its completion*/
+static void rtConnection_UnlinkAsyncRequest(rtConnection con, pending_request* entry)
+{
+  rtPendingTable_Remove(&con->pending_requests, entry);
+  if (entry->async_prev)
+    entry->async_prev->async_next = entry->async_next;
+  else
+    con->async_requests = entry->async_next;
+  if (entry->async_next)
+    entry->async_next->async_prev = entry->async_prev;
+}
+
+/*con->mutex must not be held, the callback may send*/
+static void rtConnection_CompleteAsyncRequest(pending_request* entry, rtError err, rtMessageInfo* response)
+{
+  if (response && (response->header.flags & rtMessageFlags_Undeliverable))
+    err = RT_OBJECT_NO_LONGER_AVAILABLE;
+
+  if (entry->message_callback)
+  {
+    rtMessage res = NULL;
+    if (err == RT_OK)
+      err = rtMessage_FromBytes(&res, response->data, response->dataLength);
+    entry->message_callback(err, err == RT_OK ? res : NULL, entry->closure);
+    if (res)
+      rtMessage_Release(res);
+  }
+  else if (err == RT_OK)
+  {
+    entry->callback(err, response->data, response->dataLength, entry->closure);
+  }
+  else
+  {
+    entry->callback(err, NULL, 0, entry->closure);
+  }
+
+  if (response)
+    rtMessageInfo_Release(response);
+  free(entry);
+}
+
+/*completes asynchronous requests whose deadline passed, sleeping until the earliest one left*/
+static void * rtConnection_AsyncTimeoutThread(void *data)
+{
+  rtConnection con = (rtConnection)data;
+
+  pthread_mutex_lock(&con->mutex);
+  while (con->run_threads)
+  {
+    pending_request* expired = NULL;
+    pending_request* entry = con->async_requests;
+    rtTime_t now;
+
+    rtTime_Now(&now);
+    con->async_wake_set = 0;
+    while (entry)
+    {
+      pending_request* next = entry->async_next;
+      if (rtTime_Compare(&entry->deadline, &now) <= 0)
+      {
+        rtConnection_UnlinkAsyncRequest(con, entry);
+        entry->async_next = expired;
+        expired = entry;
+      }
+      else if (!con->async_wake_set || rtTime_Compare(&entry->deadline, &con->async_wake) < 0)
+      {
+        con->async_wake = entry->deadline;
+        con->async_wake_set = 1;
+      }
+      entry = next;
+    }
+
+    if (expired)
+    {
+      pthread_mutex_unlock(&con->mutex);
+      while (expired)
+      {
+        entry = expired;
+        expired = expired->async_next;
+        rtLog_Info("rtConnection_SendRequestAsync TIMEOUT");
+        rtConnection_CompleteAsyncRequest(entry, RT_ERROR_TIMEOUT, NULL);
+      }
+      pthread_mutex_lock(&con->mutex);
+      continue;
+    }
+
+    if (con->async_wake_set)
+      pthread_cond_timedwait(&con->async_cond, &con->mutex, &con->async_wake);
+    else
+      pthread_cond_wait(&con->async_cond, &con->mutex);
+  }
+  pthread_mutex_unlock(&con->mutex);
+  return NULL;
+}
+
 static inline bool rtMessageInfo_IsEncrypted(rtMessageInfo* msginfo)
 {
   return msginfo->header.flags & rtMessageFlags_Encrypted;
@@ -244,11 +629,105 @@ rtConnection_SendRequestInternal(
   int32_t timeout, 
   int flags);
 
+static rtError
+rtConnection_SendRequestAsyncInternal(
+  rtConnection con,
+  uint8_t const* pReq,
+  uint32_t nReq,
+  char const* topic,
+  rtBinaryResponseCallback callback,
+  rtResponseCallback message_callback,
+  void* closure,
+  int32_t timeout,
+  int flags);
+
 static uint32_t
-rtConnection_GetNextSubscriptionId()
+rtConnection_GetNextSubscriptionId(int slot)
 {
   static uint32_t next_id = 1;
-  return next_id++;
+  uint32_t id;
+  do
+  {
+    id = (next_id++ << RTMSG_LISTENER_SLOT_BITS) | (uint32_t)slot;
+  } while (id == 0);
+  return id;
+}
+
+/*con->mutex must be held*/
+static struct _rtListener*
+rtConnection_FindListenerById(rtConnection con, uint32_t subscription_id)
+{
+  struct _rtListener* listener = &con->listeners[subscription_id & (RTMSG_LISTENERS_MAX - 1)];
+  if (listener->in_use && listener->subscription_id == subscription_id)
+    return listener;
+  return NULL;
+}
+
+static int
+rtConnection_GetDefaultCallbackThreads()
+{
+  const char* s = getenv("RT_CALLBACK_THREADS");
+  return (s && *s) ? atoi(s) : 1;
+}
+
+static rtError
+rtConnection_CreateCallbackWorkers(rtConnection con, int count, pthread_mutexattr_t* mutex_attribute)
+{
+  int i;
+
+  if (count < 1)
+    count = 1;
+  if (count > RTMSG_CALLBACK_THREADS_MAX)
+    count = RTMSG_CALLBACK_THREADS_MAX;
+
+  con->callback_workers = (rtCallbackWorker *) rt_try_calloc(count, sizeof(rtCallbackWorker));
+  if (!con->callback_workers)
+    return rtErrorFromErrno(ENOMEM);
+
+  for (i = 0; i < count; ++i)
+  {
+    rtCallbackWorker* worker = &con->callback_workers[i];
+    worker->con = con;
+    pthread_mutex_init(&worker->mutex, mutex_attribute);
+    pthread_cond_init(&worker->cond, NULL);
+    rtList_Create(&worker->queue);
+  }
+  con->callback_worker_count = count;
+  con->callback_stats.workers = count;
+  return RT_OK;
+}
+
+static void
+rtConnection_DestroyCallbackWorkers(rtConnection con)
+{
+  uint32_t i;
+
+  for (i = 0; i < con->callback_worker_count; ++i)
+  {
+    rtCallbackWorker* worker = &con->callback_workers[i];
+    rtList_Destroy(worker->queue, rtMessageInfo_ListItemFree);
+    pthread_mutex_destroy(&worker->mutex);
+    pthread_cond_destroy(&worker->cond);
+  }
+  free(con->callback_workers);
+  con->callback_workers = NULL;
+  con->callback_worker_count = 0;
+}
+
+/*messages for the same listener and topic always go to the same worker so they run in order*/
+static rtCallbackWorker*
+rtConnection_GetCallbackWorker(rtConnection con, rtMessageHeader const* hdr)
+{
+  uint32_t hash;
+  char const* p;
+
+  if (con->callback_worker_count == 1)
+    return &con->callback_workers[0];
+
+  hash = 2166136261u ^ hdr->control_data;
+  for (p = hdr->topic; *p; ++p)
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+  return &con->callback_workers[hash % con->callback_worker_count];
 }
 
 static int GetRunThreadsSync(rtConnection con)
@@ -429,7 +908,24 @@ rtConnection_ConnectAndRegister(rtConnection con, rtTime_t* reconnect_time)
       rtConnection_SendMessage(con, m, "_RTROUTED.INBOX.SUBSCRIBE");
       rtMessage_Release(m);
 
-      /*TODO: we need to readd all the aliases too -- would this allow rbus to recover from broker crash ?*/
+      /*re-add the aliases in one message. it isn't sent as a request since this may be the reader thread*/
+      m = NULL;
+      pthread_mutex_lock(&con->mutex);
+      if (con->listeners[i].aliases && rtVector_Size(con->listeners[i].aliases) > 0)
+      {
+        size_t j;
+        rtMessage_Create(&m);
+        rtMessage_SetInt32(m, "add", 1);
+        rtMessage_SetInt32(m, "route_id", con->listeners[i].subscription_id);
+        for (j = 0; j < rtVector_Size(con->listeners[i].aliases); ++j)
+          rtMessage_AddString(m, "topics", (char const*)rtVector_At(con->listeners[i].aliases, j));
+      }
+      pthread_mutex_unlock(&con->mutex);
+      if (m)
+      {
+        rtConnection_SendMessage(con, m, "_RTROUTED.INBOX.SUBSCRIBE");
+        rtMessage_Release(m);
+      }
     }
   }
 
@@ -512,7 +1008,8 @@ rtConnection_ReadUntil(rtConnection con, uint8_t* buff, int count, int32_t timeo
 
 
 static rtError
-rtConnection_CreateInternal(rtConnection* con, char const* application_name, char const* router_config, int max_retries)
+rtConnection_CreateInternal(rtConnection* con, char const* application_name, char const* router_config, int max_retries,
+  int callback_threads)
 {
   int i = 0;
   rtError err = RT_OK;
@@ -527,25 +1024,33 @@ rtConnection_CreateInternal(rtConnection* con, char const* application_name, cha
   pthread_mutexattr_init(&mutex_attribute);
   pthread_mutexattr_settype(&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK);
   if (0 != pthread_mutex_init(&c->mutex, &mutex_attribute) ||
-      0 != pthread_mutex_init(&c->callback_message_mutex, &mutex_attribute) ||
+      0 != pthread_mutex_init(&c->send_mutex, &mutex_attribute) ||
       0 != pthread_mutex_init(&c->reconnect_mutex, &mutex_attribute))
   {
     rtLog_Error("Could not initialize mutex. Cannot create connection.");
     free(c);
     return RT_ERROR;
   }
-  pthread_cond_init(&c->callback_message_cond, NULL);
+  pthread_cond_init(&c->send_cond, NULL);
+  pthread_condattr_t cond_attribute;
+  pthread_condattr_init(&cond_attribute);
+  pthread_condattr_setclock(&cond_attribute, CLOCK_MONOTONIC);
+  pthread_cond_init(&c->async_cond, &cond_attribute);
+  pthread_condattr_destroy(&cond_attribute);
+  if (RT_OK != rtConnection_CreateCallbackWorkers(c, callback_threads, &mutex_attribute))
+  {
+    free(c);
+    return rtErrorFromErrno(ENOMEM);
+  }
+  rtMessageInfoPool_Init(&c->message_pool);
   for (i = 0; i < RTMSG_LISTENERS_MAX; ++i)
   {
     c->listeners[i].in_use = 0;
     c->listeners[i].closure = NULL;
     c->listeners[i].callback = NULL;
     c->listeners[i].subscription_id = 0;
+    c->listeners[i].aliases = NULL;
   }
-  c->send_buffer_in_use = 0;
-  c->send_buffer = (uint8_t *) rt_try_malloc(RTMSG_SEND_BUFFER_SIZE);
-  if(!c->send_buffer)
-    return rtErrorFromErrno(ENOMEM);
   c->recv_buffer = (uint8_t *) rt_try_malloc(RTMSG_SEND_BUFFER_SIZE);
   if(!c->recv_buffer)
     return rtErrorFromErrno(ENOMEM);
@@ -560,8 +1065,7 @@ rtConnection_CreateInternal(rtConnection* con, char const* application_name, cha
   if(c->max_retries == 0)
     c->max_retries = 1;
   c->fd = -1;
-  rtList_Create(&c->pending_requests_list);
-  rtList_Create(&c->callback_message_list);
+  rtPendingTable_Init(&c->pending_requests);
   c->default_callback = NULL;
   c->run_threads = 0;
   c->read_tid = 0;
@@ -569,24 +1073,21 @@ rtConnection_CreateInternal(rtConnection* con, char const* application_name, cha
   rtTime_Now(&c->start_time);
 #ifdef WITH_SPAKE2
   c->cipher = NULL;
-  c->encryption_buffer = NULL;
   c->decryption_buffer = NULL;
 #endif
   memset(c->inbox_name, 0, RTMSG_HEADER_MAX_TOPIC_LENGTH);
   memset(&c->local_endpoint, 0, sizeof(struct sockaddr_storage));
   memset(&c->remote_endpoint, 0, sizeof(struct sockaddr_storage));
-  memset(c->send_buffer, 0, RTMSG_SEND_BUFFER_SIZE);
   memset(c->recv_buffer, 0, RTMSG_SEND_BUFFER_SIZE);
   snprintf(c->inbox_name, RTMSG_HEADER_MAX_TOPIC_LENGTH, "%s.%s.INBOX.%d", c->application_name, __progname, (int) getpid());
   err = rtSocketStorage_FromString(&c->remote_endpoint, router_config);
   if (err != RT_OK)
   {
     rtLog_Warn("failed to parse:%s. %s", router_config, rtStrError(err));
-    free(c->send_buffer);
     free(c->recv_buffer);
     free(c->application_name);
-    rtList_Destroy(c->pending_requests_list,NULL);
-    rtList_Destroy(c->callback_message_list, NULL);
+    rtPendingTable_Destroy(&c->pending_requests);
+    rtConnection_DestroyCallbackWorkers(c);
     free(c);
     return err;
   }
@@ -595,11 +1096,10 @@ rtConnection_CreateInternal(rtConnection* con, char const* application_name, cha
   {
     // TODO: at least log this
     rtLog_Warn("rtConnection_ConnectAndRegister(1):%d", err);
-    free(c->send_buffer);
     free(c->recv_buffer);
     free(c->application_name);
-    rtList_Destroy(c->pending_requests_list,NULL);
-    rtList_Destroy(c->callback_message_list, NULL);
+    rtPendingTable_Destroy(&c->pending_requests);
+    rtConnection_DestroyCallbackWorkers(c);
     free(c);
   }
 
@@ -616,7 +1116,8 @@ rtConnection_CreateInternal(rtConnection* con, char const* application_name, cha
 rtError
 rtConnection_Create(rtConnection* con, char const* application_name, char const* router_config)
 {
-  rtError rt_err = rtConnection_CreateInternal(con, application_name, router_config, DEFAULT_MAX_RETRIES);
+  rtError rt_err = rtConnection_CreateInternal(con, application_name, router_config, DEFAULT_MAX_RETRIES,
+    rtConnection_GetDefaultCallbackThreads());
   if (rt_err)
     *con = NULL;
   return rt_err;
@@ -631,14 +1132,16 @@ rtConnection_CreateWithConfig(rtConnection* con, rtMessage const conf)
   int start_router = 0;
   int max_retries = DEFAULT_MAX_RETRIES;
   int remote_router=0;
+  int callback_threads = rtConnection_GetDefaultCallbackThreads();
 
   rtMessage_GetString(conf, "appname", &application_name);
   rtMessage_GetString(conf, "uri", &router_config);
   rtMessage_GetInt32(conf, "start_router", &start_router);
   rtMessage_GetInt32(conf, "max_retries", &max_retries);
   rtMessage_GetInt32(conf, "check_remote_router",&remote_router);
+  rtMessage_GetInt32(conf, "callback_threads", &callback_threads);
 
-  err = rtConnection_CreateInternal(con, application_name, router_config, max_retries);
+  err = rtConnection_CreateInternal(con, application_name, router_config, max_retries, callback_threads);
   #ifdef WITH_SPAKE2
   (*con)->check_remote_router=remote_router;
   #endif
@@ -672,11 +1175,6 @@ rtConnection_CreateWithConfig(rtConnection* con, rtMessage const conf)
         return err;
       }
 
-      (*con)->encryption_buffer = rt_try_malloc(RTMSG_SEND_BUFFER_SIZE);
-      if(!(*con)->encryption_buffer)
-        return rtErrorFromErrno(ENOMEM);
-      memset((*con)->encryption_buffer, 0, RTMSG_SEND_BUFFER_SIZE);
-
       (*con)->decryption_buffer = rt_try_malloc(RTMSG_SEND_BUFFER_SIZE);
       if(!(*con)->decryption_buffer)
         return rtErrorFromErrno(ENOMEM);
@@ -704,8 +1202,6 @@ rtConnection_Destroy(rtConnection con)
     
     if (con->fd != -1)
       close(con->fd);
-    if (con->send_buffer)
-      free(con->send_buffer);
     if (con->recv_buffer)
       free(con->recv_buffer);
     if (con->application_name)
@@ -713,8 +1209,6 @@ rtConnection_Destroy(rtConnection con)
 #ifdef WITH_SPAKE2
     if (con->cipher)
       rtCipher_Destroy(con->cipher);
-    if (con->encryption_buffer)
-      free(con->encryption_buffer);
     if (con->decryption_buffer)
       free(con->decryption_buffer);
 #endif
@@ -722,24 +1216,37 @@ rtConnection_Destroy(rtConnection con)
     {
       if (con->listeners[i].in_use)
         free(con->listeners[i].expression);
+      if (con->listeners[i].aliases)
+        rtVector_Destroy(con->listeners[i].aliases, rtVector_Cleanup_Free);
     }
     /*Unblock all threads waiting for RPC responses.*/
     pthread_mutex_lock(&con->mutex);
     int found_pending_requests = 0;
 
-    rtListItem listItem;
-    for(rtList_GetFront(con->pending_requests_list, &listItem); 
-        listItem != NULL; 
-        rtListItem_GetNext(listItem, &listItem))
+    /*asynchronous requests have no thread to unblock, complete them now*/
+    while (con->async_requests)
     {
-      pending_request *entry;
-      rtListItem_GetData(listItem, (void**)&entry);
+      pending_request* entry = con->async_requests;
+      rtConnection_UnlinkAsyncRequest(con, entry);
+      pthread_mutex_unlock(&con->mutex);
+      rtConnection_CompleteAsyncRequest(entry, RT_NO_CONNECTION, NULL);
+      pthread_mutex_lock(&con->mutex);
+    }
 
-      found_pending_requests = 1;
-      rtSemaphore_Post(entry->sem);
+    for (i = 0; i < con->pending_requests.capacity; ++i)
+    {
+      pending_request *entry;
+      for (entry = con->pending_requests.slots[i]; entry != NULL; entry = entry->next)
+      {
+        found_pending_requests = 1;
+        if (!entry->posted)
+        {
+          entry->posted = 1;
+          rtSemaphore_Post(entry->sem);
+        }
+      }
     }
-    rtList_Destroy(con->pending_requests_list,NULL);
-    rtList_Destroy(con->callback_message_list, rtMessageInfo_ListItemFree);
+    rtConnection_DestroyCallbackWorkers(con);
     pthread_mutex_unlock(&con->mutex);
     if(0 != found_pending_requests)
     {
@@ -748,10 +1255,13 @@ rtConnection_Destroy(rtConnection con)
       executed in practice. Revisit if necessary. */
     }
 
+    rtPendingTable_Destroy(&con->pending_requests);
     pthread_mutex_destroy(&con->mutex);
-    pthread_mutex_destroy(&con->callback_message_mutex);
-    pthread_cond_destroy(&con->callback_message_cond);
+    pthread_mutex_destroy(&con->send_mutex);
+    pthread_cond_destroy(&con->send_cond);
+    pthread_cond_destroy(&con->async_cond);
     pthread_mutex_destroy(&con->reconnect_mutex);
+    rtMessageInfoPool_Destroy(&con->message_pool);
 
     free(con);
   }
@@ -780,16 +1290,23 @@ rtConnection_SendMessageDirect(rtConnection con, rtMessage msg, char const* topi
     uint32_t n;
     rtError err;
     uint32_t sequence_number;
-    rtMessage_ToByteArrayWithSize(msg, &p, DEFAULT_SEND_BUFFER_SIZE, &n);  /*FIXME unification is this needed ? rtMessage_FreeByteArray(p);*/
+    int flags = 0;
+    rtMessageEncoding encoding = rtMessage_GetDefaultEncoding();
+
+    if(encoding == rtMessageEncoding_Binary)
+    {
+      rtMessage_ToByteArrayWithEncoding(msg, encoding, &p, &n);
+      flags = rtMessageFlags_BinaryEncoded;
+    }
+    else
+      rtMessage_ToByteArrayWithSize(msg, &p, DEFAULT_SEND_BUFFER_SIZE, &n);  /*FIXME unification is this needed ? rtMessage_FreeByteArray(p);*/
 
-    pthread_mutex_lock(&con->mutex);
 #ifdef C11_ATOMICS_SUPPORTED
     sequence_number = atomic_fetch_add_explicit(&con->sequence_number, 1, memory_order_relaxed);
 #else
     sequence_number = __sync_fetch_and_add(&con->sequence_number, 1);
 #endif
-    err = rtConnection_SendInternal(con, p, n, topic, listener, 0, sequence_number, 0, 0, 0);
-    pthread_mutex_unlock(&con->mutex);
+    err = rtConnection_SendInternal(con, p, n, topic, listener, flags, sequence_number, 0, 0, 0);
     rtMessage_FreeByteArray(p);
 
     if(err == RT_NO_CONNECTION)
@@ -812,12 +1329,20 @@ rtConnection_SendRequest(rtConnection con, rtMessage const req, char const* topi
   uint32_t n;
   rtMessageInfo* resMsg;
   rtError err;
+  int flags = 0;
+  rtMessageEncoding encoding = rtMessage_GetDefaultEncoding();
 
   if (!con)
     return rtErrorFromErrno(EINVAL);
 
-  rtMessage_ToByteArrayWithSize(req, &p, DEFAULT_SEND_BUFFER_SIZE, &n);
-  err = rtConnection_SendRequestInternal(con, p, n, topic, &resMsg, timeout, 0);
+  if(encoding == rtMessageEncoding_Binary)
+  {
+    rtMessage_ToByteArrayWithEncoding(req, encoding, &p, &n);
+    flags = rtMessageFlags_BinaryEncoded;
+  }
+  else
+    rtMessage_ToByteArrayWithSize(req, &p, DEFAULT_SEND_BUFFER_SIZE, &n);
+  err = rtConnection_SendRequestInternal(con, p, n, topic, &resMsg, timeout, flags);
   rtMessage_FreeByteArray(p);
   if(err == RT_OK)
   {
@@ -827,6 +1352,31 @@ rtConnection_SendRequest(rtConnection con, rtMessage const req, char const* topi
   return err;
 }
 
+rtError
+rtConnection_SendRequestAsync(rtConnection con, rtMessage const req, char const* topic,
+  rtResponseCallback callback, void* closure, int32_t timeout)
+{
+  uint8_t* p;
+  uint32_t n;
+  rtError err;
+  int flags = 0;
+  rtMessageEncoding encoding = rtMessage_GetDefaultEncoding();
+
+  if (!con || !callback)
+    return rtErrorFromErrno(EINVAL);
+
+  if(encoding == rtMessageEncoding_Binary)
+  {
+    rtMessage_ToByteArrayWithEncoding(req, encoding, &p, &n);
+    flags = rtMessageFlags_BinaryEncoded;
+  }
+  else
+    rtMessage_ToByteArrayWithSize(req, &p, DEFAULT_SEND_BUFFER_SIZE, &n);
+  err = rtConnection_SendRequestAsyncInternal(con, p, n, topic, NULL, callback, closure, timeout, flags);
+  rtMessage_FreeByteArray(p);
+  return err;
+}
+
 rtError
 rtConnection_SendResponse(rtConnection con, rtMessageHeader const* request_hdr, rtMessage const res, int32_t timeout)
 {
@@ -840,12 +1390,18 @@ rtConnection_SendResponse(rtConnection con, rtMessageHeader const* request_hdr,
     rtError err;
     uint8_t* p;
     uint32_t n;
+    int flags = rtMessageFlags_Response;
 
-    rtMessage_ToByteArrayWithSize(res, &p, DEFAULT_SEND_BUFFER_SIZE, &n);
-    pthread_mutex_lock(&con->mutex);
+    /*answer in the encoding the requester used, so older peers keep getting JSON*/
+    if(request_hdr->flags & rtMessageFlags_BinaryEncoded)
+    {
+      rtMessage_ToByteArrayWithEncoding(res, rtMessageEncoding_Binary, &p, &n);
+      flags |= rtMessageFlags_BinaryEncoded;
+    }
+    else
+      rtMessage_ToByteArrayWithSize(res, &p, DEFAULT_SEND_BUFFER_SIZE, &n);
   //TODO: should we send response on reconnect ?
-    err = rtConnection_SendInternal(con, p, n, request_hdr->reply_topic, request_hdr->topic, rtMessageFlags_Response, request_hdr->sequence_number, 0, 0, 0);
-    pthread_mutex_unlock(&con->mutex);
+    err = rtConnection_SendInternal(con, p, n, request_hdr->reply_topic, request_hdr->topic, flags, request_hdr->sequence_number, 0, 0, 0);
     rtMessage_FreeByteArray(p);
 
     if(err == RT_NO_CONNECTION)
@@ -889,9 +1445,7 @@ rtConnection_SendBinaryDirect(rtConnection con, uint8_t const* p, uint32_t n, ch
     sequence_number = __sync_fetch_and_add(&con->sequence_number, 1);
 #endif
 
-    pthread_mutex_lock(&con->mutex);
     err = rtConnection_SendInternal(con, p, n, topic, listener, rtMessageFlags_RawBinary, sequence_number, 0, 0, 0);
-    pthread_mutex_unlock(&con->mutex);
 
     if(err == RT_NO_CONNECTION)
     {
@@ -906,6 +1460,84 @@ rtConnection_SendBinaryDirect(rtConnection con, uint8_t const* p, uint32_t n, ch
   }
 }
 
+rtError
+rtConnection_SendBinaryMulticast(rtConnection con, uint8_t const* p, uint32_t n, char const** listeners,
+  uint32_t count, char const* sender)
+{
+  uint8_t* buff;
+  uint8_t* itr;
+  uint32_t length;
+  uint32_t i;
+  rtError err;
+
+  if (!con || !listeners || count == 0 || count > RTMSG_MULTICAST_MAX_LISTENERS)
+    return rtErrorFromErrno(EINVAL);
+
+  /*the router can only re-encrypt what reaches it encrypted, and internal topics never are*/
+  if (count == 1 || rtConnection_IsSecure(con))
+  {
+    err = RT_OK;
+    for (i = 0; i < count; ++i)
+    {
+      rtError e = rtConnection_SendBinaryDirect(con, p, n, listeners[i], sender);
+      if (e != RT_OK)
+        err = e;
+    }
+    return err;
+  }
+
+  /*payload is the listener count, each listener as a length prefixed string, then the original payload*/
+  length = sizeof(uint32_t) + n;
+  for (i = 0; i < count; ++i)
+  {
+    if (!listeners[i])
+      return rtErrorFromErrno(EINVAL);
+    length += sizeof(uint32_t) + strlen(listeners[i]);
+  }
+
+  buff = rt_try_malloc(length);
+  if (!buff)
+    return rtErrorFromErrno(ENOMEM);
+  itr = buff;
+  rtEncoder_EncodeUInt32(&itr, count);
+  for (i = 0; i < count; ++i)
+    rtEncoder_EncodeString(&itr, listeners[i], NULL);
+  if (n)
+    memcpy(itr, p, n);
+
+  err = rtConnection_SendBinaryDirect(con, buff, length, RTMSG_MULTICAST_DESTINATION, sender);
+  free(buff);
+  return err;
+}
+
+static rtError
+rtMessageInfo_TakeData(rtMessageInfo* mi, uint8_t** p, uint32_t* n)
+{
+  rtError err = RT_OK;
+
+  if(mi->data)
+  {
+    if(mi->data != mi->block1)
+    {
+      *n = mi->dataLength;
+      *p = mi->data;
+      mi->data = NULL; /*pass heap ownership to caller*/
+    }
+    else
+    {
+      /*alloc on heap b/c data will be freed by rtMessageInfo_Release*/
+      *n = mi->dataLength;
+      *p = rt_try_malloc(mi->dataLength);
+      if(*p)
+        memcpy(*p, mi->data, mi->dataLength);
+      else
+        err = rtErrorFromErrno(ENOMEM);
+    }
+  }
+  rtMessageInfo_Release(mi);
+  return err;
+}
+
 rtError
 rtConnection_SendBinaryRequest(rtConnection con, uint8_t const* pReq, uint32_t nReq, char const* topic,
   uint8_t** pRes, uint32_t* nRes, int32_t timeout)
@@ -918,28 +1550,145 @@ rtConnection_SendBinaryRequest(rtConnection con, uint8_t const* pReq, uint32_t n
 
   err = rtConnection_SendRequestInternal(con, pReq, nReq, topic, &mi, timeout, rtMessageFlags_RawBinary);
   if(err == RT_OK)
+    err = rtMessageInfo_TakeData(mi, pRes, nRes);
+  return err;
+}
+
+rtError
+rtConnection_SendBinaryRequestAsync(rtConnection con, uint8_t const* pReq, uint32_t nReq, char const* topic,
+  rtBinaryResponseCallback callback, void* closure, int32_t timeout)
+{
+  if (!con || !callback)
+    return rtErrorFromErrno(EINVAL);
+
+  return rtConnection_SendRequestAsyncInternal(con, pReq, nReq, topic, callback, NULL, closure, timeout,
+    rtMessageFlags_RawBinary);
+}
+
+rtError
+rtConnection_SendBinaryRequests(rtConnection con, uint32_t count, uint8_t const** pReqs, uint32_t const* nReqs,
+  char const** topics, uint8_t** pRes, uint32_t* nRes, rtError* errs, int32_t timeout)
+{
+  pending_request* entries;
+  rtSemaphore sem;
+  rtTime_t start;
+  rtTime_t deadline;
+  uint32_t i;
+  uint32_t outstanding = 0;
+  int posted = 0;
+  int waited = 0;
+  pid_t tid = syscall(__NR_gettid);
+
+  if (!con || !pReqs || !nReqs || !topics || !pRes || !nRes || !errs)
+    return rtErrorFromErrno(EINVAL);
+
+  for (i = 0; i < count; ++i)
+  {
+    pRes[i] = NULL;
+    nRes[i] = 0;
+    errs[i] = RT_ERROR_TIMEOUT;
+  }
+
+  rtTime_Now(&start);
+  rtTime_Later(&start, timeout, &deadline);
+
+  /*nested dispatch reads responses on this thread, one request at a time, within the shared deadline*/
+  if(tid == con->read_tid)
   {
-    if(mi->data)
+    for (i = 0; i < count; ++i)
     {
-      if(mi->data != mi->block1)
-      {
-        *nRes = mi->dataLength;
-        *pRes = mi->data;
-        mi->data = NULL; /*pass heap ownership to caller*/
-      }
+      int remaining = timeout - rtTime_Elapsed(&start, NULL);
+      if(remaining <= 0)
+        break;
+      errs[i] = rtConnection_SendBinaryRequest(con, pReqs[i], nReqs[i], topics[i], &pRes[i], &nRes[i], remaining);
+    }
+    return RT_OK;
+  }
+
+  sem = rtConnection_GetThreadSemaphore();
+  entries = rt_try_malloc(count * sizeof(pending_request));
+  if (!sem || !entries)
+  {
+    free(entries);
+    return rtErrorFromErrno(ENOMEM);
+  }
+
+  /*queue every request before waiting on any, so the destinations work on them concurrently*/
+  pthread_mutex_lock(&con->mutex);
+  for (i = 0; i < count; ++i)
+  {
+#ifdef C11_ATOMICS_SUPPORTED
+    entries[i].sequence_number = atomic_fetch_add_explicit(&con->sequence_number, 1, memory_order_relaxed);
+#else
+    entries[i].sequence_number = __sync_fetch_and_add(&con->sequence_number, 1);
+#endif
+    entries[i].sem = sem;
+    entries[i].response = NULL;
+    entries[i].posted = 0;
+    entries[i].callback = NULL;
+    entries[i].message_callback = NULL;
+    rtPendingTable_Insert(&con->pending_requests, &entries[i]);
+  }
+  pthread_mutex_unlock(&con->mutex);
+
+  for (i = 0; i < count; ++i)
+  {
+    errs[i] = rtConnection_SendInternal(con, pReqs[i], nReqs[i], topics[i], con->inbox_name,
+      rtMessageFlags_Request | rtMessageFlags_RawBinary, entries[i].sequence_number, 0, 0, 0);
+    if (errs[i] == RT_OK)
+      outstanding++;
+  }
+
+  /*every response posts the same semaphore, so count posts until all are in or the deadline passes*/
+  while (waited < (int)outstanding && rtSemaphore_TimedWait(sem, &deadline) == RT_OK)
+    waited++;
+
+  pthread_mutex_lock(&con->mutex);
+  for (i = 0; i < count; ++i)
+  {
+    rtPendingTable_Remove(&con->pending_requests, &entries[i]);
+    posted += entries[i].posted;
+    if (errs[i] == RT_OK)
+    {
+      if (!entries[i].posted)
+        errs[i] = RT_ERROR_TIMEOUT;
+      else if (!entries[i].response)
+        errs[i] = RT_ERROR;
+      else if (entries[i].response->header.flags & rtMessageFlags_Undeliverable)
+        errs[i] = RT_OBJECT_NO_LONGER_AVAILABLE;
+    }
+    if (errs[i] == RT_ERROR_TIMEOUT)
+    {
+      rtLog_Info("rtConnection_SendBinaryRequests TIMEOUT for %s", topics[i]);
+    }
+  }
+  pthread_mutex_unlock(&con->mutex);
+  rtConnection_DrainThreadSemaphore(sem, posted - waited);
+
+  for (i = 0; i < count; ++i)
+  {
+    if (entries[i].response)
+    {
+      if (errs[i] == RT_OK)
+        errs[i] = rtMessageInfo_TakeData(entries[i].response, &pRes[i], &nRes[i]);
       else
-      {
-        /*alloc on heap b/c data will be freed by rtMessageInfo_Release*/
-        *nRes = mi->dataLength;
-        *pRes = rt_try_malloc(mi->dataLength);
-        if(!*pRes)
-          return rtErrorFromErrno(ENOMEM);
-        memcpy(*pRes, mi->data, mi->dataLength);
-      }
+        rtMessageInfo_Release(entries[i].response);
     }
-    rtMessageInfo_Release(mi);
   }
-  return err;
+
+  /*requests lost to a dropped connection go again one by one, reconnecting as the single request path does*/
+  for (i = 0; i < count; ++i)
+  {
+    if (errs[i] == RT_NO_CONNECTION)
+    {
+      int remaining = timeout - rtTime_Elapsed(&start, NULL);
+      if(remaining > 0)
+        errs[i] = rtConnection_SendBinaryRequest(con, pReqs[i], nReqs[i], topics[i], &pRes[i], &nRes[i], remaining);
+    }
+  }
+
+  free(entries);
+  return RT_OK;
 }
 
 rtError
@@ -952,7 +1701,6 @@ rtConnection_SendBinaryResponse(rtConnection con, rtMessageHeader const* request
   if (!con)
     return rtErrorFromErrno(EINVAL);
 
-  pthread_mutex_lock(&con->mutex);
 #ifdef MSG_ROUNDTRIP_TIME
   err = rtConnection_SendInternal(con, p, n, request_hdr->reply_topic, request_hdr->topic,
     rtMessageFlags_Response|rtMessageFlags_RawBinary, request_hdr->sequence_number, request_hdr->T1, request_hdr->T2, request_hdr->T3);
@@ -961,7 +1709,6 @@ rtConnection_SendBinaryResponse(rtConnection con, rtMessageHeader const* request
     rtMessageFlags_Response|rtMessageFlags_RawBinary, request_hdr->sequence_number, 0, 0, 0);
 #endif
 
-  pthread_mutex_unlock(&con->mutex);
   return err;
 }
 
@@ -980,36 +1727,47 @@ rtConnection_SendRequestInternal(rtConnection con, uint8_t const* pReq, uint32_t
     uint32_t n = nReq;
     rtError err;
     uint32_t sequence_number;
-    rtListItem listItem;
+    int waited = 0;
 
     pid_t tid = syscall(__NR_gettid);
 
+    /*Populate the pending request and enqueue it.*/
+    pending_request queue_entry;
+    queue_entry.sem = rtConnection_GetThreadSemaphore();
+    if (!queue_entry.sem)
+      return rtErrorFromErrno(ENOMEM);
+    queue_entry.response = NULL;
+    queue_entry.posted = 0;
+    queue_entry.callback = NULL;
+    queue_entry.message_callback = NULL;
+
     pthread_mutex_lock(&con->mutex);
 #ifdef C11_ATOMICS_SUPPORTED
     sequence_number = atomic_fetch_add_explicit(&con->sequence_number, 1, memory_order_relaxed);
 #else
     sequence_number = __sync_fetch_and_add(&con->sequence_number, 1);
 #endif
-    /*Populate the pending request and enqueue it.*/
-    pending_request queue_entry;
     queue_entry.sequence_number = sequence_number;
-    rtSemaphore_Create(&queue_entry.sem);
-    queue_entry.response = NULL;
 
-    rtList_PushFront(con->pending_requests_list, (void*)&queue_entry, &listItem);
+    rtPendingTable_Insert(&con->pending_requests, &queue_entry);
+    pthread_mutex_unlock(&con->mutex);
+
+    /*the entry is in the table before the request goes out, so the response can't beat it*/
     err = rtConnection_SendInternal(con, p, n, topic, con->inbox_name, rtMessageFlags_Request | flags, sequence_number, 0, 0, 0);
     if (err != RT_OK)
     {
       ret = err;
+      pthread_mutex_lock(&con->mutex);
       goto dequeue_and_continue;
     }
-    pthread_mutex_unlock(&con->mutex);
 
     if(tid != con->read_tid)
     {
       rtTime_t timeout_time;
       rtTime_Later(NULL, timeout, &timeout_time);
       ret = rtSemaphore_TimedWait(queue_entry.sem, &timeout_time); //TODO: handle wake triggered by signals
+      if(ret == RT_OK)
+        waited = 1;
     }
     else
     {
@@ -1020,9 +1778,8 @@ rtConnection_SendRequestInternal(rtConnection con, uint8_t const* pReq, uint32_t
       {
         if((err = rtConnection_Read(con, timeout)) == RT_OK)
         {
-          int sem_value = 0;
-          rtSemaphore_GetValue(queue_entry.sem, &sem_value);
-          if(0 < sem_value)
+          /*responses are read on this thread, so posted is current without the lock*/
+          if(queue_entry.posted)
           {
             ret = RT_OK;
             break;
@@ -1046,6 +1803,7 @@ rtConnection_SendRequestInternal(rtConnection con, uint8_t const* pReq, uint32_t
         else if(err == RT_NO_CONNECTION)
         {
           ret = err;
+          pthread_mutex_lock(&con->mutex);
           goto dequeue_and_continue;
         }
         else
@@ -1056,16 +1814,17 @@ rtConnection_SendRequestInternal(rtConnection con, uint8_t const* pReq, uint32_t
         }
       } while(RT_OK == err);
     }
+    /*held through the dequeue below so the reader can't post the entry after it's checked*/
+    pthread_mutex_lock(&con->mutex);
     if(RT_OK == ret)
     {
       /*Sem posted*/
-      pthread_mutex_lock(&con->mutex);
-
       if(queue_entry.response)
       {
         if(queue_entry.response->header.flags & rtMessageFlags_Undeliverable)
         {
           rtMessageInfo_Release(queue_entry.response);
+          queue_entry.response = NULL;
 
           ret = RT_OBJECT_NO_LONGER_AVAILABLE;
         }
@@ -1084,9 +1843,13 @@ rtConnection_SendRequestInternal(rtConnection con, uint8_t const* pReq, uint32_t
     }
 
 dequeue_and_continue:
-    rtList_RemoveItem(con->pending_requests_list, listItem, NULL);
+    rtPendingTable_Remove(&con->pending_requests, &queue_entry);
     pthread_mutex_unlock(&con->mutex);
-    rtSemaphore_Destroy(queue_entry.sem);
+
+    /*a response that raced the timeout is posted but never taken*/
+    if(ret != RT_OK && queue_entry.response)
+      rtMessageInfo_Release(queue_entry.response);
+    rtConnection_DrainThreadSemaphore(queue_entry.sem, queue_entry.posted - waited);
 
     if(ret == RT_NO_CONNECTION)
     {
@@ -1104,17 +1867,159 @@ dequeue_and_continue:
   }
 }
 
+static rtError
+rtConnection_SendRequestAsyncInternal(rtConnection con, uint8_t const* pReq, uint32_t nReq, char const* topic,
+  rtBinaryResponseCallback callback, rtResponseCallback message_callback, void* closure, int32_t timeout, int flags)
+{
+  pending_request* entry;
+
+  entry = (pending_request *) rt_try_malloc(sizeof(pending_request));
+  if (!entry)
+    return rtErrorFromErrno(ENOMEM);
+  memset(entry, 0, sizeof(pending_request));
+  entry->callback = callback;
+  entry->message_callback = message_callback;
+  entry->closure = closure;
+  rtTime_Later(NULL, timeout, &entry->deadline);
+
+  rtTime_Now(&con->sender_reconnect_time);
+  while(1)
+  {
+    rtError err;
+    uint32_t sequence_number;
+    int completed = 0;
+
+    pthread_mutex_lock(&con->mutex);
+    if (!con->async_thread_started)
+    {
+      if (0 != pthread_create(&con->async_thread, NULL, rtConnection_AsyncTimeoutThread, (void *)con))
+      {
+        pthread_mutex_unlock(&con->mutex);
+        rtLog_Error("Unable to launch async timeout thread.");
+        free(entry);
+        return RT_ERROR;
+      }
+      con->async_thread_started = 1;
+    }
+#ifdef C11_ATOMICS_SUPPORTED
+    sequence_number = atomic_fetch_add_explicit(&con->sequence_number, 1, memory_order_relaxed);
+#else
+    sequence_number = __sync_fetch_and_add(&con->sequence_number, 1);
+#endif
+    entry->sequence_number = sequence_number;
+    rtPendingTable_Insert(&con->pending_requests, entry);
+    entry->async_prev = NULL;
+    entry->async_next = con->async_requests;
+    if (con->async_requests)
+      con->async_requests->async_prev = entry;
+    con->async_requests = entry;
+    /*only wake the timeout thread when this deadline comes before the one it sleeps until*/
+    if (!con->async_wake_set || rtTime_Compare(&entry->deadline, &con->async_wake) < 0)
+      pthread_cond_signal(&con->async_cond);
+    pthread_mutex_unlock(&con->mutex);
+
+    /*from here on the reader or the timeout thread may complete and free the entry*/
+    err = rtConnection_SendInternal(con, pReq, nReq, topic, con->inbox_name, rtMessageFlags_Request | flags,
+      sequence_number, 0, 0, 0);
+    if (err == RT_OK)
+      return RT_OK;
+
+    pthread_mutex_lock(&con->mutex);
+    if (rtPendingTable_Find(&con->pending_requests, sequence_number) == entry)
+      rtConnection_UnlinkAsyncRequest(con, entry);
+    else
+      completed = 1;
+    pthread_mutex_unlock(&con->mutex);
+
+    /*timed out before the send even failed, the callback has already reported it*/
+    if (completed)
+      return RT_OK;
+
+    if (err == RT_NO_CONNECTION)
+    {
+      err = rtConnection_ConnectAndRegister(con, &con->sender_reconnect_time);
+      if (err == RT_OK)
+        continue;
+    }
+
+    free(entry);
+    return err;
+  }
+}
+
+/*write a batch of queued messages with as few sendmsg calls as the socket allows.
+  sets err on every item, the caller marks them done*/
+static void
+rtConnection_WriteBatch(rtConnection con, rtSendItem* batch)
+{
+  struct iovec vec[RTMSG_SEND_BATCH_MAX * 2];
+  struct msghdr send_hdr;
+  rtSendItem* item;
+  int count = 0;
+  int first = 0;
+  int num_attempts = 0;
+  int max_attempts = 3;
+  rtError err = RT_OK;
+
+  for (item = batch; item != NULL; item = item->next)
+  {
+    vec[count++] = item->iov[0];
+    vec[count++] = item->iov[1];
+    item->err = RT_OK;
+  }
+
+  item = batch;
+  while (first < count)
+  {
+    ssize_t bytes_sent;
+
+    memset(&send_hdr, 0, sizeof(send_hdr));
+    send_hdr.msg_iov = &vec[first];
+    send_hdr.msg_iovlen = count - first;
+    bytes_sent = sendmsg(con->fd, &send_hdr, MSG_NOSIGNAL);
+    if (bytes_sent == -1)
+    {
+      err = rtErrorFromErrno(errno);
+      if (errno == EINTR || (!rtConnection_ShouldReregister(err) && num_attempts++ < max_attempts))
+        continue;
+      break;
+    }
+
+    /*skip what went out, which may end part way into an iovec*/
+    while (first < count && (size_t)bytes_sent >= vec[first].iov_len)
+    {
+      bytes_sent -= vec[first].iov_len;
+      if (first++ % 2)
+        item = item->next;
+    }
+    if (first < count)
+    {
+      vec[first].iov_base = (uint8_t *)vec[first].iov_base + bytes_sent;
+      vec[first].iov_len -= bytes_sent;
+    }
+  }
+
+  if (first < count)
+  {
+    if (rtConnection_ShouldReregister(err))
+      err = RT_NO_CONNECTION;
+    for (; item != NULL; item = item->next)
+      item->err = err;
+  }
+}
+
 rtError
 rtConnection_SendInternal(rtConnection con, uint8_t const* buff, uint32_t n, char const* topic,
   char const* reply_topic, int flags, uint32_t sequence_number, uint32_t T1, uint32_t T2, uint32_t T3)
 {
   rtError err;
-  int num_attempts;
-  int max_attempts;
-  ssize_t bytes_sent;
   rtMessageHeader header;
+  rtSendItem send_item;
   uint8_t const* message =NULL;
   uint32_t message_length;
+#ifdef WITH_SPAKE2
+  uint8_t* encryption_buffer = NULL;
+#endif
 
   if (!con)
     return rtErrorFromErrno(EINVAL);
@@ -1130,13 +2035,18 @@ rtConnection_SendInternal(rtConnection con, uint8_t const* buff, uint32_t n, cha
   { 
     rtLog_Debug("encrypting message");
 
-    if ((err = rtCipher_Encrypt(con->cipher, buff, n, con->encryption_buffer, RTMSG_SEND_BUFFER_SIZE, &message_length)) != RT_OK)
+    encryption_buffer = rt_try_malloc(RTMSG_SEND_BUFFER_SIZE);
+    if (!encryption_buffer)
+      return rtErrorFromErrno(ENOMEM);
+
+    if ((err = rtCipher_Encrypt(con->cipher, buff, n, encryption_buffer, RTMSG_SEND_BUFFER_SIZE, &message_length)) != RT_OK)
     {
       rtLog_Error("failed to encrypt payload, not sending message. %s", rtStrError(err));
+      free(encryption_buffer);
       return err;
     }
 
-    message = (uint8_t *)con->encryption_buffer;
+    message = encryption_buffer;
     flags |= rtMessageFlags_Encrypted;
   }
   else
@@ -1146,9 +2056,6 @@ rtConnection_SendInternal(rtConnection con, uint8_t const* buff, uint32_t n, cha
     message_length = n;
   }
 
-  max_attempts = 3;
-  num_attempts = 0;
-
   rtMessageHeader_Init(&header);
   header.payload_length = message_length;
 
@@ -1187,41 +2094,79 @@ rtConnection_SendInternal(rtConnection con, uint8_t const* buff, uint32_t n, cha
   if(1 == g_taint_packets)
     header.flags |= rtMessageFlags_Tainted;
 #endif
-  if(con->send_buffer_in_use)
-    rtLog_Error("send_buffer in use!");
 
-  con->send_buffer_in_use=1;
-  err = rtMessageHeader_Encode(&header, con->send_buffer);
+  /*the header is encoded on this thread's stack so senders only contend for the socket*/
+  err = rtMessageHeader_Encode(&header, send_item.header);
   if (err != RT_OK)
   {
-    con->send_buffer_in_use=0;
+#ifdef WITH_SPAKE2
+    free(encryption_buffer);
+#endif
     return err;
   }
+  send_item.iov[0].iov_base = send_item.header;
+  send_item.iov[0].iov_len = header.header_length;
+  send_item.iov[1].iov_base = (void *)message;
+  send_item.iov[1].iov_len = header.payload_length;
+  send_item.err = RT_OK;
+  send_item.done = 0;
+  send_item.next = NULL;
+
+  /*queue the message. whichever sender finds nobody writing drains the queue for everyone,
+    so messages queued behind a write go out together in one sendmsg*/
+  pthread_mutex_lock(&con->send_mutex);
+  if (con->send_tail)
+    con->send_tail->next = &send_item;
+  else
+    con->send_head = &send_item;
+  con->send_tail = &send_item;
 
-  struct iovec send_vec[] = {{con->send_buffer, header.header_length}, {(void *)message, header.payload_length}};
-  struct msghdr send_hdr = {NULL, 0, send_vec, 2, NULL, 0, 0};
-
-  do
+  while (!send_item.done)
   {
-    err = RT_OK;
-    bytes_sent = sendmsg(con->fd, &send_hdr, MSG_NOSIGNAL);
-    if (bytes_sent != (ssize_t)(header.header_length + header.payload_length))
+    if (con->send_active)
     {
-      if (bytes_sent == -1)
-        err = rtErrorFromErrno(errno);
-      else
-        err = RT_FAIL;
+      pthread_cond_wait(&con->send_cond, &con->send_mutex);
+      continue;
     }
 
-    if (err != RT_OK && rtConnection_ShouldReregister(err))
+    con->send_active = 1;
+    while (con->send_head)
     {
-      con->send_buffer_in_use=0;
-      return RT_NO_CONNECTION;
+      rtSendItem* batch = con->send_head;
+      rtSendItem* last = batch;
+      int count = 1;
+
+      while (last->next && count < RTMSG_SEND_BATCH_MAX)
+      {
+        last = last->next;
+        count++;
+      }
+      con->send_head = last->next;
+      if (!con->send_head)
+        con->send_tail = NULL;
+      last->next = NULL;
+      pthread_mutex_unlock(&con->send_mutex);
+
+      rtConnection_WriteBatch(con, batch);
+
+      pthread_mutex_lock(&con->send_mutex);
+      /*other senders' items belong to their stacks, don't touch one after marking it done*/
+      while (batch)
+      {
+        rtSendItem* next = batch->next;
+        batch->done = 1;
+        batch = next;
+      }
+      pthread_cond_broadcast(&con->send_cond);
     }
+    con->send_active = 0;
   }
-  while ((err != RT_OK) && (num_attempts++ < max_attempts));
-  con->send_buffer_in_use=0;
+  err = send_item.err;
+  pthread_mutex_unlock(&con->send_mutex);
 
+#ifdef WITH_SPAKE2
+  free(encryption_buffer);
+#endif
   return err;
 }
 
@@ -1264,7 +2209,8 @@ rtConnection_AddListener(rtConnection con, char const* expression, rtMessageCall
   }
 
   con->listeners[i].in_use = 1;
-  con->listeners[i].subscription_id = rtConnection_GetNextSubscriptionId();
+  con->listeners[i].subscription_id = rtConnection_GetNextSubscriptionId(i);
+  memset(&con->listeners[i].stats, 0, sizeof(con->listeners[i].stats));
   con->listeners[i].closure = closure;
   con->listeners[i].callback = callback;
   con->listeners[i].expression = strdup(expression);
@@ -1302,6 +2248,11 @@ rtConnection_RemoveListener(rtConnection con, char const* expression)
         con->listeners[i].callback = NULL;
         free(con->listeners[i].expression);
         con->listeners[i].expression = NULL;
+        if (con->listeners[i].aliases)
+        {
+          rtVector_Destroy(con->listeners[i].aliases, rtVector_Cleanup_Free);
+          con->listeners[i].aliases = NULL;
+        }
         break;
     }
   }
@@ -1320,6 +2271,21 @@ rtConnection_RemoveListener(rtConnection con, char const* expression)
   return 0;
 }
 
+static void
+rtConnection_RecordAliases(rtConnection con, int listener, char const** aliases, uint32_t count)
+{
+  uint32_t i;
+  pthread_mutex_lock(&con->mutex);
+  if (con->listeners[listener].in_use)
+  {
+    if (!con->listeners[listener].aliases)
+      rtVector_Create(&con->listeners[listener].aliases);
+    for (i = 0; i < count; ++i)
+      rtVector_PushBack(con->listeners[listener].aliases, strdup(aliases[i]));
+  }
+  pthread_mutex_unlock(&con->mutex);
+}
+
 rtError
 rtConnection_AddAlias(rtConnection con, char const* existing, const char *alias)
 {
@@ -1354,6 +2320,8 @@ rtConnection_AddAlias(rtConnection con, char const* existing, const char *alias)
             rtMessage_Release(res);
         }
         rtMessage_Release(m);
+        if(RT_OK == ret)
+            rtConnection_RecordAliases(con, i, &alias, 1);
         break;
       }
     }
@@ -1385,6 +2353,10 @@ rtConnection_RemoveAlias(rtConnection con, char const* existing, const char *ali
         rtMessage_SetInt32(m, "route_id", con->listeners[i].subscription_id); 
         rtConnection_SendMessage(con, m, "_RTROUTED.INBOX.SUBSCRIBE");
         rtMessage_Release(m);
+        pthread_mutex_lock(&con->mutex);
+        if (con->listeners[i].aliases)
+          rtVector_RemoveItemByCompare(con->listeners[i].aliases, alias, rtVector_Compare_String, rtVector_Cleanup_Free);
+        pthread_mutex_unlock(&con->mutex);
         break;
       }
     }
@@ -1396,6 +2368,107 @@ rtConnection_RemoveAlias(rtConnection con, char const* existing, const char *ali
 
   return 0;
 }
+
+/*routers that predate bulk registration reply without an index, so add the aliases one at a time instead*/
+static rtError
+rtConnection_AddAliasesSerially(rtConnection con, char const* existing, char const** aliases, uint32_t count, int32_t* failed_index)
+{
+  uint32_t i;
+  rtError ret = RT_OK;
+
+  for (i = 0; i < count; ++i)
+  {
+    ret = rtConnection_AddAlias(con, existing, aliases[i]);
+    if (RT_OK != ret)
+      break;
+  }
+  if (RT_OK != ret)
+  {
+    if (failed_index)
+      *failed_index = i;
+    while (i-- > 0)
+      rtConnection_RemoveAlias(con, existing, aliases[i]);
+  }
+  return ret;
+}
+
+rtError
+rtConnection_AddAliases(rtConnection con, char const* existing, char const** aliases, uint32_t count, int32_t* failed_index)
+{
+  int i;
+  uint32_t j;
+  uint32_t route_id = 0;
+  int32_t index = -1;
+  int legacy_router = 0;
+  rtError ret = RT_OK;
+  rtMessage m;
+  rtMessage res;
+
+  if (failed_index)
+    *failed_index = -1;
+  if (!con || !existing || (count > 0 && !aliases))
+    return rtErrorFromErrno(EINVAL);
+  if (count == 0)
+    return RT_OK;
+
+  pthread_mutex_lock(&con->mutex);
+  for (i = 0; i < RTMSG_LISTENERS_MAX; ++i)
+  {
+    if ((1 == con->listeners[i].in_use) && (0 == strcmp(con->listeners[i].expression, existing)))
+    {
+      route_id = con->listeners[i].subscription_id;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&con->mutex);
+
+  if (i >= RTMSG_LISTENERS_MAX)
+    return rtErrorFromErrno(ENOMEM);
+
+  rtMessage_Create(&m);
+  rtMessage_SetInt32(m, "add", 1);
+  rtMessage_SetInt32(m, "route_id", route_id);
+  for (j = 0; j < count; ++j)
+    rtMessage_AddString(m, "topics", aliases[j]);
+  ret = rtConnection_SendRequest(con, m, "_RTROUTED.INBOX.SUBSCRIBE", &res, 6000);
+  rtMessage_Release(m);
+
+  if(RT_OK == ret)
+  {
+    int result = 0;
+    rtMessage_GetInt32(res, "result", &result);
+    if (RT_OK != rtMessage_GetInt32(res, "index", &index))
+    {
+      legacy_router = 1;
+    }
+    else
+    {
+      ret = result;
+      if (RT_OK != ret && index >= 0 && (uint32_t)index < count)
+      {
+        if(RT_ERROR_DUPLICATE_ENTRY == result)
+          rtLog_Error("Failed to register %s. Duplicate entry", aliases[index]);
+        else if (RT_ERROR_PROTOCOL_ERROR == result)
+          rtLog_Error("Failed to register %s because the scaler or table is already registered", aliases[index]);
+        if (failed_index)
+          *failed_index = index;
+      }
+    }
+    rtMessage_Release(res);
+  }
+
+  if (legacy_router)
+  {
+    rtLog_Debug("Router does not support bulk aliases, adding %u aliases serially", count);
+    return rtConnection_AddAliasesSerially(con, existing, aliases, count, failed_index);
+  }
+
+  if (RT_OK == ret)
+    rtConnection_RecordAliases(con, i, aliases, count);
+
+  return ret;
+}
+
 rtError
 rtConnection_AddDefaultListener(rtConnection con, rtMessageCallback callback, void* closure)
 {
@@ -1444,21 +2517,17 @@ rtConnection_Read(rtConnection con, int32_t timeout)
   int num_attempts;
   int max_attempts;
   uint8_t const*  itr;
-  rtMessageInfo* msginfo;
+  rtMessageInfo* msginfo = NULL;
+  rtMessageHeader header;
   rtError err;
 
   num_attempts = 0;
   max_attempts = 4;
 
-  rtMessageInfo_Init(&msginfo);
-  if(!msginfo)
-    return rtErrorFromErrno(ENOMEM);
-
   if (!con)
-  {
-    rtMessageInfo_Release(msginfo);
     return rtErrorFromErrno(EINVAL);
-  }
+
+  rtMessageHeader_Init(&header);
 
   // TODO: no error handling right now, all synch I/O
 
@@ -1476,9 +2545,9 @@ rtConnection_Read(rtConnection con, int32_t timeout)
     if (err == RT_OK)
     {
       itr = &con->recv_buffer[RTMESSAGEHEADER_HDR_LENGTH_OFFSET];
-      rtEncoder_DecodeUInt16(&itr, &msginfo->header.header_length);
+      rtEncoder_DecodeUInt16(&itr, &header.header_length);
       err = rtConnection_ReadUntil(con, con->recv_buffer + RTMESSAGEHEADER_PREAMBLE_LENGTH,
-          (msginfo->header.header_length-RTMESSAGEHEADER_PREAMBLE_LENGTH), timeout);
+          (header.header_length-RTMESSAGEHEADER_PREAMBLE_LENGTH), timeout);
     }
     else
     {
@@ -1492,23 +2561,24 @@ rtConnection_Read(rtConnection con, int32_t timeout)
 
     if (err == RT_OK)
     {
-      err = rtMessageHeader_Decode(&msginfo->header, con->recv_buffer);
+      err = rtMessageHeader_Decode(&header, con->recv_buffer);
     }
 
-    // TODO: need to check for secure message here and decrypt
-    // the msginfo->data and capacity might need to adjusted
-
     if (err == RT_OK)
     {
-      if(msginfo->dataCapacity < msginfo->header.payload_length + 1)
+      /*now that the payload length is known, take a buffer that fits it from the pool*/
+      if(msginfo && msginfo->dataCapacity < header.payload_length + 1)
+      {
+        rtMessageInfo_Release(msginfo);
+        msginfo = NULL;
+      }
+      if(!msginfo)
       {
-        msginfo->data = (uint8_t *)rt_try_malloc(msginfo->header.payload_length + 1);
-        if(!msginfo->data){
-          rtMessageInfo_Release(msginfo);
+        rtMessageInfo_Init(&con->message_pool, header.payload_length, &msginfo);
+        if(!msginfo)
           return rtErrorFromErrno(ENOMEM);
-        }
-        msginfo->dataCapacity = msginfo->header.payload_length + 1;
       }
+      msginfo->header = header;
 
       err = rtConnection_ReadUntil(con, msginfo->data, msginfo->header.payload_length, timeout);
 
@@ -1532,6 +2602,11 @@ rtConnection_Read(rtConnection con, int32_t timeout)
             {
               rtLog_Error("failed to decrypted payload: %s", rtStrError(err));
             }
+            else if (decryptedLength >= msginfo->dataCapacity)
+            {
+              rtLog_Error("decrypted payload too large: %u", decryptedLength);
+              err = RT_FAIL;
+            }
             else
             {
               memcpy(msginfo->data, con->decryption_buffer, decryptedLength);
@@ -1562,29 +2637,39 @@ rtConnection_Read(rtConnection con, int32_t timeout)
     {
       /*response message must be handle right here in this thread
         because rtConnection_SendRequest is waiting on the response.
-        We do not queue responses into the callback_message_list
+        We do not queue responses into the callback worker queues
         because this can lead to lock ups such as RDKB-26837
       */
+      rtSemaphore sem = NULL;
+      pending_request* async_entry = NULL;
+
       pthread_mutex_lock(&con->mutex);
-      rtListItem listItem;
-      for(rtList_GetFront(con->pending_requests_list, &listItem); 
-          listItem != NULL; 
-          rtListItem_GetNext(listItem, &listItem))
+      pending_request* entry = rtPendingTable_Find(&con->pending_requests, msginfo->header.sequence_number);
+      if(entry && (entry->callback || entry->message_callback))
       {
-        pending_request *entry;
-        rtListItem_GetData(listItem, (void**)&entry);
-        if(entry->sequence_number == msginfo->header.sequence_number)
-        {
-          entry->response = msginfo;
-          msginfo = NULL; /*rtConnection_SendRequest thread will release it*/
-          rtSemaphore_Post(entry->sem);
-          break;
-        }
+        rtConnection_UnlinkAsyncRequest(con, entry);
+        async_entry = entry;
+      }
+      else if(entry && !entry->posted)
+      {
+        entry->response = msginfo;
+        entry->posted = 1;
+        msginfo = NULL; /*rtConnection_SendRequest thread will release it*/
+        sem = entry->sem;
       }
       pthread_mutex_unlock(&con->mutex);
+
+      /*the requester drains a committed post before it reuses its semaphore, so posting unlocked is safe*/
+      if(sem)
+        rtSemaphore_Post(sem);
+      if(async_entry)
+      {
+        rtConnection_CompleteAsyncRequest(async_entry, RT_OK, msginfo);
+        msginfo = NULL;
+      }
 #ifdef MSG_ROUNDTRIP_TIME
-      /* The listItem is not present in the pending_requests_list, as it is been removed from the list because of request timeout */
-      if(listItem == NULL)
+      /* The entry is not present in the pending requests, as it is been removed because of request timeout */
+      if(msginfo)
       {
         rtMessage m;
         rtMessage_Create(&m);
@@ -1602,29 +2687,28 @@ rtConnection_Read(rtConnection con, int32_t timeout)
     }
     else
     {
-      /*request message must be dispatched to the Callback thread*/
+      /*request message must be dispatched to a Callback thread*/
       rtListItem listItem;
+      struct _rtListener* listener;
+      rtCallbackWorker* worker = rtConnection_GetCallbackWorker(con, &msginfo->header);
 
-      pthread_mutex_lock(&con->callback_message_mutex);
+      pthread_mutex_lock(&con->mutex);
+      listener = rtConnection_FindListenerById(con, msginfo->header.control_data);
+      if (listener && ++listener->stats.queue_length > listener->stats.high_water_mark)
+        listener->stats.high_water_mark = listener->stats.queue_length;
+      if (++con->callback_stats.queue_length > con->callback_stats.high_water_mark)
+        con->callback_stats.high_water_mark = con->callback_stats.queue_length;
+      pthread_mutex_unlock(&con->mutex);
 
-      rtList_PushBack(con->callback_message_list, msginfo, &listItem);
-      msginfo = NULL; /*the callback thread will release it*/
+      pthread_mutex_lock(&worker->mutex);
 
-      /*log something if the callback thread isn't processing fast enough*/
-      size_t size;
-      rtList_GetSize(con->callback_message_list, &size);
-      if(size >= 5)
-      {
-        if(size == 5 || size == 10 || size == 20 || size == 40 || size == 80)
-          rtLog_Debug("callback_message_list has reached %lu", (unsigned long)size);
-        else if(size >= 100)
-          rtLog_Debug("callback_message_list has reached %lu", (unsigned long)size);
-      }
+      rtList_PushBack(worker->queue, msginfo, &listItem);
+      msginfo = NULL; /*the callback thread will release it*/
 
       /*wake the callback thread up to process new message*/
-      pthread_cond_signal(&con->callback_message_cond);
+      pthread_cond_signal(&worker->cond);
 
-      pthread_mutex_unlock(&con->callback_message_mutex);
+      pthread_mutex_unlock(&worker->mutex);
     }
   }
 
@@ -1694,7 +2778,8 @@ void check_router(rtConnection con)
 */
 static void * rtConnection_CallbackThread(void *data)
 {
-  rtConnection con = (rtConnection)data;
+  rtCallbackWorker* worker = (rtCallbackWorker*)data;
+  rtConnection con = worker->con;
   rtLog_Debug("Callback thread started");
 
   while (1 == GetRunThreadsSync(con))
@@ -1702,41 +2787,39 @@ static void * rtConnection_CallbackThread(void *data)
     size_t size;
     rtListItem listItem;
 
-    pthread_mutex_lock(&con->callback_message_mutex);
+    pthread_mutex_lock(&worker->mutex);
 
     /*Must check run_threads after lock in order to stay synced with rtConnection_StopThreads*/
     if (0 == GetRunThreadsSync(con))
     {
-      pthread_mutex_unlock(&con->callback_message_mutex);
+      pthread_mutex_unlock(&worker->mutex);
       break;
     }
 
-    rtList_GetSize(con->callback_message_list, &size);
+    rtList_GetSize(worker->queue, &size);
 
     if (size == 0)
     {
-      //rtLog_Error("Callback thread before wait");
-      pthread_cond_wait(&con->callback_message_cond, &con->callback_message_mutex);
-      //rtLog_Error("Callback thread after wait");
+      pthread_cond_wait(&worker->cond, &worker->mutex);
     }
 
     /*get first item to handle*/
-    rtList_GetFront(con->callback_message_list, &listItem);
+    rtList_GetFront(worker->queue, &listItem);
 
-    pthread_mutex_unlock(&con->callback_message_mutex);
+    pthread_mutex_unlock(&worker->mutex);
 
     if (0 == GetRunThreadsSync(con))
     {
       break;
     }
-    /*Execute listener callbacks for all messages in callback_message_list.
+    /*Execute listener callbacks for all messages in the worker's queue.
       Remove messages from list as you go and return once the list is empty.
       Very important to not keep any mutex lock while executing the callback*/
     while(listItem != NULL)
     {
-      int i;
       rtMessageInfo* msginfo = NULL;
       rtMessageCallback callback = NULL;
+      struct _rtListener* listener;
 
       rtListItem_GetData(listItem, (void**)&msginfo);
 
@@ -1750,14 +2833,11 @@ static void * rtConnection_CallbackThread(void *data)
       }
 
       /*find the listener for the msg*/
-      for (i = 0; i < RTMSG_LISTENERS_MAX; ++i)
+      listener = rtConnection_FindListenerById(con, msginfo->header.control_data);
+      if (listener)
       {
-        if (con->listeners[i].in_use && (con->listeners[i].subscription_id == msginfo->header.control_data))
-        {
-          callback = con->listeners[i].callback;
-          msginfo->userData = con->listeners[i].closure;
-          break;
-        }
+        callback = listener->callback;
+        msginfo->userData = listener->closure;
       }
 
       pthread_mutex_unlock(&con->mutex);
@@ -1765,28 +2845,32 @@ static void * rtConnection_CallbackThread(void *data)
       /*process the message without locking any mutex*/
       if(callback)
       {
-          //rtLog_Error("rtConnection_CallbackThread before callback");
           callback(&msginfo->header, msginfo->data, msginfo->dataLength, msginfo->userData);
-          //rtLog_Error("rtConnection_CallbackThread after callback");
       }
-      else
+
+      pthread_mutex_lock(&con->mutex);
+      /*the listener may have been removed, and its slot reused, while the callback ran*/
+      listener = rtConnection_FindListenerById(con, msginfo->header.control_data);
+      if (listener && listener->stats.queue_length)
       {
-        //rtLog_Error("rtConnection_CallbackThread no callback found for message");
+        listener->stats.queue_length--;
+        if (callback)
+          listener->stats.dispatched++;
       }
+      con->callback_stats.queue_length--;
+      if (callback)
+        con->callback_stats.dispatched++;
+      pthread_mutex_unlock(&con->mutex);
 
-      pthread_mutex_lock(&con->callback_message_mutex);
+      pthread_mutex_lock(&worker->mutex);
 
       /*remove item. pass NULL so data can be reused*/
-      rtList_RemoveItem(con->callback_message_list, listItem, rtMessageInfo_ListItemFree);
+      rtList_RemoveItem(worker->queue, listItem, rtMessageInfo_ListItemFree);
 
       /*get next item to handle from front*/
-      rtList_GetFront(con->callback_message_list, &listItem);
-
-      size_t size;
-      rtList_GetSize(con->callback_message_list, &size);
-      //rtLog_Error("Remove callback_message_list size=%d", size);
+      rtList_GetFront(worker->queue, &listItem);
 
-      pthread_mutex_unlock(&con->callback_message_mutex);
+      pthread_mutex_unlock(&worker->mutex);
     }
   }
   rtLog_Debug("Callback thread exiting");
@@ -1855,6 +2939,7 @@ static void * rtConnection_ReaderThread(void *data)
 static int rtConnection_StartThreads(rtConnection con)
 {
   int ret = 0;
+  uint32_t i;
 
   if (!con)
     return rtErrorFromErrno(EINVAL);
@@ -1868,10 +2953,13 @@ static int rtConnection_StartThreads(rtConnection con)
       ret = RT_ERROR;
     }
 
-    if(0 != pthread_create(&con->callback_thread, NULL, rtConnection_CallbackThread, (void *)con))
+    for (i = 0; i < con->callback_worker_count; ++i)
     {
-      rtLog_Error("Unable to launch callback thread.");
-      ret = RT_ERROR;
+      if(0 != pthread_create(&con->callback_workers[i].thread, NULL, rtConnection_CallbackThread, &con->callback_workers[i]))
+      {
+        rtLog_Error("Unable to launch callback thread.");
+        ret = RT_ERROR;
+      }
     }
   }
   return ret;
@@ -1881,14 +2969,26 @@ static int rtConnection_StopThreads(rtConnection con)
 {
   rtLog_Info("Stopping threads");
 
+  uint32_t i;
+
   SetRunThreadsSync(con, 0);
 
-  pthread_mutex_lock(&con->callback_message_mutex);
-  pthread_cond_signal(&con->callback_message_cond);
-  pthread_mutex_unlock(&con->callback_message_mutex);
+  for (i = 0; i < con->callback_worker_count; ++i)
+  {
+    pthread_mutex_lock(&con->callback_workers[i].mutex);
+    pthread_cond_signal(&con->callback_workers[i].cond);
+    pthread_mutex_unlock(&con->callback_workers[i].mutex);
+  }
+
+  pthread_mutex_lock(&con->mutex);
+  pthread_cond_signal(&con->async_cond);
+  pthread_mutex_unlock(&con->mutex);
 
   pthread_join(con->reader_thread, NULL);
-  pthread_join(con->callback_thread, NULL);
+  for (i = 0; i < con->callback_worker_count; ++i)
+    pthread_join(con->callback_workers[i].thread, NULL);
+  if (con->async_thread_started)
+    pthread_join(con->async_thread, NULL);
   return 0;
 }
 
@@ -1907,6 +3007,54 @@ rtConnection_Dispatch(rtConnection con)
   return RT_OK;
 }
 
+rtError
+rtConnection_GetMessagePoolStats(rtConnection con, rtConnectionMessagePoolStats* stats)
+{
+  if (!con || !stats)
+    return rtErrorFromErrno(EINVAL);
+
+  pthread_mutex_lock(&con->message_pool.mutex);
+  *stats = con->message_pool.stats;
+  pthread_mutex_unlock(&con->message_pool.mutex);
+  return RT_OK;
+}
+
+rtError
+rtConnection_GetCallbackStats(rtConnection con, rtConnectionCallbackStats* stats)
+{
+  if (!con || !stats)
+    return rtErrorFromErrno(EINVAL);
+
+  pthread_mutex_lock(&con->mutex);
+  *stats = con->callback_stats;
+  pthread_mutex_unlock(&con->mutex);
+  return RT_OK;
+}
+
+rtError
+rtConnection_GetListenerStats(rtConnection con, char const* expression, rtConnectionCallbackStats* stats)
+{
+  int i;
+
+  if (!con || !expression || !stats)
+    return rtErrorFromErrno(EINVAL);
+
+  pthread_mutex_lock(&con->mutex);
+  for (i = 0; i < RTMSG_LISTENERS_MAX; ++i)
+  {
+    if ((con->listeners[i].in_use) && (0 == strcmp(expression, con->listeners[i].expression)))
+    {
+      *stats = con->listeners[i].stats;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&con->mutex);
+
+  if (i >= RTMSG_LISTENERS_MAX)
+    return RT_ERROR_INVALID_ARG;
+  return RT_OK;
+}
+
 void
 _rtConnection_TaintMessages(int i)
 {
@@ -27,6 +27,8 @@
 
 #define RTMSG_DEFAULT_ROUTER_LOCATION "tcp://127.0.0.1:10001"
 #define RTROUTED_TRANSACTION_TIME_INFO "TransactionTime"
+#define RTMSG_MULTICAST_DESTINATION "_RTROUTED.INBOX.MULTICAST"
+#define RTMSG_MULTICAST_MAX_LISTENERS 1024
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,6 +39,42 @@ typedef struct _rtConnection* rtConnection;
 
 typedef void (*rtMessageCallback)(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure);
 
+/* Completion of an asynchronous request. res (or p and n) is only valid during the call and
+ * is NULL unless err is RT_OK. */
+typedef void (*rtResponseCallback)(rtError err, rtMessage res, void* closure);
+typedef void (*rtBinaryResponseCallback)(rtError err, uint8_t const* p, uint32_t n, void* closure);
+
+/* Inbound messages are read into buffers recycled from a per connection pool,
+ * bucketed by payload size. The last bucket counts payloads too large to pool. */
+#define RTCONNECTION_MESSAGE_POOL_BUCKETS 6
+
+typedef struct
+{
+  uint32_t capacity;        /* payload bytes a buffer in this bucket holds, 0 for the unpooled bucket */
+  uint32_t in_use;          /* buffers currently held by queued or in progress messages */
+  uint32_t high_water_mark; /* largest in_use seen */
+  uint32_t free;            /* buffers cached for reuse */
+  uint64_t allocs;          /* buffers that had to be allocated */
+  uint64_t reuses;          /* buffers taken from the cache */
+} rtConnectionMessagePoolBucketStats;
+
+typedef struct
+{
+  rtConnectionMessagePoolBucketStats buckets[RTCONNECTION_MESSAGE_POOL_BUCKETS];
+} rtConnectionMessagePoolStats;
+
+/* Listener messages are dispatched by one callback thread unless the connection
+ * is created with more (the "callback_threads" config or RT_CALLBACK_THREADS).
+ * With several threads, messages for the same listener and topic still run in
+ * the order received; different topics may run concurrently. */
+typedef struct
+{
+  uint32_t workers;         /* callback threads, 0 for a listener's stats */
+  uint32_t queue_length;    /* messages queued or being dispatched */
+  uint32_t high_water_mark; /* largest queue_length seen */
+  uint64_t dispatched;      /* messages handed to a callback */
+} rtConnectionCallbackStats;
+
 typedef enum
 {
   rtConnectionState_ReadHeaderPreamble,
@@ -57,7 +95,7 @@ rtConnection_Create(rtConnection* con, char const* application_name, char const*
 /**
  * Creates an rtConnection from a Config file
  * @param con
- * @param conf
+ * @param conf appname, uri, max_retries and optionally callback_threads
  * @return error
  */
 rtError
@@ -109,6 +147,23 @@ rtError
 rtConnection_SendRequest(rtConnection con, rtMessage const req, char const* topic,
   rtMessage* res, int32_t timeout);
 
+/**
+ * Sends a request without waiting for the response, so one thread can keep many requests
+ * in flight. The callback runs exactly once if the request was sent: on the reader thread
+ * when the response arrives, or with RT_ERROR_TIMEOUT once the timeout passes. It should
+ * return quickly as no other message is read while it runs.
+ * @param con
+ * @param req
+ * @param topic
+ * @param callback
+ * @param closure
+ * @param timeout
+ * @return error if the request could not be sent, in which case the callback is not run
+ */
+rtError
+rtConnection_SendRequestAsync(rtConnection con, rtMessage const req, char const* topic,
+  rtResponseCallback callback, void* closure, int32_t timeout);
+
 /**
  * Sends a response to a request
  * @param con
@@ -147,6 +202,22 @@ rtConnection_SendBinary(rtConnection con, uint8_t const* p, uint32_t n, char con
 rtError
 rtConnection_SendBinaryDirect(rtConnection con, uint8_t const* p, uint32_t n, char const* topic, char const* listener);
 
+/**
+ * Send the same binary payload to several listeners with a single write. The router
+ * forwards one copy of the payload to each listener as if rtConnection_SendBinaryDirect
+ * had been called once per listener, with the listener as topic and sender as reply topic.
+ * @param con
+ * @param pointer to buffer
+ * @param length of buffer
+ * @param listeners to deliver to
+ * @param number of listeners, at most RTMSG_MULTICAST_MAX_LISTENERS
+ * @param sender
+ * @return error
+ */
+rtError
+rtConnection_SendBinaryMulticast(rtConnection con, uint8_t const* p, uint32_t n, char const** listeners,
+  uint32_t count, char const* sender);
+
 /**
  * Sends a request and receive a response
  * @param con
@@ -160,6 +231,39 @@ rtError
 rtConnection_SendBinaryRequest(rtConnection con, uint8_t const* pReq, uint32_t nReq, char const* topic,
   uint8_t** pRes, uint32_t* nRes, int32_t timeout);
 
+/**
+ * Sends a request without waiting for the response, see rtConnection_SendRequestAsync
+ * @param con
+ * @param pointer to buffer
+ * @param length of buffer
+ * @param topic
+ * @param callback
+ * @param closure
+ * @param timeout
+ * @return error if the request could not be sent, in which case the callback is not run
+ */
+rtError
+rtConnection_SendBinaryRequestAsync(rtConnection con, uint8_t const* pReq, uint32_t nReq, char const* topic,
+  rtBinaryResponseCallback callback, void* closure, int32_t timeout);
+
+/**
+ * Sends several requests before waiting on any of them, then collects the responses
+ * by sequence number against one overall deadline
+ * @param con
+ * @param count the number of requests
+ * @param pReqs the request payloads
+ * @param nReqs the request payload lengths
+ * @param topics the destination of each request
+ * @param pRes receives each response, to be freed with rtMessage_FreeByteArray
+ * @param nRes receives each response length
+ * @param errs receives the outcome of each request
+ * @param timeout the deadline for all responses, in milliseconds
+ * @return error if the requests could not be attempted; per request errors are in errs
+ */
+rtError
+rtConnection_SendBinaryRequests(rtConnection con, uint32_t count, uint8_t const** pReqs, uint32_t const* nReqs,
+  char const** topics, uint8_t** pRes, uint32_t* nRes, rtError* errs, int32_t timeout);
+
 /**
  * Sends a response to a request
  * @param con
@@ -217,6 +321,20 @@ rtConnection_AddAlias(rtConnection con, char const* existing, const char *alias)
 rtError
 rtConnection_RemoveAlias(rtConnection con, char const* existing, const char *alias);
 
+/**
+ * Add several aliases to an existing listener with one request to the router.
+ * Either all of them are added or none are.
+ * @param con
+ * @param existing listener
+ * @param aliases
+ * @param count the number of aliases
+ * @param failed_index set to the alias that was rejected, or -1. may be NULL
+ * @return error
+ */
+rtError
+rtConnection_AddAliases(rtConnection con, char const* existing, char const** aliases, uint32_t count,
+  int32_t* failed_index);
+
 /**
  * Register a callback for message receipt
  * @param con
@@ -243,6 +361,34 @@ rtConnection_GetReturnAddress(rtConnection con);
 rtError
 rtConnection_Dispatch(rtConnection con);
 
+/**
+ * Get usage of the pool of buffers inbound messages are read into.
+ * @param con
+ * @param stats filled with a snapshot of each bucket
+ * @return error
+ */
+rtError
+rtConnection_GetMessagePoolStats(rtConnection con, rtConnectionMessagePoolStats* stats);
+
+/**
+ * Get the depth of the queue feeding the listener callbacks.
+ * @param con
+ * @param stats filled with totals over all listeners
+ * @return error
+ */
+rtError
+rtConnection_GetCallbackStats(rtConnection con, rtConnectionCallbackStats* stats);
+
+/**
+ * Get the depth of the callback queue for a single listener.
+ * @param con
+ * @param expression the expression passed to rtConnection_AddListener
+ * @param stats filled with the listener's counts
+ * @return error
+ */
+rtError
+rtConnection_GetListenerStats(rtConnection con, char const* expression, rtConnectionCallbackStats* stats);
+
 /*Private declarations below*/
 rtError
 _rtConnection_ReadAndDropBytes(int fd, unsigned int bytes_to_read);
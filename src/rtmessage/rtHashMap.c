@@ -49,11 +49,9 @@ struct _rtHashMap
 
 static rtVector rtHashMap_GetBucket(rtHashMap hashmap, const void* key)
 {
+    /*the built-in hashers already reduce to the bucket count, custom ones may return any value*/
     uint32_t hash = hashmap->key_hasher(hashmap, key);
-    if(rtVector_Size(hashmap->buckets) > (size_t)hash)
-        return rtVector_At(hashmap->buckets, hash);
-    else
-        return NULL;
+    return rtVector_At(hashmap->buckets, hash % rtVector_Size(hashmap->buckets));
 }
 
 int rtHashMap_Compare_Node(const void* left, const void* right)
@@ -275,8 +273,9 @@ int rtHashMap_Remove(rtHashMap hashmap, const void* key)
     {
         hashmap->size--;
         size_t nbuckets = rtVector_Size(hashmap->buckets);
+        /*only shrink once well under the load factor, so alternating set/remove doesn't resize every time*/
         if(nbuckets > RTHASHMAP_INITSIZE)
-            if(hashmap->size / nbuckets/ 2.0f < hashmap->load_factor)
+            if(hashmap->size / (float)nbuckets < hashmap->load_factor / 4)
                 rtHashMap_Resize(hashmap, 0);
         return 1;
     }
@@ -315,6 +314,23 @@ int rtHashMap_Compare_Func_String(const void* left, const void* right)
   }
 }
 
+uint32_t rtHashMap_Hash_Func_Pointer(rtHashMap hashmap, const void* key)
+{
+    uint64_t hash = (uintptr_t)key;
+    /*mix the address so the always-zero alignment bits don't leave buckets unused*/
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return (uint32_t)(hash % rtVector_Size(hashmap->buckets));
+}
+
+int rtHashMap_Compare_Func_Pointer(const void* left, const void* right)
+{
+    if(left == right)
+        return 0;
+    return left < right ? -1 : 1;
+}
+
 const void* rtHashMap_Copy_Func_String(const void* data)
 {
     return strdup(data);
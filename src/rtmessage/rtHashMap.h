@@ -31,6 +31,7 @@ extern "C" {
 struct _rtHashMap;
 typedef struct _rtHashMap* rtHashMap;
 
+/*the hash is reduced modulo the map's bucket count, so a hasher can return any 32 bit value*/
 typedef uint32_t (*rtHashMap_Hash_Func)(rtHashMap, const void*);
 typedef int (*rtHashMap_Compare_Func)(const void *, const void *);
 typedef const void* (*rtHashMap_Copy_Func)(const void *);
@@ -55,6 +56,8 @@ int rtHashMap_Remove(rtHashMap hashmap, const void* key);
 
 uint32_t rtHashMap_Hash_Func_String(rtHashMap hashmap, const void* key);
 int rtHashMap_Compare_Func_String(const void* left, const void* right);
+uint32_t rtHashMap_Hash_Func_Pointer(rtHashMap hashmap, const void* key);
+int rtHashMap_Compare_Func_Pointer(const void* left, const void* right);
 const void* rtHashMap_Copy_Func_String(const void* data);
 void rtHashMap_Destroy_Func_Free(void* data);
 
@@ -62,6 +62,8 @@ static rtListItem rtList_GetFreeItem(rtList list)
 
 static void rtList_SetFreeItem(rtList list, rtListItem item)
 {
+  /*items removed without a destroyer must not hand their data to rtList_Destroy later*/
+  item->data = NULL;
   if(list->free)
   {
     list->free->prev = item;
@@ -37,6 +37,367 @@ struct _rtMessage
   atomic_int count;
 };
 
+/*
+  Binary encoding of a message. The fields are still held in a cJSON tree,
+  only the bytes on the wire differ:
+    marker(0xB5) version(1) count { name value }
+  where count and lengths are varints, name is length + bytes,
+  and value is a type byte followed by:
+    null/false/true  nothing
+    int              zigzag varint
+    double           8 bytes, little endian IEEE 754
+    string           length + bytes
+    array            count { value }
+    object           count { name value }
+  A JSON encoded message always starts with '{', so the first byte tells
+  rtMessage_FromBytes which decoder to use.
+*/
+#define RTMSG_BINARY_MARKER 0xB5
+#define RTMSG_BINARY_VERSION 1
+#define RTMSG_BINARY_MAX_DEPTH 32
+
+typedef enum
+{
+  rtMessageBinaryType_Null = 0,
+  rtMessageBinaryType_False,
+  rtMessageBinaryType_True,
+  rtMessageBinaryType_Int,
+  rtMessageBinaryType_Double,
+  rtMessageBinaryType_String,
+  rtMessageBinaryType_Array,
+  rtMessageBinaryType_Object
+} rtMessageBinaryType;
+
+typedef struct
+{
+  uint8_t* data;
+  uint32_t length;
+  uint32_t capacity;
+} rtMessageWriter;
+
+typedef struct
+{
+  uint8_t const* itr;
+  uint8_t const* end;
+  char* scratch;        /*null terminated copy of the last name or string read*/
+  uint32_t scratch_capacity;
+} rtMessageReader;
+
+static pthread_once_t g_encoding_once = PTHREAD_ONCE_INIT;
+static rtMessageEncoding g_default_encoding = rtMessageEncoding_JSON;
+
+static void rtMessage_InitDefaultEncoding(void)
+{
+  const char* s = getenv("RT_MESSAGE_ENCODING");
+  if (s && strcasecmp(s, "binary") == 0)
+    g_default_encoding = rtMessageEncoding_Binary;
+}
+
+static int rtMessageWriter_Reserve(rtMessageWriter* w, uint32_t n)
+{
+  if (w->length + n > w->capacity)
+  {
+    uint32_t capacity = w->capacity ? w->capacity : 256;
+    uint8_t* data;
+    while (capacity < w->length + n)
+      capacity *= 2;
+    data = (uint8_t *) realloc(w->data, capacity);
+    if (!data)
+      return -1;
+    w->data = data;
+    w->capacity = capacity;
+  }
+  return 0;
+}
+
+static int rtMessageWriter_PutByte(rtMessageWriter* w, uint8_t b)
+{
+  if (rtMessageWriter_Reserve(w, 1) != 0)
+    return -1;
+  w->data[w->length++] = b;
+  return 0;
+}
+
+static int rtMessageWriter_PutVarint(rtMessageWriter* w, uint64_t n)
+{
+  if (rtMessageWriter_Reserve(w, 10) != 0)
+    return -1;
+  while (n >= 0x80)
+  {
+    w->data[w->length++] = (uint8_t)(n | 0x80);
+    n >>= 7;
+  }
+  w->data[w->length++] = (uint8_t)n;
+  return 0;
+}
+
+static int rtMessageWriter_PutString(rtMessageWriter* w, char const* s)
+{
+  uint32_t n = s ? (uint32_t) strlen(s) : 0;
+  if (rtMessageWriter_PutVarint(w, n) != 0 || rtMessageWriter_Reserve(w, n) != 0)
+    return -1;
+  if (n)
+    memcpy(w->data + w->length, s, n);
+  w->length += n;
+  return 0;
+}
+
+static int rtMessageWriter_PutItem(rtMessageWriter* w, cJSON const* item, int named, int depth);
+
+static int rtMessageWriter_PutChildren(rtMessageWriter* w, cJSON const* parent, int named, int depth)
+{
+  cJSON const* child;
+  uint32_t count = 0;
+
+  if (depth > RTMSG_BINARY_MAX_DEPTH)
+    return -1;
+  for (child = parent->child; child; child = child->next)
+    count++;
+  if (rtMessageWriter_PutVarint(w, count) != 0)
+    return -1;
+  for (child = parent->child; child; child = child->next)
+  {
+    if (rtMessageWriter_PutItem(w, child, named, depth) != 0)
+      return -1;
+  }
+  return 0;
+}
+
+static int rtMessageWriter_PutItem(rtMessageWriter* w, cJSON const* item, int named, int depth)
+{
+  if (named && rtMessageWriter_PutString(w, item->string) != 0)
+    return -1;
+
+  switch (item->type & 0xFF)
+  {
+    case cJSON_False:
+      return rtMessageWriter_PutByte(w, rtMessageBinaryType_False);
+    case cJSON_True:
+      return rtMessageWriter_PutByte(w, rtMessageBinaryType_True);
+    case cJSON_Number:
+    {
+      double d = item->valuedouble;
+      /*whole numbers, which is nearly all of them, go as varints*/
+      if (d >= -9007199254740992.0 && d <= 9007199254740992.0 && d == (double)(int64_t)d)
+      {
+        int64_t i = (int64_t)d;
+        if (rtMessageWriter_PutByte(w, rtMessageBinaryType_Int) != 0)
+          return -1;
+        return rtMessageWriter_PutVarint(w, ((uint64_t)i << 1) ^ (uint64_t)(i >> 63));
+      }
+      else
+      {
+        uint64_t bits;
+        int i;
+        memcpy(&bits, &d, sizeof(bits));
+        if (rtMessageWriter_PutByte(w, rtMessageBinaryType_Double) != 0 || rtMessageWriter_Reserve(w, 8) != 0)
+          return -1;
+        for (i = 0; i < 8; ++i)
+          w->data[w->length++] = (uint8_t)(bits >> (8 * i));
+        return 0;
+      }
+    }
+    case cJSON_String:
+      if (rtMessageWriter_PutByte(w, rtMessageBinaryType_String) != 0)
+        return -1;
+      return rtMessageWriter_PutString(w, item->valuestring);
+    case cJSON_Array:
+      if (rtMessageWriter_PutByte(w, rtMessageBinaryType_Array) != 0)
+        return -1;
+      return rtMessageWriter_PutChildren(w, item, 0, depth + 1);
+    case cJSON_Object:
+      if (rtMessageWriter_PutByte(w, rtMessageBinaryType_Object) != 0)
+        return -1;
+      return rtMessageWriter_PutChildren(w, item, 1, depth + 1);
+    default:
+      return rtMessageWriter_PutByte(w, rtMessageBinaryType_Null);
+  }
+}
+
+static int rtMessageReader_GetVarint(rtMessageReader* r, uint64_t* n)
+{
+  int shift = 0;
+  *n = 0;
+  while (r->itr < r->end && shift < 64)
+  {
+    uint8_t b = *r->itr++;
+    *n |= (uint64_t)(b & 0x7F) << shift;
+    if (!(b & 0x80))
+      return 0;
+    shift += 7;
+  }
+  return -1;
+}
+
+/*reads a length prefixed string into the reader's scratch buffer*/
+static int rtMessageReader_GetString(rtMessageReader* r)
+{
+  uint64_t n;
+  if (rtMessageReader_GetVarint(r, &n) != 0 || n > (uint64_t)(r->end - r->itr))
+    return -1;
+  if (n + 1 > r->scratch_capacity)
+  {
+    char* scratch = (char *) realloc(r->scratch, n + 1);
+    if (!scratch)
+      return -1;
+    r->scratch = scratch;
+    r->scratch_capacity = n + 1;
+  }
+  memcpy(r->scratch, r->itr, n);
+  r->scratch[n] = '\0';
+  r->itr += n;
+  return 0;
+}
+
+static cJSON* rtMessageReader_GetItem(rtMessageReader* r, int depth);
+
+static int rtMessageReader_GetChildren(rtMessageReader* r, cJSON* parent, int named, int depth)
+{
+  uint64_t count;
+  uint64_t i;
+
+  if (depth > RTMSG_BINARY_MAX_DEPTH || rtMessageReader_GetVarint(r, &count) != 0)
+    return -1;
+  /*every child takes at least a byte, so a larger count can only be corrupt*/
+  if (count > (uint64_t)(r->end - r->itr))
+    return -1;
+  for (i = 0; i < count; ++i)
+  {
+    cJSON* child;
+    char namebuf[64];
+    char* name = namebuf;
+
+    if (named)
+    {
+      /*the child may reuse the scratch buffer, so keep the name aside; field names
+        are short so this rarely needs the heap*/
+      if (rtMessageReader_GetString(r) != 0)
+        return -1;
+      if (strlen(r->scratch) < sizeof(namebuf))
+        strcpy(namebuf, r->scratch);
+      else if (!(name = strdup(r->scratch)))
+        return -1;
+    }
+    child = rtMessageReader_GetItem(r, depth);
+    if (!child)
+    {
+      if (name != namebuf)
+        free(name);
+      return -1;
+    }
+    if (named)
+    {
+      cJSON_AddItemToObject(parent, name, child);
+      if (name != namebuf)
+        free(name);
+    }
+    else
+    {
+      cJSON_AddItemToArray(parent, child);
+    }
+  }
+  return 0;
+}
+
+static cJSON* rtMessageReader_GetItem(rtMessageReader* r, int depth)
+{
+  cJSON* item = NULL;
+  uint8_t type;
+
+  if (r->itr >= r->end)
+    return NULL;
+  type = *r->itr++;
+
+  switch (type)
+  {
+    case rtMessageBinaryType_Null:
+      return cJSON_CreateNull();
+    case rtMessageBinaryType_False:
+      return cJSON_CreateFalse();
+    case rtMessageBinaryType_True:
+      return cJSON_CreateTrue();
+    case rtMessageBinaryType_Int:
+    {
+      uint64_t n;
+      if (rtMessageReader_GetVarint(r, &n) != 0)
+        return NULL;
+      return cJSON_CreateNumber((double)(int64_t)((n >> 1) ^ (~(n & 1) + 1)));
+    }
+    case rtMessageBinaryType_Double:
+    {
+      uint64_t bits = 0;
+      double d;
+      int i;
+      if (r->end - r->itr < 8)
+        return NULL;
+      for (i = 0; i < 8; ++i)
+        bits |= (uint64_t)(*r->itr++) << (8 * i);
+      memcpy(&d, &bits, sizeof(d));
+      return cJSON_CreateNumber(d);
+    }
+    case rtMessageBinaryType_String:
+      if (rtMessageReader_GetString(r) != 0)
+        return NULL;
+      return cJSON_CreateString(r->scratch);
+    case rtMessageBinaryType_Array:
+      item = cJSON_CreateArray();
+      break;
+    case rtMessageBinaryType_Object:
+      item = cJSON_CreateObject();
+      break;
+    default:
+      return NULL;
+  }
+
+  if (item && rtMessageReader_GetChildren(r, item, type == rtMessageBinaryType_Object, depth + 1) != 0)
+  {
+    cJSON_Delete(item);
+    item = NULL;
+  }
+  return item;
+}
+
+static cJSON* rtMessage_DecodeBinary(uint8_t const* bytes, int n)
+{
+  rtMessageReader r;
+  cJSON* json;
+
+  if (n < 2 || bytes[1] != RTMSG_BINARY_VERSION)
+    return NULL;
+
+  r.itr = bytes + 2;
+  r.end = bytes + n;
+  r.scratch = NULL;
+  r.scratch_capacity = 0;
+
+  json = cJSON_CreateObject();
+  if (json && rtMessageReader_GetChildren(&r, json, 1, 0) != 0)
+  {
+    cJSON_Delete(json);
+    json = NULL;
+  }
+  free(r.scratch);
+  return json;
+}
+
+static rtError rtMessage_EncodeBinary(rtMessage message, uint8_t** buff, uint32_t* n)
+{
+  rtMessageWriter w = { NULL, 0, 0 };
+
+  if (rtMessageWriter_PutByte(&w, RTMSG_BINARY_MARKER) != 0 ||
+      rtMessageWriter_PutByte(&w, RTMSG_BINARY_VERSION) != 0 ||
+      rtMessageWriter_PutChildren(&w, message->json, 1, 0) != 0)
+  {
+    free(w.data);
+    *buff = NULL;
+    *n = 0;
+    return RT_FAIL;
+  }
+  *buff = w.data;
+  *n = w.length;
+  return RT_OK;
+}
+
 /**
  * Allocate storage and initializes it as new message
  * @param pointer to the new message
@@ -84,8 +445,6 @@ rtMessage_Clone(rtMessage const message, rtMessage* copy)
 rtError
 rtMessage_FromBytes(rtMessage* message, uint8_t const* bytes, int n)
 {
-  (void) n;
-
   #if 0
   printf("------------------------------------------\n")
   for (i = 0; i < 256; ++i)
@@ -102,7 +461,10 @@ rtMessage_FromBytes(rtMessage* message, uint8_t const* bytes, int n)
   *message = (rtMessage) rt_try_malloc(sizeof(struct _rtMessage));
   if(!*message)
     return rtErrorFromErrno(ENOMEM);
-  (*message)->json = cJSON_Parse((char *) bytes);
+  if (n > 0 && bytes[0] == RTMSG_BINARY_MARKER)
+    (*message)->json = rtMessage_DecodeBinary(bytes, n);
+  else
+    (*message)->json = cJSON_Parse((char *) bytes);
   if (!(*message)->json)
   {
     free(*message);
@@ -160,6 +522,34 @@ rtMessage_ToByteArrayWithSize(rtMessage message, uint8_t** buff, uint32_t sugges
 #endif
 }
 
+rtError
+rtMessage_ToByteArrayWithEncoding(rtMessage message, rtMessageEncoding encoding, uint8_t** buff, uint32_t* n)
+{
+  if (!message || !message->json)
+  {
+    *buff = NULL;
+    *n = 0;
+    return RT_FAIL;
+  }
+  if (encoding == rtMessageEncoding_Binary)
+    return rtMessage_EncodeBinary(message, buff, n);
+  return rtMessage_ToByteArrayWithSize(message, buff, 1024, n);
+}
+
+void
+rtMessage_SetDefaultEncoding(rtMessageEncoding encoding)
+{
+  pthread_once(&g_encoding_once, rtMessage_InitDefaultEncoding);
+  g_default_encoding = encoding;
+}
+
+rtMessageEncoding
+rtMessage_GetDefaultEncoding(void)
+{
+  pthread_once(&g_encoding_once, rtMessage_InitDefaultEncoding);
+  return g_default_encoding;
+}
+
 rtError
 rtMessage_FreeByteArray(uint8_t* buff)
 {
@@ -542,9 +932,8 @@ rtMessage_GetStringItem(rtMessage const m, char const* name, int32_t idx, char c
   cJSON* obj = cJSON_GetObjectItem(m->json, name);
   if (!obj)
     return RT_PROPERTY_NOT_FOUND;
-  if (idx >= cJSON_GetArraySize(obj))
-    return RT_FAIL;
 
+  /*NULL when idx is out of range, which saves walking the array a second time to size it*/
   cJSON* item = cJSON_GetArrayItem(obj, idx);
   if (item)
   {
@@ -31,6 +31,14 @@ extern "C" {
 struct _rtMessage;
 typedef struct _rtMessage* rtMessage;
 
+/* Wire format used when a message is converted to bytes.
+ * rtMessage_FromBytes reads either one. */
+typedef enum
+{
+  rtMessageEncoding_JSON = 0,   /* text, readable by every version */
+  rtMessageEncoding_Binary = 1  /* compact binary, needs a peer with this version or later */
+} rtMessageEncoding;
+
 /**
  * Allocate storage and initializes it as new message
  * @param pointer to the new message
@@ -81,7 +89,34 @@ rtError
 rtMessage_ToByteArrayWithSize(rtMessage message, uint8_t** buff, uint32_t suggested_size, uint32_t* n);
 
 /**
- * Free the buffer allocated by rtMessage_ToByteArray or rtMessage_ToByteArrayWithSize
+ * Extract the data from a message as a byte sequence in the given encoding.
+ * @param extract the data bytes from this message.
+ * @param encoding to use
+ * @param pointer to the byte sequence location
+ * @param pointer to number of bytes in the message
+ * @return rtError
+ **/
+rtError
+rtMessage_ToByteArrayWithEncoding(rtMessage message, rtMessageEncoding encoding, uint8_t** buff, uint32_t* n);
+
+/**
+ * Set the encoding rtConnection uses for messages it sends, other than responses
+ * which always use the encoding of the request. Defaults to rtMessageEncoding_JSON,
+ * or rtMessageEncoding_Binary if the RT_MESSAGE_ENCODING environment variable is "binary".
+ * @param encoding to use
+ **/
+void
+rtMessage_SetDefaultEncoding(rtMessageEncoding encoding);
+
+/**
+ * Get the encoding rtConnection uses for messages it sends
+ * @return encoding
+ **/
+rtMessageEncoding
+rtMessage_GetDefaultEncoding(void);
+
+/**
+ * Free the buffer allocated by rtMessage_ToByteArray, rtMessage_ToByteArrayWithSize or rtMessage_ToByteArrayWithEncoding
  * @param pointer to the byte sequence to free
  * @return rtError
  **/
@@ -48,7 +48,8 @@ typedef enum
   rtMessageFlags_Undeliverable = 0x04,
   rtMessageFlags_Tainted = 0x08,
   rtMessageFlags_RawBinary = 0x10,
-  rtMessageFlags_Encrypted = 0x20
+  rtMessageFlags_Encrypted = 0x20,
+  rtMessageFlags_BinaryEncoded = 0x40 /* payload is an rtMessage in rtMessageEncoding_Binary */
 } rtMessageFlags;
 
 typedef struct
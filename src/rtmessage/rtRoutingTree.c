@@ -30,12 +30,25 @@
 #include <stdarg.h>
 #include <ctype.h>
 
+#define RTROUTINGTREE_MAX_TOPIC_LENGTH 512
+#define RTROUTINGTREE_MAX_TOKENS 32
+#define RTROUTINGTREE_CHILDMAP_MIN 8    /*number of children at which a topic starts indexing them by name*/
+#define RTROUTINGTREE_CACHE_MAX 1024    /*number of topics in the route cache before it is emptied and refilled*/
+
 typedef struct Token
 {
     char const* name;
     int length;
 } Token;
 
+/*tokenizer storage, owned by the caller so lookups share no state*/
+typedef struct TokenList
+{
+    char buffer[RTROUTINGTREE_MAX_TOPIC_LENGTH];
+    Token tokens[RTROUTINGTREE_MAX_TOKENS];
+    int count;
+} TokenList;
+
 typedef struct rtRoutingTreeStats
 {
     size_t numTopics;                      /*number of rtTreeTopic in the tree, including intermediate routes*/
@@ -44,15 +57,56 @@ typedef struct rtRoutingTreeStats
     size_t numRoutes;                      /*number of unique routes registered in the tree*/
 } rtRoutingTreeStats;
 
-static char workBuffer[512];
-static Token workTokens[32];
-static int workTokenCount = 0;
-
 static int rtList_ComparePointer(const void *left, const void *right)
 {
   return !(left == right);
 }
 
+/*childMap keys are the children's own names, so the map neither copies nor frees them*/
+static const void* childMapKeyCopy(const void* key)
+{
+    return key;
+}
+
+static void childMapKeyDestroy(void* key)
+{
+    (void)key;
+}
+
+static void addChildToMap(rtTreeTopic* parent, rtTreeTopic* child)
+{
+    size_t numChildren = 0;
+
+    if(!parent->childMap)
+    {
+        rtListItem item;
+
+        rtList_GetSize(parent->childList, &numChildren);
+        if(numChildren < RTROUTINGTREE_CHILDMAP_MIN)
+            return;
+
+        rtHashMap_CreateEx(&parent->childMap, 0, NULL, NULL, childMapKeyCopy, childMapKeyDestroy, NULL, NULL);
+        rtList_GetFront(parent->childList, &item);
+        while(item)
+        {
+            rtTreeTopic* treeTopic;
+            rtListItem_GetData(item, (void**)&treeTopic);
+            rtHashMap_Set(parent->childMap, treeTopic->name, treeTopic);
+            rtListItem_GetNext(item, &item);
+        }
+    }
+    else
+    {
+        rtHashMap_Set(parent->childMap, child->name, child);
+    }
+}
+
+static void removeChildFromMap(rtTreeTopic* parent, rtTreeTopic* child)
+{
+    if(parent->childMap)
+        rtHashMap_Remove(parent->childMap, child->name);
+}
+
 static rtTreeTopic* createTreeTopic(const char* name, rtTreeTopic* parent)
 {
     rtTreeTopic* treeTopic = rt_calloc(1, sizeof(struct rtTreeTopic));
@@ -70,6 +124,7 @@ static rtTreeTopic* createTreeTopic(const char* name, rtTreeTopic* parent)
     if(!parent->childList)
         rtList_Create(&parent->childList);
     rtList_PushBack(parent->childList, treeTopic, NULL);
+    addChildToMap(parent, treeTopic);
 
     /*Flag the parent as table if this is a '{i}' child.
       This assume that { is only used for tables.
@@ -89,6 +144,8 @@ static void freeTreeTopic(void* p)
     rtTreeTopic* treeTopic = p;
     if(treeTopic->childList)
         rtList_Destroy(treeTopic->childList, freeTreeTopic);
+    if(treeTopic->childMap)
+        rtHashMap_Destroy(treeTopic->childMap);
     if(treeTopic->routeList)
         rtList_Destroy(treeTopic->routeList, NULL);
     if(treeTopic->routeList2)
@@ -108,25 +165,38 @@ static void freeTreeRoute(void* p)
     free(route);
 }
 
-static void tokenizeExpression(const char* expression)
+/*returns 0 on success, or -1 with no tokens if the expression doesn't fit in the TokenList*/
+static int tokenizeExpression(const char* expression, TokenList* tokens)
 {
     int i = 0;
     const char* from = expression;
-    char* to = workBuffer;
-    workTokenCount = 0;
+    char* to = tokens->buffer;
+    char* end = tokens->buffer + sizeof(tokens->buffer);
+    tokens->count = 0;
     while(*from)
     {
-        workTokens[i].name = to;
-        
-        while(*from && *from != '.')
+        if(i == RTROUTINGTREE_MAX_TOKENS)
+        {
+            rtLog_Warn("%s: too many tokens in %s", __FUNCTION__, expression);
+            return -1;
+        }
+        tokens->tokens[i].name = to;
+
+        while(*from && *from != '.' && to < end)
             *to++ = *from++;
-        workTokens[i].length = to - workTokens[i].name;
+        if(to == end)
+        {
+            rtLog_Warn("%s: expression too long %s", __FUNCTION__, expression);
+            return -1;
+        }
+        tokens->tokens[i].length = to - tokens->tokens[i].name;
         *to++ = 0;
         if(*from == '.')
             from++;
         i++;
     }
-    workTokenCount = i;
+    tokens->count = i;
+    return 0;
 }
 
 static void removeTopicFromRoutes(rtRoutingTree rt, rtTreeTopic* topic)
@@ -165,7 +235,37 @@ static rtTreeTopic* getChildByName(rtRoutingTree rt, rtTreeTopic* parent, const
 
     if(created)
         *created = 0;
-    rtList_GetFront(parent->childList, &item);
+
+    if(parent->childMap)
+    {
+        /*a topic with a '{' child has no other children and never gets a map,
+          so only an exact match or the '{' sibling error below can apply here*/
+        rtTreeTopic* treeTopic = rtHashMap_Get(parent->childMap, name);
+        if(treeTopic)
+        {
+            if(remove)
+            {
+                removeTopicFromRoutes(rt, treeTopic);
+                removeChildFromMap(parent, treeTopic);
+                rtList_RemoveItemByCompare(parent->childList, treeTopic, rtList_ComparePointer, freeTreeTopic);
+                return NULL;
+            }
+            return treeTopic;
+        }
+        if(name[0] == '{')
+        {
+            if(error)
+                *error = 1;
+            rtList_GetFront(parent->childList, &item);
+            rtListItem_GetData(item, (void**)&treeTopic);
+            return treeTopic;
+        }
+        item = NULL;
+    }
+    else
+    {
+        rtList_GetFront(parent->childList, &item);
+    }
 
     while(item)
     {
@@ -177,6 +277,7 @@ static rtTreeTopic* getChildByName(rtRoutingTree rt, rtTreeTopic* parent, const
             if(remove)
             {
               removeTopicFromRoutes(rt, treeTopic);
+              removeChildFromMap(parent, treeTopic);
               rtList_RemoveItem(parent->childList, item, freeTreeTopic);
               return NULL;
             }
@@ -313,6 +414,7 @@ static void removeRouteFromTopicTree(rtRoutingTree rt, rtTreeTopic* treeTopic, r
         rtListItem_GetNext(childItem, &next);
         if(numChildren == 0 && numRoutes == 0)
         {
+            removeChildFromMap(treeTopic, child);
             rtList_RemoveItem(treeTopic->childList, childItem, freeTreeTopic);
         }/*
         else if(numRoutes == 0 && numRoutes2 > 0)
@@ -361,6 +463,18 @@ static void getTreeTopicStats(rtTreeTopic* topic, rtRoutingTreeStats* stats)
   }
 }
 
+/*drops every cached lookup. called on any change to the tree, as cached lists may be freed or their routes outdated*/
+static void clearRouteCache(rtRoutingTree rt)
+{
+    pthread_mutex_lock(&rt->cacheMutex);
+    if(rtHashMap_GetSize(rt->routeCache) > 0)
+    {
+        rtHashMap_Destroy(rt->routeCache);
+        rtHashMap_Create(&rt->routeCache);
+    }
+    pthread_mutex_unlock(&rt->cacheMutex);
+}
+
 static void appendLogMessage(char* buffer, size_t len, const char* format, ...)
 {
     size_t len2 = strlen(buffer);
@@ -432,6 +546,10 @@ void rtRoutingTree_Create(rtRoutingTree* rt)
     *rt = rt_malloc(sizeof(struct _rtRoutingTree));
     (*rt)->topicRoot = rt_calloc(1, sizeof(struct rtTreeTopic));/*root's name and fullName stay NULL*/
     rtList_Create(&(*rt)->routeList);
+    rtHashMap_Create(&(*rt)->routeCache);
+    (*rt)->cacheHits = 0;
+    (*rt)->cacheMisses = 0;
+    pthread_mutex_init(&(*rt)->cacheMutex, NULL);
 }
 
 void rtRoutingTree_Destroy(rtRoutingTree rt)
@@ -439,6 +557,8 @@ void rtRoutingTree_Destroy(rtRoutingTree rt)
     rtLog_Debug("%s", __FUNCTION__);
     rtList_Destroy(rt->routeList, freeTreeRoute);
     freeTreeTopic(rt->topicRoot);
+    rtHashMap_Destroy(rt->routeCache);
+    pthread_mutex_destroy(&rt->cacheMutex);
     free(rt);
 }
 
@@ -448,14 +568,18 @@ rtError rtRoutingTree_AddTopicRoute(rtRoutingTree rt, const char* topicPath, con
     int i;
     rtTreeTopic* topic = rt->topicRoot;
     rtTreeRoute* route;
+    TokenList tokens;
 
     rtLog_Debug("%s: %s", __FUNCTION__, topicPath);
 
-    tokenizeExpression(topicPath);
+    if(tokenizeExpression(topicPath, &tokens) != 0)
+        return RT_ERROR_INVALID_ARG;
 
-    if(workTokenCount == 0)
+    if(tokens.count == 0)
         return rc;
 
+    clearRouteCache(rt);
+
     route = getTreeRoute(rt, routeData, NULL);
     if(!route)
     {
@@ -467,9 +591,9 @@ rtError rtRoutingTree_AddTopicRoute(rtRoutingTree rt, const char* topicPath, con
 
     int isCreated = 0;
     int error = 0;
-    for(i = 0; i < workTokenCount; ++i)
+    for(i = 0; i < tokens.count; ++i)
     {
-        topic = getChildByName(rt, topic, workTokens[i].name, 1/*create missing topic*/, &isCreated, &error, 0);
+        topic = getChildByName(rt, topic, tokens.tokens[i].name, 1/*create missing topic*/, &isCreated, &error, 0);
         if (error)
         {
             rtLog_Debug("Rejecting data registraion as per standard");
@@ -489,28 +613,32 @@ rtError rtRoutingTree_AddTopicRoute(rtRoutingTree rt, const char* topicPath, con
 
     rtList_PushBack(topic->routeList, route, NULL);
 
-    addPointerToListOnce(route->topicList, topic);
+    /*a topic created just now can't be on the route's list yet, which spares
+      registering a large data model a scan of that list per element*/
+    if(isCreated)
+        rtList_PushBack(route->topicList, topic, NULL);
+    else
+        addPointerToListOnce(route->topicList, topic);
 
     if(topic->parent->parent)
         optimizeTopicsBackpropagate(topic->parent, route);
     return RT_OK;
 }
 
-void rtRoutingTree_GetTopicRoutes(rtRoutingTree rt, const char* topic, rtList* routes)
+static void lookupTopicRoutes(rtRoutingTree rt, const char* topic, rtList* routes)
 {
     int i;
     *routes = NULL;
     rtTreeTopic* treeTopic = rt->topicRoot;
+    TokenList tokens;
 
-    rtLog_Debug("%s: %s", __FUNCTION__, topic);
-
-    tokenizeExpression(topic);
-    if(workTokenCount == 0)
+    tokenizeExpression(topic, &tokens);
+    if(tokens.count == 0)
         return;
 
-    for(i = 0; i < workTokenCount; ++i)
+    for(i = 0; i < tokens.count; ++i)
     {
-        treeTopic = getChildByName(rt, treeTopic, workTokens[i].name, 0, NULL, NULL, 0);
+        treeTopic = getChildByName(rt, treeTopic, tokens.tokens[i].name, 0, NULL, NULL, 0);
 
         if(!treeTopic)
             return;
@@ -548,7 +676,7 @@ void rtRoutingTree_GetTopicRoutes(rtRoutingTree rt, const char* topic, rtList* r
           So for RDKC use case, if A.B.C doesn't exist, the consumer should get
           an error indicating this.
         */
-        if(treeTopic->routeList2 && i < workTokenCount - 1)
+        if(treeTopic->routeList2 && i < tokens.count - 1)
         {
             size_t size = 0;
             rtList_GetSize(treeTopic->routeList2, &size);
@@ -588,6 +716,37 @@ void rtRoutingTree_GetTopicRoutes(rtRoutingTree rt, const char* topic, rtList* r
     }
 }
 
+void rtRoutingTree_GetTopicRoutes(rtRoutingTree rt, const char* topic, rtList* routes)
+{
+    rtLog_Debug("%s: %s", __FUNCTION__, topic);
+
+    pthread_mutex_lock(&rt->cacheMutex);
+    *routes = rtHashMap_Get(rt->routeCache, topic);
+    if(*routes)
+    {
+        rt->cacheHits++;
+        pthread_mutex_unlock(&rt->cacheMutex);
+        return;
+    }
+    rt->cacheMisses++;
+    pthread_mutex_unlock(&rt->cacheMutex);
+
+    lookupTopicRoutes(rt, topic, routes);
+
+    /*unknown topics aren't cached so a stream of bad topics can't flush the hot ones*/
+    if(*routes)
+    {
+        pthread_mutex_lock(&rt->cacheMutex);
+        if(rtHashMap_GetSize(rt->routeCache) >= RTROUTINGTREE_CACHE_MAX)
+        {
+            rtHashMap_Destroy(rt->routeCache);
+            rtHashMap_Create(&rt->routeCache);
+        }
+        rtHashMap_Set(rt->routeCache, topic, *routes);
+        pthread_mutex_unlock(&rt->cacheMutex);
+    }
+}
+
 void rtRoutingTree_GetRouteTopics(rtRoutingTree rt, const void* route, rtList* topics)
 {
     rtTreeRoute* entry = NULL;
@@ -613,6 +772,8 @@ void rtRoutingTree_RemoveRoute(rtRoutingTree rt, const void* route)
     if(!treeRoute)
         return;
 
+    clearRouteCache(rt);
+
     removeRouteFromTopicTree(rt, rt->topicRoot, treeRoute);
 
     rtList_RemoveItem(rt->routeList, routeItem, freeTreeRoute);
@@ -622,16 +783,19 @@ void rtRoutingTree_RemoveTopic(rtRoutingTree rt, const char* topic)
 {
     int i;
     rtTreeTopic* treeTopic = rt->topicRoot;
+    TokenList tokens;
 
     rtLog_Debug("%s topic=%s", __FUNCTION__, topic);
 
-    tokenizeExpression(topic);
-    if(workTokenCount == 0)
+    tokenizeExpression(topic, &tokens);
+    if(tokens.count == 0)
         return;
 
-    for(i = 0; i < workTokenCount; ++i)
+    clearRouteCache(rt);
+
+    for(i = 0; i < tokens.count; ++i)
     {
-        treeTopic = getChildByName(rt, treeTopic, workTokens[i].name, 0, NULL, NULL, i == workTokenCount-1);
+        treeTopic = getChildByName(rt, treeTopic, tokens.tokens[i].name, 0, NULL, NULL, i == tokens.count-1);
 
         if(!treeTopic)
             return;
@@ -642,14 +806,15 @@ void rtRoutingTree_ResolvePartialPath(rtRoutingTree rt, const char* partialPath,
 {
     int i;
     rtTreeTopic* treeTopic = rt->topicRoot;
+    TokenList tokens;
 
-    tokenizeExpression(partialPath);
-    if(workTokenCount == 0)
+    tokenizeExpression(partialPath, &tokens);
+    if(tokens.count == 0)
         return;
 
-    for(i = 0; i < workTokenCount; ++i)
+    for(i = 0; i < tokens.count; ++i)
     {
-        treeTopic = getChildByName(rt, treeTopic, workTokens[i].name, 0, NULL, NULL, 0);
+        treeTopic = getChildByName(rt, treeTopic, tokens.tokens[i].name, 0, NULL, NULL, 0);
         
         if(!treeTopic)
             return;
@@ -724,3 +889,19 @@ void rtRoutingTree_LogRouteList(rtRoutingTree rt)
     }
  
 }
+
+void rtRoutingTree_LogCacheStats(rtRoutingTree rt)
+{
+    pthread_mutex_lock(&rt->cacheMutex);
+    rtLog_Info("RoutingTree cache stats: size=%d hits=%llu misses=%llu", 
+        (int)rtHashMap_GetSize(rt->routeCache), (unsigned long long)rt->cacheHits, (unsigned long long)rt->cacheMisses);
+    pthread_mutex_unlock(&rt->cacheMutex);
+}
+
+void rtRoutingTree_ResetCacheStats(rtRoutingTree rt)
+{
+    pthread_mutex_lock(&rt->cacheMutex);
+    rt->cacheHits = 0;
+    rt->cacheMisses = 0;
+    pthread_mutex_unlock(&rt->cacheMutex);
+}
@@ -22,6 +22,8 @@
 #define __RT_ROUTETREE_H__
 
 #include "rtList.h"
+#include "rtHashMap.h"
+#include <pthread.h>
 
 /*
 
@@ -138,6 +140,7 @@ typedef struct rtTreeTopic
 {
     struct rtTreeTopic* parent;
     rtList childList;       /*list of rtTreeTopic: list of child topics*/
+    rtHashMap childMap;     /*index of childList by name, only built once the topic has many children*/
     rtList routeList;       /*list of rtTreeRoute: list of routes directly assigned to this topic*/
     rtList routeList2;      /*list of rtTreeRoute: list of all routes either assigned to this topic or assigned to a descendents topic (except leaf nodes)*/
     char* name;
@@ -149,6 +152,10 @@ typedef struct _rtRoutingTree
 {
     rtTreeTopic* topicRoot; /*tree of rtTreeTopic: topic tree built from all topics assigned to this tree*/
     rtList routeList;       /*list of rtTreeRoute: list of all routes assigned in this tree*/
+    rtHashMap routeCache;   /*map of topic to the rtList GetTopicRoutes returned for it, cleared whenever the tree changes*/
+    size_t cacheHits;
+    size_t cacheMisses;
+    pthread_mutex_t cacheMutex;
 } *rtRoutingTree;
 
 void rtRoutingTree_Create(rtRoutingTree* rt);
@@ -162,6 +169,8 @@ void rtRoutingTree_ResolvePartialPath(rtRoutingTree rt, const char* partialPath,
 void rtRoutingTree_LogStats(rtRoutingTree rt);
 void rtRoutingTree_LogTopicTree(rtRoutingTree rt);
 void rtRoutingTree_LogRouteList(rtRoutingTree rt);
+void rtRoutingTree_LogCacheStats(rtRoutingTree rt);
+void rtRoutingTree_ResetCacheStats(rtRoutingTree rt);
 
 #ifdef __cplusplus
 }
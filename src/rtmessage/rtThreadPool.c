@@ -68,14 +68,10 @@ void rtThreadPool_CleanupThread(void* data)
   rtLog_Debug("%s exit", __FUNCTION__);
 }
 
-void rtThreadPool_TryRealDestroy(rtThreadPool pool)
+/*whichever of rtThreadPool_Destroy and the last worker to exit sees both threadCount at 0 and isShutdown set,
+  under the same hold of poolLock that changed them, calls this once*/
+void rtThreadPool_RealDestroy(rtThreadPool pool)
 {
-  int shouldDestroy;
-  pthread_mutex_lock(&pool->poolLock);
-  shouldDestroy = pool->threadCount == 0 && pool->isShutdown == 1;
-  pthread_mutex_unlock(&pool->poolLock);
-  if(!shouldDestroy)
-    return;
   rtLog_Debug("%s enter", __FUNCTION__);
   rtList_Destroy(pool->threadList, rtThreadPool_CleanupThread);
   rtList_Destroy(pool->taskList, rtList_Cleanup_Free);
@@ -117,8 +113,8 @@ void* rtThread_WorkerThreadFunc(void* data)
   rtLog_Debug("%s enter", __FUNCTION__);
   rtThread thread = (rtThread)data;
   rtThreadPool pool = thread->pool;
+  int shouldDestroy;
   pthread_mutex_lock(&pool->poolLock);
-  pool->threadCount++;
   while(pool->isRunning)
   {
     while(pool->isRunning && rtThread_DequeTask(thread))
@@ -141,15 +137,23 @@ void* rtThread_WorkerThreadFunc(void* data)
       rtLog_Debug("%s pthread_cond_wait after rc=%d", __FUNCTION__, rc);
       if(rc == ETIMEDOUT)
       { 
-        rtLog_Debug("%s thread expired", __FUNCTION__);
-        break;
+        size_t size;
+        //a task queued as we timed out would otherwise wait for the next RunTask
+        rtList_GetSize(pool->taskList, &size);
+        if(size == 0)
+        {
+          rtLog_Debug("%s thread expired", __FUNCTION__);
+          break;
+        }
       }
     }
   }
   pool->threadCount--;
   rtList_RemoveItemWithData(pool->threadList, thread, rtThreadPool_CleanupThread);
+  shouldDestroy = pool->threadCount == 0 && pool->isShutdown == 1;
   pthread_mutex_unlock(&pool->poolLock);
-  rtThreadPool_TryRealDestroy(pool);
+  if(shouldDestroy)
+    rtThreadPool_RealDestroy(pool);
   rtLog_Debug("%s exit", __FUNCTION__);
   return NULL;
 }
@@ -163,9 +167,13 @@ rtError rtThreadPool_CreateWorkerThread(rtThreadPool pool)
   if(!thread)
     return rtErrorFromErrno(ENOMEM);
   thread->pool = pool;
+  /*counted here rather than when the thread starts so a burst of tasks can't create more than maxThreadCount*/
+  pool->threadCount++;
   pthread_attr_init(&attr);
   if(pool->stackSize > 0)
     pthread_attr_setstacksize(&attr, pool->stackSize);
+  /*workers are never joined, they free themselves when they expire or the pool is destroyed*/
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
   pthread_create(&thread->threadId, &attr, rtThread_WorkerThreadFunc, thread);
   pthread_attr_destroy(&attr);
   rtList_PushBack(pool->threadList, thread, NULL);
@@ -280,12 +288,15 @@ rtError rtThreadPool_StopAllThread(rtThreadPool pool, int waitTimeMS)
 rtError rtThreadPool_Destroy(rtThreadPool pool, int waitTimeMS)
 {
   rtError err;
+  int shouldDestroy;
   rtLog_Debug("%s enter", __FUNCTION__);
   err = rtThreadPool_StopAllThread(pool, waitTimeMS);
   pthread_mutex_lock(&pool->poolLock);
   pool->isShutdown = 1;
+  shouldDestroy = pool->threadCount == 0;
   pthread_mutex_unlock(&pool->poolLock);
-  rtThreadPool_TryRealDestroy(pool);
+  if(shouldDestroy)
+    rtThreadPool_RealDestroy(pool);
   rtLog_Debug("%s exit", __FUNCTION__);
   return err;
 }
@@ -296,6 +307,7 @@ rtError rtThreadPool_RunTask(rtThreadPool pool, rtThreadPoolFunc func, void* use
   rtError err = RT_OK;
   rtListItem item;
   rtThreadTask task;
+  size_t queued;
   pthread_mutex_lock(&pool->poolLock);
   //enque task
   rtList_PushBack(pool->taskList, rtListReuseData/*reuse data to avoid many allocs*/, &item);
@@ -304,14 +316,20 @@ rtError rtThreadPool_RunTask(rtThreadPool pool, rtThreadPoolFunc func, void* use
   {
     task = rt_try_malloc(sizeof(struct _rtThreadTask));
     if(!task)
+    {
+      rtList_RemoveItem(pool->taskList, item, NULL);
+      pthread_mutex_unlock(&pool->poolLock);
       return rtErrorFromErrno(ENOMEM);
+    }
     rtLog_Debug("taskList data null so alloc new %p", (void*)task);
     rtListItem_SetData(item, task);
   }
   task->func = func;
   task->userData = userData;
   //find and existing thread to handle the task
-  if(pool->busyThreadCount < pool->threadCount)
+  //threads not busy will each take one queued task, including threads just created that haven't started yet
+  rtList_GetSize(pool->taskList, &queued);
+  if(queued <= pool->threadCount - pool->busyThreadCount)
   {
     rtLog_Debug("%s pthread_cond_signal before", __FUNCTION__);
     pthread_cond_signal(&pool->taskCond);
@@ -321,7 +339,10 @@ rtError rtThreadPool_RunTask(rtThreadPool pool, rtThreadPoolFunc func, void* use
   {
     rtLog_Debug("%s creating new thread", __FUNCTION__);
     if((err = rtThreadPool_CreateWorkerThread(pool)) != RT_OK)
+    {
+      pthread_mutex_unlock(&pool->poolLock);
       return err;
+    }
     if(pool->threadCount == pool->maxThreadCount - 1)
       rtLog_Debug("%s reached max thread count %zu", __FUNCTION__, pool->maxThreadCount);
   }
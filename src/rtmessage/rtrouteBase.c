@@ -303,6 +303,12 @@ rtConnectedClient_Init(rtConnectedClient* clnt, int fd, struct sockaddr_storage*
   memset(clnt->read_buffer, 0, RTMSG_CLIENT_READ_BUFFER_SIZE);
   memset(clnt->send_buffer, 0, RTMSG_CLIENT_READ_BUFFER_SIZE);
   clnt->read_buffer_capacity = RTMSG_CLIENT_READ_BUFFER_SIZE;
+  clnt->send_queue = NULL;
+  clnt->send_queue_bytes = 0;
+  clnt->send_queue_overflow = 0;
+  clnt->closing = 0;
+  pthread_mutex_init(&clnt->send_mutex, NULL);
+  clnt->worker = 0;
 #ifdef WITH_SPAKE2
   clnt->cipher = NULL;
   clnt->encryption_key = NULL;
@@ -633,6 +639,7 @@ rtRouteDirect_StartInstance(const char* socket_name, rtDriectClientHandler messa
 
   free(myDirectClient->read_buffer);
   free(myDirectClient->send_buffer);
+  pthread_mutex_destroy(&myDirectClient->send_mutex);
   free(myDirectClient);
 
   free(route);
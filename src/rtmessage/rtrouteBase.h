@@ -6,6 +6,8 @@
 #include "rtMessageHeader.h"
 #include "rtSocket.h"
 #include "rtConnection.h"
+#include "rtList.h"
+#include <pthread.h>
 
 
 #ifndef SOL_TCP
@@ -41,6 +43,12 @@ typedef struct
   int                       bytes_to_read;
   int                       read_buffer_capacity;
   rtMessageHeader           header;
+  rtList                    send_queue;
+  uint32_t                  send_queue_bytes;
+  int                       send_queue_overflow;
+  int                       closing;
+  pthread_mutex_t           send_mutex;
+  int                       worker;
 #ifdef WITH_SPAKE2
   rtCipher*                 cipher;
   uint8_t*                  encryption_key;
@@ -18,6 +18,7 @@
 # limitations under the License.
 ##########################################################################
 */
+#define _GNU_SOURCE
 #include "rtMessage.h"
 #include "rtTime.h"
 #include "rtCipher.h"
@@ -39,7 +40,8 @@
 #include <arpa/inet.h>
 #include <errno.h>
 #include <getopt.h>
-#include <sys/select.h>
+#include <pthread.h>
+#include <sys/epoll.h>
 #include <sys/wait.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
@@ -51,6 +53,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <sys/file.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <time.h>
 #include <cjson/cJSON.h>
@@ -76,6 +79,42 @@ rtList g_discovery_result = NULL;
 int g_enable_traffic_monitor = 0;
 int is_running = 1;
 
+#define RTROUTED_MAX_EPOLL_EVENTS 64
+#define RTROUTED_MAX_FLUSH_IOV 32
+#define RTROUTED_DEFAULT_CLIENT_BACKLOG (1024 * 1024 * 2)
+
+typedef enum
+{
+  rtRoutedBacklogPolicy_Drop = 0,
+  rtRoutedBacklogPolicy_Disconnect
+} rtRoutedBacklogPolicy;
+
+/* A message, or the unsent tail of one, waiting for its client's socket to become writable. */
+typedef struct
+{
+  uint32_t length;
+  uint32_t offset;
+  uint8_t  data[];
+} rtOutboundMessage;
+
+/* An event loop owning a share of the client sockets. Worker 0 runs on the
+ * main thread and also owns the listeners. */
+typedef struct
+{
+  int       index;
+  int       epoll_fd;
+  pthread_t thread;
+} rtRoutedWorker;
+
+/* Forwarding only reads gRoutingTree/gRoutes/gClients and holds this lock shared.
+ * Anything that changes them (client connect/disconnect and every _RTROUTED.
+ * message, which covers subscribe/unsubscribe) holds it exclusively. */
+static pthread_rwlock_t g_router_lock;
+static rtRoutedWorker* g_workers = NULL;
+static int g_num_workers = 1;
+static uint32_t g_max_client_backlog = RTROUTED_DEFAULT_CLIENT_BACKLOG;
+static rtRoutedBacklogPolicy g_backlog_policy = rtRoutedBacklogPolicy_Drop;
+
 #ifdef ENABLE_ROUTER_BENCHMARKING
 #define MAX_TIMESTAMP_ENTRIES 2000
 static struct timespec g_entry_exit_timestamps[MAX_TIMESTAMP_ENTRIES][2];
@@ -139,6 +178,9 @@ rtRouted_PrintHelp()
   printf("\t-l, --log-level <level>   Change logging level\n");
   printf("\t-r, --debug-route         Add a catch all route that dumps messages to stdout\n");
   printf("\t-s, --socket              [tcp://ip:port unix:///path/to/domain_socket]\n");
+  printf("\t-b, --max-backlog <bytes> Max bytes queued for a slow client, 0 for no limit (default %d)\n", RTROUTED_DEFAULT_CLIENT_BACKLOG);
+  printf("\t-p, --backlog-policy      [drop disconnect] Action when a client exceeds its backlog (default drop)\n");
+  printf("\t-t, --threads <count>     Number of threads routing messages (default 1)\n");
   printf("\t-h, --help                Print this help\n");
   exit(0);
 }
@@ -469,6 +511,11 @@ rtConnectedClient_Destroy(rtConnectedClient* clnt)
   if (clnt->send_buffer)
     free(clnt->send_buffer);
 
+  if (clnt->send_queue)
+    rtList_Destroy(clnt->send_queue, free);
+
+  pthread_mutex_destroy(&clnt->send_mutex);
+
 #if WITH_SPAKE2
   if (clnt->cipher)
     rtCipher_Destroy(clnt->cipher);
@@ -481,11 +528,205 @@ rtConnectedClient_Destroy(rtConnectedClient* clnt)
   free(clnt);
 }
 
+static void
+rtConnectedClient_SetBlocking(rtConnectedClient* clnt, int blocking)
+{
+  int flags = fcntl(clnt->fd, F_GETFL, 0);
+  if (flags == -1)
+  {
+    rtLog_Warn("fcntl:%s", rtStrError(errno));
+    return;
+  }
+  flags = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+  if (fcntl(clnt->fd, F_SETFL, flags) == -1)
+    rtLog_Warn("fcntl:%s", rtStrError(errno));
+}
+
+/* Marks a client to be disconnected by the worker that owns it. Shutting the
+ * socket down wakes that worker even if the client was closed from another thread. */
+static void
+rtConnectedClient_Close(rtConnectedClient* clnt)
+{
+  if (!clnt->closing)
+  {
+    clnt->closing = 1;
+    shutdown(clnt->fd, SHUT_RDWR);
+  }
+}
+
+/* Writes as much of the client's outbound queue as the socket will take.
+ * Called when epoll reports the socket writable again. */
+static rtError
+rtConnectedClient_Flush(rtConnectedClient* clnt)
+{
+  rtError ret = RT_OK;
+
+  pthread_mutex_lock(&clnt->send_mutex);
+  while (!clnt->closing)
+  {
+    struct iovec send_vec[RTROUTED_MAX_FLUSH_IOV];
+    int count = 0;
+    ssize_t bytes_sent;
+    rtListItem item;
+
+    rtList_GetFront(clnt->send_queue, &item);
+    while (item && count < RTROUTED_MAX_FLUSH_IOV)
+    {
+      rtOutboundMessage* msg;
+      rtListItem_GetData(item, (void**)&msg);
+      send_vec[count].iov_base = msg->data + msg->offset;
+      send_vec[count].iov_len = msg->length - msg->offset;
+      count++;
+      rtListItem_GetNext(item, &item);
+    }
+
+    if (count == 0)
+    {
+      clnt->send_queue_overflow = 0;
+      break;
+    }
+
+    struct msghdr send_hdr = {NULL, 0, send_vec, count, NULL, 0, 0};
+    bytes_sent = sendmsg(clnt->fd, &send_hdr, MSG_NOSIGNAL);
+    if (bytes_sent == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+        break;
+      ret = rtErrorFromErrno(errno);
+      rtLog_Warn("error flushing messages to client %s. %s", clnt->ident, rtStrError(ret));
+      rtConnectedClient_Close(clnt);
+      break;
+    }
+
+    clnt->send_queue_bytes -= bytes_sent;
+    while (bytes_sent > 0)
+    {
+      rtOutboundMessage* msg;
+      uint32_t remaining;
+
+      rtList_GetFront(clnt->send_queue, &item);
+      rtListItem_GetData(item, (void**)&msg);
+      remaining = msg->length - msg->offset;
+      if ((size_t)bytes_sent >= remaining)
+      {
+        bytes_sent -= remaining;
+        rtList_RemoveItem(clnt->send_queue, item, free);
+      }
+      else
+      {
+        msg->offset += bytes_sent;
+        bytes_sent = 0;
+      }
+    }
+  }
+  pthread_mutex_unlock(&clnt->send_mutex);
+  return ret;
+}
+
+/* Sends a message to a client without blocking. Whatever the socket doesn't
+ * accept right away is copied to the client's outbound queue and written by
+ * rtConnectedClient_Flush. A client whose queue would grow beyond the backlog
+ * limit has the message dropped or is disconnected, depending on policy.
+ * Safe to call from any worker; the client's send_mutex serializes senders. */
+static rtError
+rtConnectedClient_Send(rtConnectedClient* clnt, rtMessageHeader* hdr, uint8_t const* payload, uint32_t payload_length)
+{
+  rtError ret = RT_OK;
+  ssize_t bytes_sent = 0;
+  size_t queue_size = 0;
+  uint32_t header_length;
+  uint32_t total_length;
+  uint32_t remaining;
+  uint8_t const* header;
+  rtOutboundMessage* msg;
+
+  pthread_mutex_lock(&clnt->send_mutex);
+
+  if (clnt->closing)
+  {
+    rtLog_Debug("dropping message to closing client %s", clnt->ident);
+    ret = RT_FAIL;
+    goto done;
+  }
+
+  rtMessageHeader_Encode(hdr, clnt->send_buffer);
+  header = clnt->send_buffer;
+  header_length = hdr->header_length;
+  total_length = header_length + payload_length;
+
+  rtList_GetSize(clnt->send_queue, &queue_size);
+  if (queue_size == 0)
+  {
+    struct iovec send_vec[] = {{(void *)header, header_length}, {(void *)payload, payload_length}};
+    struct msghdr send_hdr = {NULL, 0, send_vec, 2, NULL, 0, 0};
+    do
+    {
+      bytes_sent = sendmsg(clnt->fd, &send_hdr, MSG_NOSIGNAL);
+    } while (bytes_sent == -1 && errno == EINTR);
+
+    if (bytes_sent == -1)
+    {
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+      {
+        rtLog_Warn("error forwarding message to client. %d %s", errno, strerror(errno));
+        rtRouted_PrintClientInfo(clnt);
+        rtConnectedClient_Close(clnt);
+        ret = RT_FAIL;
+        goto done;
+      }
+      bytes_sent = 0;
+    }
+
+    if ((uint32_t)bytes_sent == total_length)
+      goto done;
+  }
+
+  /* A partially written message must always be completed, so the limit only applies to whole messages. */
+  if (bytes_sent == 0 && g_max_client_backlog && (clnt->send_queue_bytes + total_length) > g_max_client_backlog)
+  {
+    if (g_backlog_policy == rtRoutedBacklogPolicy_Disconnect)
+    {
+      rtLog_Warn("client %s exceeded backlog of %u bytes. disconnecting", clnt->ident, g_max_client_backlog);
+      rtRouted_PrintClientInfo(clnt);
+      rtConnectedClient_Close(clnt);
+    }
+    else if (!clnt->send_queue_overflow)
+    {
+      rtLog_Warn("client %s exceeded backlog of %u bytes. dropping messages", clnt->ident, g_max_client_backlog);
+      rtRouted_PrintClientInfo(clnt);
+      clnt->send_queue_overflow = 1;
+    }
+    ret = RT_FAIL;
+    goto done;
+  }
+
+  remaining = total_length - (uint32_t)bytes_sent;
+  msg = (rtOutboundMessage *)rt_malloc(sizeof(rtOutboundMessage) + remaining);
+  msg->length = remaining;
+  msg->offset = 0;
+  if ((uint32_t)bytes_sent < header_length)
+  {
+    memcpy(msg->data, header + bytes_sent, header_length - bytes_sent);
+    memcpy(msg->data + (header_length - bytes_sent), payload, payload_length);
+  }
+  else
+  {
+    memcpy(msg->data, payload + (bytes_sent - header_length), remaining);
+  }
+  rtList_PushBack(clnt->send_queue, msg, NULL);
+  clnt->send_queue_bytes += remaining;
+
+done:
+  pthread_mutex_unlock(&clnt->send_mutex);
+  return ret;
+}
+
 static rtError
 rtRouted_SendMessage(rtMessageHeader * request_hdr, rtMessage message, rtConnectedClient* skipClient)
 {
   rtError ret = RT_OK;
-  ssize_t bytes_sent;
   uint8_t* buffer = NULL;
   uint32_t size;
   rtConnectedClient * client = NULL;
@@ -493,7 +734,10 @@ rtRouted_SendMessage(rtMessageHeader * request_hdr, rtMessage message, rtConnect
   rtListItem item;
   int found_dest = 0;
 
-  rtMessage_ToByteArray(message, &buffer, &size);
+  if(request_hdr->flags & rtMessageFlags_BinaryEncoded)
+    rtMessage_ToByteArrayWithEncoding(message, rtMessageEncoding_Binary, &buffer, &size);
+  else
+    rtMessage_ToByteArray(message, &buffer, &size);
   request_hdr->payload_length = size;
 
   /*Find the route to populate control_id field.*/
@@ -516,28 +760,12 @@ rtRouted_SendMessage(rtMessageHeader * request_hdr, rtMessage message, rtConnect
         client = route->subscription->client;
         if(client != skipClient)
         {
-          rtMessageHeader_Encode(request_hdr, client->send_buffer);
-          struct iovec send_vec[] = {{client->send_buffer, request_hdr->header_length}, {(void *)buffer, size}};
-          struct msghdr send_hdr = {NULL, 0, send_vec, 2, NULL, 0, 0};
-          do
+          if(rtConnectedClient_Send(client, request_hdr, buffer, size) != RT_OK)
           {
-            bytes_sent = sendmsg(client->fd, &send_hdr, MSG_NOSIGNAL);
-            if (bytes_sent == -1)
-            {
-              if (errno == EBADF)
-                ret = rtErrorFromErrno(errno);
-              else
-              {
-                rtLog_Warn("error forwarding message to client. %d %s", errno, strerror(errno));
-                rtRouted_PrintClientInfo(client);
-                if(skipClient)
-                    rtRouted_PrintClientInfo(skipClient);
-                ret = RT_FAIL;
-              }
-              break;
-            }
-
-          } while(0);
+            if(skipClient)
+              rtRouted_PrintClientInfo(skipClient);
+            ret = RT_FAIL;
+          }
         }
       }
     }
@@ -559,15 +787,18 @@ rtError rtRouted_TrafficMonitorLog(rtConnectedClient* sender, rtMessageHeader* h
 {
   static FILE* file = NULL;
   static int counter = 0;
+  static pthread_mutex_t file_mutex = PTHREAD_MUTEX_INITIALIZER;
 
   (void) sender;
   (void) subscription;
 
+  pthread_mutex_lock(&file_mutex);
   if(!file)
   {
     file = fopen("/tmp/rtrouted_traffic_monitor", "a");
     if(!file)
     {
+      pthread_mutex_unlock(&file_mutex);
       rtLog_Warn("Failed to open traffix monitor log");
       return RT_FAIL;
     }
@@ -614,14 +845,13 @@ rtError rtRouted_TrafficMonitorLog(rtConnectedClient* sender, rtMessageHeader* h
   }
   fprintf(file, "]\n");
   fflush(file);
+  pthread_mutex_unlock(&file_mutex);
   return RT_OK;
 }
 
 static rtError
 rtRouted_ForwardMessage(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t const* buff, int n, rtSubscription* subscription)
 {
-  ssize_t bytes_sent;
-
   (void) sender;
 
   if(1 == g_enable_traffic_monitor)
@@ -681,9 +911,12 @@ rtRouted_ForwardMessage(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t
   if(subscription->client->encryption_key)
   {
     uint32_t encryptedLength;
+    rtError err;
 
     rtLog_Debug("sending encrypted message");
 
+    /*the client's encryption_buffer is shared by every worker forwarding to it*/
+    pthread_mutex_lock(&subscription->client->send_mutex);
     if(rtCipher_EncryptWithKey( subscription->client->encryption_key, 
                                 buff, 
                                 n, 
@@ -691,37 +924,20 @@ rtRouted_ForwardMessage(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t
                                 RTMSG_CLIENT_READ_BUFFER_SIZE, 
                                 &encryptedLength ) != RT_OK)
     { 
+      pthread_mutex_unlock(&subscription->client->send_mutex);
       rtLog_Error("failed to encrypt message");
       return RT_FAIL;
     }
-    buff = subscription->client->encryption_buffer;
-    n = encryptedLength;
     new_header.payload_length = encryptedLength;
     new_header.flags |= rtMessageFlags_Encrypted;
+    err = rtConnectedClient_Send(subscription->client, &new_header, subscription->client->encryption_buffer, encryptedLength);
+    pthread_mutex_unlock(&subscription->client->send_mutex);
+    return err;
   }
 #endif
 
-  rtMessageHeader_Encode(&new_header, subscription->client->send_buffer);
-
   //rtDebug_PrintBuffer("fwd header", (uint8_t*) buff, n);
-  struct iovec send_vec[] = {{subscription->client->send_buffer, new_header.header_length}, {(void *)buff, (size_t)n}};
-  struct msghdr send_hdr = {NULL, 0, send_vec, 2, NULL, 0, 0};
-
-  bytes_sent = sendmsg(subscription->client->fd, &send_hdr, MSG_NOSIGNAL);
-  if (bytes_sent == -1)
-  {
-    if (errno == EBADF)
-    {
-      return rtErrorFromErrno(errno);
-    }
-    else
-    {
-      rtLog_Warn("error forwarding message to client. %d %s", errno, strerror(errno));
-      rtRouted_PrintClientInfo(subscription->client);
-    }
-    return RT_FAIL;
-  }
-  return RT_OK;
+  return rtConnectedClient_Send(subscription->client, &new_header, buff, (uint32_t)n);
 }
 
 static void prep_reply_header_from_request(rtMessageHeader *reply, const rtMessageHeader *request)
@@ -730,7 +946,7 @@ static void prep_reply_header_from_request(rtMessageHeader *reply, const rtMessa
   reply->version = request->version;
   reply->header_length = request->header_length;
   reply->sequence_number = request->sequence_number;
-  reply->flags = rtMessageFlags_Response;
+  reply->flags = rtMessageFlags_Response | (request->flags & rtMessageFlags_BinaryEncoded);
 
   strncpy(reply->topic, request->reply_topic, RTMSG_HEADER_MAX_TOPIC_LENGTH-1);
   strncpy(reply->reply_topic, request->topic, RTMSG_HEADER_MAX_TOPIC_LENGTH-1);
@@ -745,6 +961,65 @@ static void prep_reply_header_from_request(rtMessageHeader *reply, const rtMessa
 #endif
 }
 
+/* Adds every alias in the "topics" array to the sender's route, all or none.
+ * failed_index is set to the alias that was rejected, or -1. */
+static rtError
+rtRouted_OnMessageSubscribeBulk(rtConnectedClient* sender, rtMessage m, uint32_t route_id, int32_t count, int32_t* failed_index)
+{
+  rtRouteEntry* route = NULL;
+  char const* expression = NULL;
+  rtError rc = RT_OK;
+  int32_t i;
+  size_t j;
+
+  *failed_index = -1;
+
+  for (j = 0; j < rtVector_Size(gRoutes); j++)
+  {
+    rtRouteEntry* entry = (rtRouteEntry *) rtVector_At(gRoutes, j);
+    if (entry->subscription && (entry->subscription->client == sender) && (entry->subscription->id == route_id))
+    {
+      route = entry;
+      break;
+    }
+  }
+  if(!route)
+  {
+    rtLog_Warn("Bulk alias registration from %s for unknown route %u", sender->ident, route_id);
+    return RT_ERROR_INVALID_ARG;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    if((RT_OK != rtMessage_GetStringItem(m, "topics", i, &expression)) ||
+       (0 != validate_string(expression, RTMSG_MAX_EXPRESSION_LEN)))
+    {
+      rtLog_Warn("Bad alias %d in bulk registration from %s", i, sender->ident);
+      rc = RT_ERROR_INVALID_ARG;
+      break;
+    }
+    rc = rtRouted_AddAlias(expression, route);
+    if(RT_OK != rc)
+      break;
+  }
+
+  if(RT_OK != rc)
+  {
+    *failed_index = i;
+    /*aliases are rejected when the topic already exists, so the ones added here were new*/
+    while (i-- > 0)
+    {
+      rtMessage_GetStringItem(m, "topics", i, &expression);
+      rtRoutingTree_RemoveTopic(gRoutingTree, expression);
+    }
+  }
+  else
+  {
+    rtLog_Debug("Added %d aliases to route=[%p] address=[%s]", count, route, sender->ident);
+  }
+  return rc;
+}
+
 static void
 rtRouted_OnMessageSubscribe(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t const* buff, int n)
 {
@@ -752,6 +1027,9 @@ rtRouted_OnMessageSubscribe(rtConnectedClient* sender, rtMessageHeader* hdr, uin
   uint32_t route_id = 0;
   uint32_t i = 0;
   int32_t add_subscrption = 0;
+  int32_t topic_count = 0;
+  int32_t failed_index = -1;
+  int is_bulk = 0;
   rtMessage m;
   rtMessage response = NULL;
   rtError rc = RT_OK;
@@ -765,6 +1043,15 @@ rtRouted_OnMessageSubscribe(rtConnectedClient* sender, rtMessageHeader* hdr, uin
   else
   {
     if((RT_OK == rtMessage_GetInt32(m, "add", &add_subscrption)) &&
+       (1 == add_subscrption) &&
+       (RT_OK == rtMessage_GetInt32(m, "route_id", (int32_t *)&route_id)) &&
+       (RT_OK == rtMessage_GetArrayLength(m, "topics", &topic_count)) &&
+       (topic_count > 0))
+    {
+      is_bulk = 1;
+      rc = rtRouted_OnMessageSubscribeBulk(sender, m, route_id, topic_count, &failed_index);
+    }
+    else if((RT_OK == rtMessage_GetInt32(m, "add", &add_subscrption)) &&
        (RT_OK == rtMessage_GetString(m, "topic", &expression)) &&
        (RT_OK == rtMessage_GetInt32(m, "route_id", (int32_t *)&route_id)) &&
        (0 == validate_string(expression, RTMSG_MAX_EXPRESSION_LEN)))
@@ -830,6 +1117,8 @@ rtRouted_OnMessageSubscribe(rtConnectedClient* sender, rtMessageHeader* hdr, uin
   {
       rtMessage_Create(&response);
       rtMessage_SetInt32(response, "result", rc);
+      if(is_bulk)
+        rtMessage_SetInt32(response, "index", failed_index);
       rtMessageHeader new_header;
       prep_reply_header_from_request(&new_header, hdr);
       if(RT_OK != rtRouted_SendMessage(&new_header, response, NULL))
@@ -1179,6 +1468,10 @@ rtRouted_OnMessageDiagnostics(rtConnectedClient* sender, rtMessageHeader* hdr, u
     rtRoutingTree_LogTopicTree(gRoutingTree);
   else if(0 == strncmp(RTROUTER_DIAG_CMD_LOG_ROUTING_ROUTES, cmd, sizeof(RTROUTER_DIAG_CMD_LOG_ROUTING_ROUTES)))
     rtRoutingTree_LogRouteList(gRoutingTree);
+  else if(0 == strncmp(RTROUTER_DIAG_CMD_LOG_ROUTE_CACHE_STATS, cmd, sizeof(RTROUTER_DIAG_CMD_LOG_ROUTE_CACHE_STATS)))
+    rtRoutingTree_LogCacheStats(gRoutingTree);
+  else if(0 == strncmp(RTROUTER_DIAG_CMD_RESET_ROUTE_CACHE_STATS, cmd, sizeof(RTROUTER_DIAG_CMD_RESET_ROUTE_CACHE_STATS)))
+    rtRoutingTree_ResetCacheStats(gRoutingTree);
   else if(0 == strncmp(RTROUTER_DIAG_CMD_ENABLE_TRAFFIC_MONITOR, cmd, sizeof(RTROUTER_DIAG_CMD_ENABLE_TRAFFIC_MONITOR)))
     g_enable_traffic_monitor = 1;
   else if(0 == strncmp(RTROUTER_DIAG_CMD_DISABLE_TRAFFIC_MONITOR, cmd, sizeof(RTROUTER_DIAG_CMD_DISABLE_TRAFFIC_MONITOR)))
@@ -1315,6 +1608,83 @@ rtRouted_OnMessageKeyExchange(rtConnectedClient* sender, rtMessageHeader* hdr, u
 }
 #endif
 
+static void
+rtRouted_OnMessageMulticast(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t const* buff, int n)
+{
+  uint8_t const* itr = buff;
+  uint8_t const* end = buff + n;
+  uint8_t const* payload;
+  uint32_t count;
+  uint32_t i;
+  rtMessageHeader fwd_header;
+
+  /*first pass only validates the listener table so a malformed message delivers nothing*/
+  if (n < (int)sizeof(uint32_t))
+    return;
+  rtEncoder_DecodeUInt32(&itr, &count);
+  if (count == 0 || count > RTMSG_MULTICAST_MAX_LISTENERS)
+  {
+    rtLog_Warn("multicast from %s has invalid listener count %u", sender->ident, count);
+    return;
+  }
+  for (i = 0; i < count; ++i)
+  {
+    int32_t len;
+    if (end - itr < (int)sizeof(int32_t))
+      break;
+    rtEncoder_DecodeInt32(&itr, &len);
+    if (len <= 0 || len >= RTMSG_HEADER_MAX_TOPIC_LENGTH || end - itr < len)
+      break;
+    itr += len;
+  }
+  if (i != count)
+  {
+    rtLog_Warn("multicast from %s has a malformed listener table", sender->ident);
+    return;
+  }
+  payload = itr;
+
+  /*every listener gets the sender's header with its own topic and the same payload bytes*/
+  memcpy(&fwd_header, hdr, sizeof(rtMessageHeader));
+  fwd_header.payload_length = (uint32_t)(end - payload);
+  itr = buff + sizeof(uint32_t);
+  for (i = 0; i < count; ++i)
+  {
+    int32_t len;
+    rtList list;
+    rtListItem item;
+
+    rtEncoder_DecodeInt32(&itr, &len);
+    memcpy(fwd_header.topic, itr, len);
+    fwd_header.topic[len] = '\0';
+    fwd_header.topic_length = len;
+    itr += len;
+
+    rtRoutingTree_GetTopicRoutes(gRoutingTree, fwd_header.topic, &list);
+    if (!list)
+    {
+      rtLog_Debug("no client found for multicast listener:%s", fwd_header.topic);
+      continue;
+    }
+    rtList_GetFront(list, &item);
+    while (item)
+    {
+      rtTreeRoute* treeRoute;
+      rtRouteEntry* route;
+      rtListItem_GetData(item, (void**)&treeRoute);
+      rtListItem_GetNext(item, &item);
+      route = treeRoute ? (rtRouteEntry*)treeRoute->route : NULL;
+      /*internal routes have no subscription; never let a multicast re-enter the daemon*/
+      if (route && route->subscription)
+      {
+        if (route->message_handler(sender, &fwd_header, payload, (int)fwd_header.payload_length,
+              route->subscription) != RT_OK)
+          rtLog_Debug("multicast to %s failed", fwd_header.topic);
+      }
+    }
+  }
+}
+
 static rtError
 rtRouted_OnMessage(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t const* buff,
   int n, rtSubscription* not_unsed)
@@ -1345,6 +1715,10 @@ rtRouted_OnMessage(rtConnectedClient* sender, rtMessageHeader* hdr, uint8_t cons
   {
     rtRouted_OnMessageDiscoverElementObjects(sender, hdr, buff, n);
   }
+  else if (strcmp(hdr->topic, RTMSG_MULTICAST_DESTINATION) == 0)
+  {
+    rtRouted_OnMessageMulticast(sender, hdr, buff, n);
+  }
   else if (strcmp(hdr->topic, RTROUTER_DIAG_DESTINATION) == 0)
   {
     rtRouted_OnMessageDiagnostics(sender, hdr, buff, n);
@@ -1381,6 +1755,19 @@ rtConnectedClient_Init(rtConnectedClient* clnt, int fd, struct sockaddr_storage*
   memset(clnt->read_buffer, 0, RTMSG_CLIENT_READ_BUFFER_SIZE);
   memset(clnt->send_buffer, 0, RTMSG_CLIENT_READ_BUFFER_SIZE);
   clnt->read_buffer_capacity = RTMSG_CLIENT_READ_BUFFER_SIZE;
+  rtList_Create(&clnt->send_queue);
+  clnt->send_queue_bytes = 0;
+  clnt->send_queue_overflow = 0;
+  clnt->closing = 0;
+  {
+    /*recursive since forwarding of encrypted messages holds it across rtConnectedClient_Send*/
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&clnt->send_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+  }
+  clnt->worker = 0;
 #ifdef WITH_SPAKE2
   clnt->cipher = NULL;
   clnt->encryption_key = NULL;
@@ -1398,10 +1785,18 @@ rtRouter_DispatchMessageFromClient(rtConnectedClient* clnt)
   rtRouteEntry * route;
   rtList list;
   rtListItem item;
+  int exclusive = (strncmp(clnt->header.topic, "_RTROUTED.", 10) == 0) &&
+    (strcmp(clnt->header.topic, RTMSG_MULTICAST_DESTINATION) != 0);
 #ifdef MSG_ROUNDTRIP_TIME
-  static rtTime_t ts = {0};
+  rtTime_t ts = {0};
 #endif
   START_TRACKING();
+
+  /* messages to the daemon itself may add or remove routes; multicast only forwards */
+  if(exclusive)
+    pthread_rwlock_wrlock(&g_router_lock);
+  else
+    pthread_rwlock_rdlock(&g_router_lock);
 dispatch:
 
   rtRoutingTree_GetTopicRoutes(gRoutingTree, clnt->header.topic, &list);
@@ -1432,10 +1827,7 @@ dispatch:
           err = route->message_handler(clnt, &clnt->header, clnt->read_buffer +
               clnt->header.header_length, clnt->header.payload_length, route->subscription);
           if (err != RT_OK)
-          {
-            if (err == rtErrorFromErrno(EBADF))
-              rtRouted_ClearClientRoutes(clnt);
-          }
+            rtLog_Debug("DispatchMessage topic=%s handler failed %d", clnt->header.topic, err);
         }
       }
     }
@@ -1463,6 +1855,7 @@ dispatch:
     }
 #endif
   }
+  pthread_rwlock_unlock(&g_router_lock);
 }
 
 static inline void
@@ -1517,9 +1910,14 @@ rtConnectedClient_Read(rtConnectedClient* clnt)
   bytes_read = recv(clnt->fd, &clnt->read_buffer[clnt->bytes_read], bytes_to_read, MSG_NOSIGNAL);
   if (bytes_read == -1)
   {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+      return rtErrorFromErrno(EAGAIN);
+
     rtError e = rtErrorFromErrno(errno);
     rtLog_Warn("read:%s", rtStrError(e));
+    pthread_rwlock_rdlock(&g_router_lock);
     rtRouted_PrintClientInfo(clnt);
+    pthread_rwlock_unlock(&g_router_lock);
     return e;
   }
 
@@ -1544,7 +1942,9 @@ rtConnectedClient_Read(rtConnectedClient* clnt)
         rtEncoder_DecodeUInt16(&itr, &header_version);
         if((RTMSG_HEADER_MARKER != header_start) || (RTMSG_HEADER_VERSION != header_version))
         {
+          pthread_rwlock_rdlock(&g_router_lock);
           rtLog_Warn("Bad header in message from %s - %s", clnt->ident, rtRouted_GetClientName(clnt));
+          pthread_rwlock_unlock(&g_router_lock);
           rtConnectedClient_Reset(clnt);
           break;
         }
@@ -1561,7 +1961,9 @@ rtConnectedClient_Read(rtConnectedClient* clnt)
       {
         if(RT_OK != rtMessageHeader_Decode(&clnt->header, clnt->read_buffer))
         {
+          pthread_rwlock_rdlock(&g_router_lock);
           rtLog_Warn("Bad header in message from %s - %s", clnt->ident, rtRouted_GetClientName(clnt));
+          pthread_rwlock_unlock(&g_router_lock);
           rtConnectedClient_Reset(clnt);
           break;
         }
@@ -1584,7 +1986,9 @@ rtConnectedClient_Read(rtConnectedClient* clnt)
           else
           {
             rtLog_Info("Couldn't not reallocate read buffer to accommodate %d bytes. Message will be dropped.", incoming_data_size);
+            rtConnectedClient_SetBlocking(clnt, 1);
             _rtConnection_ReadAndDropBytes(clnt->fd, clnt->header.payload_length);
+            rtConnectedClient_SetBlocking(clnt, 0);
             rtConnectedClient_Reset(clnt);
             break;
           }
@@ -1625,20 +2029,58 @@ rtConnectedClient_Read(rtConnectedClient* clnt)
   return RT_OK;
 }
 
+/* The socket is edge triggered, so keep reading until it would block. */
 static void
-rtRouted_PushFd(fd_set* fds, int fd, int* maxFd)
+rtConnectedClient_OnReadable(rtConnectedClient* clnt)
 {
-  if (fd != RTMSG_INVALID_FD)
+  while (!clnt->closing)
   {
-    FD_SET(fd, fds);
-    if (maxFd && fd > *maxFd)
-      *maxFd = fd;
+    rtError err = rtConnectedClient_Read(clnt);
+    if (err == rtErrorFromErrno(EAGAIN))
+      break;
+    if (err != RT_OK)
+    {
+      pthread_mutex_lock(&clnt->send_mutex);
+      clnt->closing = 1;
+      pthread_mutex_unlock(&clnt->send_mutex);
+    }
   }
 }
 
+/* Only the worker owning a client may destroy it, as the client may still be
+ * in that worker's current batch of epoll events. */
+static void
+rtRouted_RemoveClosedClients(rtRoutedWorker* worker)
+{
+  size_t i;
+  int removed;
+
+  pthread_rwlock_wrlock(&g_router_lock);
+  /* sending the disconnect advisory can itself close other clients */
+  do
+  {
+    removed = 0;
+    for (i = 0; i < rtVector_Size(gClients);)
+    {
+      rtConnectedClient* clnt = (rtConnectedClient *) rtVector_At(gClients, i);
+      if (clnt->closing && clnt->worker == worker->index)
+      {
+        rtVector_RemoveItem(gClients, clnt, NULL);
+        rtRouted_SendAdvisoryMessage(clnt, rtAdviseClientDisconnect);
+        rtConnectedClient_Destroy(clnt);
+        removed = 1;
+      }
+      else
+        i++;
+    }
+  } while (removed);
+  pthread_rwlock_unlock(&g_router_lock);
+}
+
 static void
 rtRouted_RegisterNewClient(int fd, struct sockaddr_storage* remote_endpoint)
 {
+  static int next_worker = 0;
   char remote_address[108];
   uint16_t remote_port;
   rtConnectedClient* new_client;
@@ -1652,9 +2094,28 @@ rtRouted_RegisterNewClient(int fd, struct sockaddr_storage* remote_endpoint)
   rtConnectedClient_Init(new_client, fd, remote_endpoint);
   rtSocketStorage_ToString(&new_client->endpoint, remote_address, sizeof(remote_address), &remote_port);
   snprintf(new_client->ident, RTMSG_ADDR_MAX, "%s:%d/%d", remote_address, remote_port, fd);
+  rtConnectedClient_SetBlocking(new_client, 0);
+  new_client->worker = next_worker;
+  next_worker = (next_worker + 1) % g_num_workers;
+
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  ev.data.ptr = new_client;
+
+  pthread_rwlock_wrlock(&g_router_lock);
   rtVector_PushBack(gClients, new_client);
+  if (epoll_ctl(g_workers[new_client->worker].epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1)
+  {
+    rtLog_Warn("epoll_ctl:%s", rtStrError(errno));
+    rtVector_RemoveItem(gClients, new_client, NULL);
+    rtConnectedClient_Destroy(new_client);
+    pthread_rwlock_unlock(&g_router_lock);
+    return;
+  }
+  pthread_rwlock_unlock(&g_router_lock);
 
-  rtLog_Debug("new client:%s", new_client->ident);
+  rtLog_Debug("new client:%s worker:%d", new_client->ident, new_client->worker);
 }
 
 static void
@@ -1667,19 +2128,86 @@ rtRouted_AcceptClientConnection(rtListener* listener)
   socket_length = sizeof(struct sockaddr_storage);
   memset(&remote_endpoint, 0, sizeof(struct sockaddr_storage));
 
-  fd = accept(listener->fd, (struct sockaddr *)&remote_endpoint, &socket_length);
-  if (fd == -1)
+  for (;;)
   {
-    rtLog_Warn("accept:%s", rtStrError(errno));
-    return;
-  }
-  
-  uint32_t one = 1;
-  setsockopt(fd, SOL_TCP, TCP_NODELAY, &one, sizeof(one));
+    fd = accept(listener->fd, (struct sockaddr *)&remote_endpoint, &socket_length);
+    if (fd == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+        rtLog_Warn("accept:%s", rtStrError(errno));
+      return;
+    }
+
+    uint32_t one = 1;
+    setsockopt(fd, SOL_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    rtRouted_RegisterNewClient(fd, &remote_endpoint);
 
-  rtRouted_RegisterNewClient(fd, &remote_endpoint);
+    socket_length = sizeof(struct sockaddr_storage);
+    memset(&remote_endpoint, 0, sizeof(struct sockaddr_storage));
+  }
 }
 
+static void*
+rtRouted_RunWorker(void* arg)
+{
+  rtRoutedWorker* worker = (rtRoutedWorker *) arg;
+  struct epoll_event events[RTROUTED_MAX_EPOLL_EVENTS];
+
+  while (is_running)
+  {
+    int i;
+    int n;
+    int closed = 0;
+
+    n = epoll_wait(worker->epoll_fd, events, RTROUTED_MAX_EPOLL_EVENTS, 10000);
+    if (n == 0)
+      continue;
+
+    if (n == -1)
+    {
+      if (errno != EINTR)
+        rtLog_Warn("epoll_wait:%s", rtStrError(errno));
+      continue;
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+      size_t j;
+      rtListener* listener = NULL;
+
+      for (j = 0; worker->index == 0 && j < rtVector_Size(gListeners); ++j)
+      {
+        if (rtVector_At(gListeners, j) == events[i].data.ptr)
+        {
+          listener = (rtListener *) events[i].data.ptr;
+          break;
+        }
+      }
+
+      if (listener)
+      {
+        rtRouted_AcceptClientConnection(listener);
+      }
+      else
+      {
+        rtConnectedClient* clnt = (rtConnectedClient *) events[i].data.ptr;
+        if (events[i].events & EPOLLOUT)
+          rtConnectedClient_Flush(clnt);
+        if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+          rtConnectedClient_OnReadable(clnt);
+        if (clnt->closing)
+          closed = 1;
+      }
+    }
+
+    if (closed)
+      rtRouted_RemoveClosedClients(worker);
+  }
+  return NULL;
+}
 
 void freeListener(void* p)
 {
@@ -1690,6 +2218,8 @@ void freeClient(void* p)
   rtConnectedClient* client = (rtConnectedClient*)p;
   free(client->read_buffer);
   free(client->send_buffer);
+  if (client->send_queue)
+    rtList_Destroy(client->send_queue, free);
   free(client);
 }
 void freeRoute(void* p)
@@ -1713,6 +2243,7 @@ int main(int argc, char* argv[])
   char const* temp;
   int num_listeners = 0;
   rtRouteEntry* route;
+  pthread_rwlockattr_t lock_attr;
 
   run_in_foreground = 0;
   use_no_delay = 1;
@@ -1770,6 +2301,7 @@ int main(int argc, char* argv[])
     rtRoutingTree_AddTopicRoute(gRoutingTree, RTM_DISCOVER_OBJECT_ELEMENTS, (void *)route, 0);
     rtRoutingTree_AddTopicRoute(gRoutingTree, RTM_DISCOVER_ELEMENT_OBJECTS, (void *)route, 0);
     rtRoutingTree_AddTopicRoute(gRoutingTree, RTROUTER_DIAG_DESTINATION, (void *)route, 0);
+    rtRoutingTree_AddTopicRoute(gRoutingTree, RTMSG_MULTICAST_DESTINATION, (void *)route, 0);
 #ifdef WITH_SPAKE2
     rtRoutingTree_AddTopicRoute(gRoutingTree, RTROUTED_KEY_EXCHANGE, (void *)route, 0);
 #endif
@@ -1790,15 +2322,34 @@ int main(int argc, char* argv[])
       {"socket",      required_argument,  0, 's' },
       { "config",     required_argument,  0, 'c' },
       { "help",       no_argument,        0, 'h' },
+      { "max-backlog",    required_argument, 0, 'b' },
+      { "backlog-policy", required_argument, 0, 'p' },
+      { "threads",    required_argument,  0, 't' },
       {0, 0, 0, 0}
     };
 
-    c = getopt_long(argc, argv, "c:dfl:rhs:", long_options, &option_index);
+    c = getopt_long(argc, argv, "b:c:dfl:p:rhs:t:", long_options, &option_index);
     if (c == -1)
       break;
 
     switch (c)
     {
+      case 'b':
+        g_max_client_backlog = (uint32_t)strtoul(optarg, NULL, 10);
+        break;
+      case 'p':
+        if (!strcmp(optarg, "disconnect"))
+          g_backlog_policy = rtRoutedBacklogPolicy_Disconnect;
+        else if (!strcmp(optarg, "drop"))
+          g_backlog_policy = rtRoutedBacklogPolicy_Drop;
+        else
+          fprintf(stderr, "unknown backlog policy %s\n", optarg);
+        break;
+      case 't':
+        g_num_workers = atoi(optarg);
+        if (g_num_workers < 1)
+          g_num_workers = 1;
+        break;
       case 'c':
         config_file = optarg;
         break;
@@ -1879,78 +2430,67 @@ int main(int argc, char* argv[])
     }
   }
 
-  if(access("/nvram/rtrouted_traffic_monitor", F_OK) == 0)
-    g_enable_traffic_monitor = 1;
+  pthread_rwlockattr_init(&lock_attr);
+#ifdef __GLIBC__
+  /* keep a steady stream of forwarded messages from starving registrations */
+  pthread_rwlockattr_setkind_np(&lock_attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+  pthread_rwlock_init(&g_router_lock, &lock_attr);
+  pthread_rwlockattr_destroy(&lock_attr);
 
-  while (is_running)
+  g_workers = (rtRoutedWorker *) rt_calloc(g_num_workers, sizeof(rtRoutedWorker));
+  for (i = 0; i < g_num_workers; ++i)
   {
-    int n;
-    int                         max_fd;
-    fd_set                      read_fds;
-    fd_set                      err_fds;
-    struct timeval              timeout;
-
-    max_fd= -1;
-    FD_ZERO(&read_fds);
-    FD_ZERO(&err_fds);
-    timeout.tv_sec = 10;
-    timeout.tv_usec = 0;
-
-    for (i = 0, n = rtVector_Size(gListeners); i < n; ++i)
+    g_workers[i].index = i;
+    g_workers[i].epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (g_workers[i].epoll_fd == -1)
     {
-      rtListener* listener = (rtListener *) rtVector_At(gListeners, i);
-      if (listener)
-      {
-        rtRouted_PushFd(&read_fds, listener->fd, &max_fd);
-        rtRouted_PushFd(&err_fds, listener->fd, &max_fd);
-      }
+      rtLog_Fatal("failed to create epoll instance. %s", rtStrError(errno));
+      exit(1);
     }
+  }
 
-    for (i = 0, n = rtVector_Size(gClients); i < n; ++i)
-    {
-      rtConnectedClient* clnt = (rtConnectedClient *) rtVector_At(gClients, i);
-      if (clnt)
-      {
-        rtRouted_PushFd(&read_fds, clnt->fd, &max_fd);
-        rtRouted_PushFd(&err_fds, clnt->fd, &max_fd);
-      }
-    }
+  for (i = 0; i < (int)rtVector_Size(gListeners); ++i)
+  {
+    rtListener* listener = (rtListener *) rtVector_At(gListeners, i);
+    struct epoll_event ev;
+    int flags;
 
-    ret = select(max_fd + 1, &read_fds, NULL, &err_fds, &timeout);
-    if (ret == 0)
+    if (!listener)
       continue;
 
-    if (ret == -1)
-    {
-      rtLog_Warn("select:%s", rtStrError(errno));
-      continue;
-    }
+    flags = fcntl(listener->fd, F_GETFL, 0);
+    if (flags != -1)
+      fcntl(listener->fd, F_SETFL, flags | O_NONBLOCK);
 
-    for (i = 0, n = rtVector_Size(gListeners); i < n; ++i)
-    {
-      rtListener* listener = (rtListener *) rtVector_At(gListeners, i);
-      if (FD_ISSET(listener->fd, &read_fds))
-        rtRouted_AcceptClientConnection(listener);
-    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.ptr = listener;
+    if (epoll_ctl(g_workers[0].epoll_fd, EPOLL_CTL_ADD, listener->fd, &ev) == -1)
+      rtLog_Warn("epoll_ctl:%s", rtStrError(errno));
+  }
 
-    for (i = 0, n = rtVector_Size(gClients); i < n;)
+  if(access("/nvram/rtrouted_traffic_monitor", F_OK) == 0)
+    g_enable_traffic_monitor = 1;
+
+  for (i = 1; i < g_num_workers; ++i)
+  {
+    if (pthread_create(&g_workers[i].thread, NULL, rtRouted_RunWorker, &g_workers[i]) != 0)
     {
-      rtConnectedClient* clnt = (rtConnectedClient *) rtVector_At(gClients, i);
-      if (FD_ISSET(clnt->fd, &read_fds))
-      {
-        rtError err = rtConnectedClient_Read(clnt);
-        if (err != RT_OK)
-        {
-          rtVector_RemoveItem(gClients, clnt, NULL);
-          rtRouted_SendAdvisoryMessage(clnt, rtAdviseClientDisconnect);
-          rtConnectedClient_Destroy(clnt);
-          n--;
-          continue;
-        }
-      }
-      i++;
+      rtLog_Fatal("failed to start worker thread. %s", rtStrError(errno));
+      exit(1);
     }
   }
+  rtLog_Info("routing with %d thread(s)", g_num_workers);
+
+  rtRouted_RunWorker(&g_workers[0]);
+
+  for (i = 1; i < g_num_workers; ++i)
+    pthread_join(g_workers[i].thread, NULL);
+  for (i = 0; i < g_num_workers; ++i)
+    close(g_workers[i].epoll_fd);
+  free(g_workers);
+  pthread_rwlock_destroy(&g_router_lock);
 
   rtVector_Destroy(gListeners, freeListener);
   rtVector_Destroy(gClients, freeClient);
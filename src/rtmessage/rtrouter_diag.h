@@ -29,6 +29,8 @@
 #define RTROUTER_DIAG_CMD_LOG_ROUTING_STATS         "logRoutingStats"
 #define RTROUTER_DIAG_CMD_LOG_ROUTING_TOPICS        "logRoutingTopics"
 #define RTROUTER_DIAG_CMD_LOG_ROUTING_ROUTES        "logRoutingRoutes"
+#define RTROUTER_DIAG_CMD_LOG_ROUTE_CACHE_STATS     "logRouteCacheStats"
+#define RTROUTER_DIAG_CMD_RESET_ROUTE_CACHE_STATS   "resetRouteCacheStats"
 
 #define RTROUTER_DIAG_CMD_ENABLE_TRAFFIC_MONITOR    "enableTrafficMonitor"
 #define RTROUTER_DIAG_CMD_DISABLE_TRAFFIC_MONITOR   "disableTrafficMonitor"
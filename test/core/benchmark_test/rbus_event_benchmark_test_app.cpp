@@ -0,0 +1,141 @@
+/*
+  * If not stated otherwise in this file or this component's Licenses.txt file
+  * the following copyright and licenses apply:
+  *
+  * Copyright 2016 RDK Management
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <benchmark/benchmark.h>
+extern "C" {
+#include "rbus.h"
+}
+
+/* Provider and consumer live in the same process, so every iteration is one
+   publish routed through rtrouted and dispatched back to the consumer handle,
+   which has as many active subscriptions as the benchmark argument. Both
+   handles are opened once and kept for the whole run. */
+
+#define MAX_EVENTS 2000
+
+static rbusHandle_t g_provider = NULL;
+static rbusHandle_t g_consumer = NULL;
+static std::vector<std::string> g_names;
+static std::atomic<int> g_received(0);
+
+static rbusError_t EventSubHandler(rbusHandle_t handle, rbusEventSubAction_t action, const char* eventName, rbusFilter_t filter, int32_t interval, bool* autoPublish)
+{
+    (void)handle;
+    (void)action;
+    (void)eventName;
+    (void)filter;
+    (void)interval;
+    *autoPublish = false;
+    return RBUS_ERROR_SUCCESS;
+}
+
+static void EventReceiveHandler(rbusHandle_t handle, rbusEvent_t const* event, rbusEventSubscription_t* subscription)
+{
+    (void)handle;
+    (void)event;
+    (void)subscription;
+    g_received++;
+}
+
+static bool OpenHandles()
+{
+    std::vector<rbusDataElement_t> elements;
+    char name[64];
+    int i;
+
+    if(g_consumer)
+        return true;
+
+    for(i = 0; i < MAX_EVENTS; ++i)
+    {
+        snprintf(name, sizeof(name), "Device.EventBench.Event%d!", i + 1);
+        g_names.push_back(name);
+    }
+    for(i = 0; i < MAX_EVENTS; ++i)
+    {
+        rbusDataElement_t el = {(char*)g_names[i].c_str(), RBUS_ELEMENT_TYPE_EVENT, {NULL, NULL, NULL, NULL, EventSubHandler, NULL}};
+        elements.push_back(el);
+    }
+
+    if(rbus_open(&g_provider, "EventBenchProvider") != RBUS_ERROR_SUCCESS)
+        return false;
+    if(rbus_regDataElements(g_provider, MAX_EVENTS, elements.data()) != RBUS_ERROR_SUCCESS ||
+       rbus_open(&g_consumer, "EventBenchConsumer") != RBUS_ERROR_SUCCESS)
+    {
+        rbus_close(g_provider);
+        g_provider = NULL;
+        g_consumer = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void BM_EventDispatch(benchmark::State& state)
+{
+    int count = state.range(0);
+    std::vector<rbusEventSubscription_t> subscriptions;
+    rbusObject_t data;
+    rbusEvent_t event = {NULL, RBUS_EVENT_GENERAL, NULL};
+    size_t next = 0;
+    int i;
+
+    if(!OpenHandles())
+    {
+        state.SkipWithError("failed to open provider and consumer, is rtrouted running?");
+        return;
+    }
+
+    for(i = 0; i < count; ++i)
+    {
+        rbusEventSubscription_t sub = {g_names[i].c_str(), NULL, 0, 0, (void*)EventReceiveHandler, NULL, NULL, NULL, false};
+        subscriptions.push_back(sub);
+    }
+    if(rbusEvent_SubscribeEx(g_consumer, subscriptions.data(), count, 0) != RBUS_ERROR_SUCCESS)
+    {
+        state.SkipWithError("failed to subscribe");
+        return;
+    }
+
+    rbusObject_Init(&data, NULL);
+    event.data = data;
+
+    for(auto _ : state)
+    {
+        int expected = g_received + 1;
+
+        event.name = g_names[next].c_str();
+        rbusEvent_Publish(g_provider, &event);
+        while(g_received < expected)
+            sched_yield();
+        next = (next + 7919) % count;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    rbusObject_Release(data);
+    rbusEvent_UnsubscribeEx(g_consumer, subscriptions.data(), count);
+}
+
+BENCHMARK(BM_EventDispatch)->Arg(10)->Arg(100)->Arg(1000)->Arg(2000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,195 @@
+/*
+  * If not stated otherwise in this file or this component's Licenses.txt file
+  * the following copyright and licenses apply:
+  *
+  * Copyright 2016 RDK Management
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <string>
+#include <benchmark/benchmark.h>
+extern "C" {
+#include "rbus.h"
+#include "src/rbus/rbus_buffer.h"
+#include "src/core/rbuscore_message.h"
+void rbusObject_appendToMessage(rbusObject_t obj, rbusMessage msg);
+void rbusObject_initFromMessage(rbusObject_t* obj, rbusMessage msg);
+}
+
+/* Names shaped like the rows of a large table returned by a partial path get. */
+static std::vector<std::string> CreateNames(int count)
+{
+    std::vector<std::string> names;
+    char name[64];
+    int i;
+
+    for(i = 0; i < count; ++i)
+    {
+        snprintf(name, sizeof(name), "Device.Hosts.Host.%d.IPAddress", i + 1);
+        names.push_back(name);
+    }
+    return names;
+}
+
+static rbusProperty_t CreateList(std::vector<std::string> const& names)
+{
+    rbusProperty_t head = rbusProperty_InitInt32(names[0].c_str(), 0);
+    size_t i;
+
+    for(i = 1; i < names.size(); ++i)
+        rbusProperty_AppendInt32(head, names[i].c_str(), (int32_t)i);
+    return head;
+}
+
+static void BM_PropertyAppend(benchmark::State& state)
+{
+    std::vector<std::string> names = CreateNames(state.range(0));
+
+    for(auto _ : state)
+    {
+        rbusProperty_t head = CreateList(names);
+        benchmark::DoNotOptimize(head);
+        rbusProperty_Release(head);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PropertyIterate(benchmark::State& state)
+{
+    rbusProperty_t head = CreateList(CreateNames(state.range(0)));
+
+    for(auto _ : state)
+    {
+        int64_t sum = 0;
+        rbusProperty_t prop;
+
+        for(prop = head; prop; prop = rbusProperty_GetNext(prop))
+            sum += rbusValue_GetInt32(rbusProperty_GetValue(prop));
+        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(rbusProperty_Count(head));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    rbusProperty_Release(head);
+}
+
+static void BM_ObjectGetProperty(benchmark::State& state)
+{
+    std::vector<std::string> names = CreateNames(state.range(0));
+    rbusProperty_t head = CreateList(names);
+    rbusObject_t object;
+    size_t next = 0;
+
+    rbusObject_Init(&object, "Device.Hosts.Host.");
+    rbusObject_SetProperties(object, head);
+    rbusProperty_Release(head);
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(rbusObject_GetProperty(object, names[next].c_str()));
+        next = (next + 7919) % names.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    rbusObject_Release(object);
+}
+
+/* An object like a method's outParams, with alternating string and integer properties. */
+static rbusObject_t CreateObject(int count)
+{
+    std::vector<std::string> names = CreateNames(count);
+    rbusObject_t object;
+    int i;
+
+    rbusObject_Init(&object, "Device.Hosts.Host.");
+    for(i = 0; i < count; ++i)
+    {
+        if(i % 2)
+            rbusObject_SetPropertyString(object, names[i].c_str(), "192.168.0.100");
+        else
+            rbusObject_SetPropertyUInt32(object, names[i].c_str(), (uint32_t)i);
+    }
+    return object;
+}
+
+/* Write the object as it goes on the wire: msgpack items per name, type and value, or one TLV block. */
+static rbusMessage SerializeObject(rbusObject_t object, bool tlv)
+{
+    rbusMessage msg;
+
+    rbusMessage_Init(&msg);
+    if(tlv)
+    {
+        rbusBuffer_t block;
+        rbusBuffer_Create(&block);
+        rbusObject_Encode(object, block);
+        rbusMessage_SetBytes(msg, block->data, block->posWrite);
+        rbusBuffer_Destroy(block);
+    }
+    else
+    {
+        rbusObject_appendToMessage(object, msg);
+    }
+    return msg;
+}
+
+static void BM_ObjectSerialize(benchmark::State& state)
+{
+    rbusObject_t object = CreateObject(state.range(0));
+    uint8_t* data;
+    uint32_t length = 0;
+
+    for(auto _ : state)
+    {
+        rbusMessage msg = SerializeObject(object, state.range(1) != 0);
+        rbusMessage_ToBytes(msg, &data, &length);
+        benchmark::DoNotOptimize(data);
+        rbusMessage_Release(msg);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["bytes"] = length;
+    rbusObject_Release(object);
+}
+
+static void BM_ObjectDeserialize(benchmark::State& state)
+{
+    rbusObject_t object = CreateObject(state.range(0));
+    rbusMessage msg = SerializeObject(object, state.range(1) != 0);
+    uint8_t* data;
+    uint32_t length;
+
+    rbusMessage_ToBytes(msg, &data, &length);
+    for(auto _ : state)
+    {
+        rbusMessage received;
+        rbusObject_t decoded;
+
+        rbusMessage_FromBytes(&received, data, length);
+        rbusObject_initFromMessage(&decoded, received);
+        benchmark::DoNotOptimize(decoded);
+        rbusObject_Release(decoded);
+        rbusMessage_Release(received);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    rbusMessage_Release(msg);
+    rbusObject_Release(object);
+}
+
+BENCHMARK(BM_PropertyAppend)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PropertyIterate)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ObjectGetProperty)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_ObjectSerialize)->ArgNames({"props", "tlv"})->ArgsProduct({{10, 100, 1000}, {0, 1}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ObjectDeserialize)->ArgNames({"props", "tlv"})->ArgsProduct({{10, 100, 1000}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
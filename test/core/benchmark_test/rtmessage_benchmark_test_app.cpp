@@ -0,0 +1,225 @@
+/*
+  * If not stated otherwise in this file or this component's Licenses.txt file
+  * the following copyright and licenses apply:
+  *
+  * Copyright 2016 RDK Management
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * http://www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <benchmark/benchmark.h>
+extern "C" {
+#include "rtMessage.h"
+#include "rtConnection.h"
+}
+
+#define ECHO_TOPIC "rtmessage_benchmark.echo"
+
+/* Build a message shaped like the rbus control traffic: a handful of header
+   fields plus an array of name/value items. */
+static rtMessage CreateTestMessage(int numItems)
+{
+    rtMessage msg;
+    int i;
+
+    rtMessage_Create(&msg);
+    rtMessage_SetString(msg, "method", "rbus.getParameterValues");
+    rtMessage_SetString(msg, "provider", "Device.DeviceInfo.");
+    rtMessage_SetInt32(msg, "sessionId", 12345);
+    rtMessage_SetBool(msg, "nextLevel", true);
+    for(i = 0; i < numItems; ++i)
+    {
+        rtMessage item;
+        char name[64];
+
+        snprintf(name, sizeof(name), "Device.DeviceInfo.Param%d", i);
+        rtMessage_Create(&item);
+        rtMessage_SetString(item, "name", name);
+        rtMessage_SetInt32(item, "type", i % 16);
+        rtMessage_SetDouble(item, "value", i * 1.5);
+        rtMessage_AddMessage(msg, "params", item);
+        rtMessage_Release(item);
+    }
+    return msg;
+}
+
+static void BM_Encode(benchmark::State& state, rtMessageEncoding encoding)
+{
+    rtMessage msg = CreateTestMessage(state.range(0));
+    uint32_t size = 0;
+
+    for(auto _ : state)
+    {
+        uint8_t* buff = NULL;
+        rtMessage_ToByteArrayWithEncoding(msg, encoding, &buff, &size);
+        benchmark::DoNotOptimize(buff);
+        rtMessage_FreeByteArray(buff);
+    }
+    state.counters["bytes"] = size;
+    state.SetBytesProcessed(state.iterations() * size);
+    rtMessage_Release(msg);
+}
+
+static void BM_Decode(benchmark::State& state, rtMessageEncoding encoding)
+{
+    rtMessage msg = CreateTestMessage(state.range(0));
+    uint8_t* buff = NULL;
+    uint32_t size = 0;
+
+    rtMessage_ToByteArrayWithEncoding(msg, encoding, &buff, &size);
+    for(auto _ : state)
+    {
+        rtMessage out = NULL;
+        if(rtMessage_FromBytes(&out, buff, size) != RT_OK)
+        {
+            state.SkipWithError("rtMessage_FromBytes failed");
+            break;
+        }
+        rtMessage_Release(out);
+    }
+    state.counters["bytes"] = size;
+    state.SetBytesProcessed(state.iterations() * size);
+    rtMessage_FreeByteArray(buff);
+    rtMessage_Release(msg);
+}
+
+/* The request benchmarks need rtrouted. One connection answers, the other asks. */
+static rtConnection g_server = NULL;
+static rtConnection g_client = NULL;
+
+static void onEcho(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+    (void)closure;
+    rtConnection_SendBinaryResponse(g_server, hdr, buff, n, 1000);
+}
+
+static bool OpenConnections()
+{
+    static bool opened = false;
+    static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    pthread_mutex_lock(&mutex);
+    if(!opened &&
+       rtConnection_Create(&g_server, "rtmessage_benchmark_server", "unix:///tmp/rtrouted") == RT_OK &&
+       rtConnection_Create(&g_client, "rtmessage_benchmark_client", "unix:///tmp/rtrouted") == RT_OK)
+    {
+        rtConnection_AddListener(g_server, ECHO_TOPIC, onEcho, NULL);
+        opened = true;
+    }
+    pthread_mutex_unlock(&mutex);
+    return opened;
+}
+
+/* The blocking model: every benchmark thread waits for its own response. */
+static void BM_RequestThreadPerRequest(benchmark::State& state)
+{
+    char req[64] = "Device.DeviceInfo.SerialNumber";
+
+    if(!OpenConnections())
+    {
+        state.SkipWithError("rtrouted not running");
+        return;
+    }
+    for(auto _ : state)
+    {
+        uint8_t* res = NULL;
+        uint32_t n = 0;
+        if(rtConnection_SendBinaryRequest(g_client, (uint8_t*)req, sizeof(req), ECHO_TOPIC, &res, &n, 5000) != RT_OK)
+        {
+            state.SkipWithError("request failed");
+            break;
+        }
+        free(res);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int64_t inflight;
+    int64_t failed;
+} PipelineState;
+
+static void onPipelinedResponse(rtError err, uint8_t const* p, uint32_t n, void* closure)
+{
+    PipelineState* pipeline = (PipelineState*)closure;
+    (void)p;
+    (void)n;
+
+    pthread_mutex_lock(&pipeline->mutex);
+    pipeline->inflight--;
+    if(err != RT_OK)
+        pipeline->failed++;
+    pthread_cond_signal(&pipeline->cond);
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+/* The pipelined model: one thread keeps state.range(0) requests in flight. */
+static void BM_RequestPipelined(benchmark::State& state)
+{
+    char req[64] = "Device.DeviceInfo.SerialNumber";
+    PipelineState pipeline;
+
+    if(!OpenConnections())
+    {
+        state.SkipWithError("rtrouted not running");
+        return;
+    }
+    pthread_mutex_init(&pipeline.mutex, NULL);
+    pthread_cond_init(&pipeline.cond, NULL);
+    pipeline.inflight = 0;
+    pipeline.failed = 0;
+
+    for(auto _ : state)
+    {
+        pthread_mutex_lock(&pipeline.mutex);
+        while(pipeline.inflight >= state.range(0))
+            pthread_cond_wait(&pipeline.cond, &pipeline.mutex);
+        pipeline.inflight++;
+        pthread_mutex_unlock(&pipeline.mutex);
+
+        if(rtConnection_SendBinaryRequestAsync(g_client, (uint8_t*)req, sizeof(req), ECHO_TOPIC,
+            onPipelinedResponse, &pipeline, 5000) != RT_OK)
+        {
+            pthread_mutex_lock(&pipeline.mutex);
+            pipeline.inflight--;
+            pthread_mutex_unlock(&pipeline.mutex);
+            state.SkipWithError("request failed");
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&pipeline.mutex);
+    while(pipeline.inflight > 0)
+        pthread_cond_wait(&pipeline.cond, &pipeline.mutex);
+    pthread_mutex_unlock(&pipeline.mutex);
+    if(pipeline.failed)
+        state.SkipWithError("responses failed");
+    state.SetItemsProcessed(state.iterations());
+    pthread_mutex_destroy(&pipeline.mutex);
+    pthread_cond_destroy(&pipeline.cond);
+}
+
+BENCHMARK_CAPTURE(BM_Encode, json, rtMessageEncoding_JSON)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK_CAPTURE(BM_Encode, binary, rtMessageEncoding_Binary)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK_CAPTURE(BM_Decode, json, rtMessageEncoding_JSON)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK_CAPTURE(BM_Decode, binary, rtMessageEncoding_Binary)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_RequestThreadPerRequest)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_RequestPipelined)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+BENCHMARK_MAIN();
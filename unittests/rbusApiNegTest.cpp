@@ -569,6 +569,31 @@ TEST(rbusTabUnregRowNegTest, test2)
     free(handle);
 }
 
+TEST(rbusTabAddRowsNegTest, test1)
+{
+    rbusHandle_t handle=NULL;
+    int rc = RBUS_ERROR_SUCCESS;
+    char const* rowNames[] = {"Device.rbusProvider.PartialPath.1"};
+
+    rc = rbusTable_addRows(handle, "Device.rbusProvider.PartialPath.", 1, NULL, NULL);
+    EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+    rc = rbusTable_removeRows(handle, 1, rowNames);
+    EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+}
+
+TEST(rbusTabRegRowsNegTest, test1)
+{
+    rbusHandle_t handle=NULL;
+    int rc = RBUS_ERROR_SUCCESS;
+    uint32_t instNums[] = {1};
+    char const* rowNames[] = {"Device.rbusProvider.PartialPath.1"};
+
+    rc = rbusTable_registerRows(handle, "Device.rbusProvider.PartialPath.", 1, instNums, NULL);
+    EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+    rc = rbusTable_unregisterRows(handle, 1, rowNames);
+    EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+}
+
 TEST(rbusSubsNegTest, test1)
 {
     rbusHandle_t handle=NULL;
@@ -1005,6 +1030,13 @@ TEST(rbusSendAsyncResNegTest, test1)
         rbusObject_Release(outParams);
 }
 
+TEST(rbusExecutorStatsNegTest, test1)
+{
+    int rc = RBUS_ERROR_BUS_ERROR;
+    rc = rbus_getExecutorStats(NULL);
+    EXPECT_EQ(rc, RBUS_ERROR_INVALID_INPUT);
+}
+
 TEST(rbusLogHandler, test1)
 {
     int rc = RBUS_ERROR_BUS_ERROR;
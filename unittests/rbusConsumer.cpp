@@ -265,6 +265,43 @@ static void asyncMethodHandler1(
 
 }
 
+static int asyncGetCount = 0;
+static int asyncGetMatched = 0;
+static int asyncSetCount = 0;
+static int asyncSetSucceeded = 0;
+
+static void asyncGetHandler(
+    rbusHandle_t handle,
+    char const* name,
+    rbusError_t error,
+    rbusValue_t value,
+    void* userData)
+{
+  (void)handle;
+  (void)userData;
+
+  if(error == RBUS_ERROR_SUCCESS && value &&
+     ((0 == strcmp(name, "Device.rbusProvider.Int32") && GTEST_VAL_INT32 == rbusValue_GetInt32(value)) ||
+      (0 == strcmp(name, "Device.rbusProvider.UInt32") && GTEST_VAL_UINT32 == rbusValue_GetUInt32(value))))
+    __sync_fetch_and_add(&asyncGetMatched, 1);
+  __sync_fetch_and_add(&asyncGetCount, 1);
+}
+
+static void asyncSetHandler(
+    rbusHandle_t handle,
+    char const* name,
+    rbusError_t error,
+    void* userData)
+{
+  (void)handle;
+  (void)userData;
+
+  printf("%s called: name=%s  error=%d\n",__func__, name, error);
+  if(error == RBUS_ERROR_SUCCESS)
+    __sync_fetch_and_add(&asyncSetSucceeded, 1);
+  __sync_fetch_and_add(&asyncSetCount, 1);
+}
+
 static void subscribeHandler(
     rbusHandle_t handle,
     rbusEventSubscription_t* subscription,
@@ -492,6 +529,24 @@ int rbusConsumer(rbusGtest_t test, pid_t pid, int runtime)
         rc = rbus_setStr(handle, param, "Gtest set value");
       }
       break;
+    case RBUS_GTEST_SET_ASYNC1:
+      {
+        const char *param = "Device.rbusProvider.Param2";
+        rbusValue_t value = NULL;
+        int i;
+
+        isElementPresent(handle, param);
+        rbusValue_Init(&value);
+        rbusValue_SetString(value, "Gtest async set value");
+        rc = rbus_setAsync(handle, param, value, NULL, asyncSetHandler, NULL);
+        rbusValue_Release(value);
+        EXPECT_EQ(rc, RBUS_ERROR_SUCCESS);
+        for(i = 0; i < 100 && __sync_fetch_and_add(&asyncSetCount, 0) < 1; ++i)
+          usleep(50000);
+        EXPECT_EQ(asyncSetCount, 1);
+        EXPECT_EQ(asyncSetSucceeded, 1);
+      }
+      break;
     case RBUS_GTEST_SET_MULTI1:
       {
         const char *param1 = "Device.rbusProvider.Param2";
@@ -720,6 +775,32 @@ int rbusConsumer(rbusGtest_t test, pid_t pid, int runtime)
         rc = exec_rbus_get_test(handle, "Device.rbusProvider.Property");
       }
       break;
+    case RBUS_GTEST_GET_ASYNC1:
+      {
+        /*every get is in flight before the first response is read*/
+        const int count = 50;
+        int i, sent = 0;
+
+        isElementPresent(handle, "Device.rbusProvider.Int32");
+        for(i = 0; i < count; ++i)
+        {
+          if(rbus_getAsync(handle, (i % 2) ? "Device.rbusProvider.UInt32" : "Device.rbusProvider.Int32",
+              asyncGetHandler, NULL) == RBUS_ERROR_SUCCESS)
+            sent++;
+        }
+        EXPECT_EQ(sent, count);
+        for(i = 0; i < 100 && __sync_fetch_and_add(&asyncGetCount, 0) < sent; ++i)
+          usleep(50000);
+        EXPECT_EQ(asyncGetCount, count);
+        EXPECT_EQ(asyncGetMatched, count);
+
+        rc = rbus_getAsync(handle, "Device.rbusProvider.", asyncGetHandler, NULL);
+        EXPECT_EQ(rc, RBUS_ERROR_ACCESS_NOT_ALLOWED);
+        rc = rbus_getAsync(handle, "Device.rbusProvider.Int32", NULL, NULL);
+        EXPECT_EQ(rc, RBUS_ERROR_INVALID_INPUT);
+        rc = RBUS_ERROR_SUCCESS;
+      }
+      break;
     case RBUS_GTEST_GET_EXT1:
       {
         rbusProperty_t props = NULL;
@@ -788,6 +869,22 @@ int rbusConsumer(rbusGtest_t test, pid_t pid, int runtime)
           rbusProperty_Release(props);
         }
 
+        /*the second lookup resolves the three components from the handle's discovery cache*/
+        if(rc == RBUS_ERROR_SUCCESS)
+        {
+          rbusDiscoveryCacheStats_t stats;
+
+          rc = rbus_getExt(handle, 3, params, &actualCount, &props);
+          if(rc == RBUS_ERROR_SUCCESS)
+          {
+            EXPECT_EQ(actualCount, 3);
+            rbusProperty_Release(props);
+          }
+          EXPECT_EQ(rbusHandle_GetDiscoveryCacheStats(handle, &stats), RBUS_ERROR_SUCCESS);
+          EXPECT_GE(stats.hits, 1u);
+          EXPECT_EQ(stats.entries, 3u);
+        }
+
         kill(pid_arr[0],SIGUSR1);
         kill(pid_arr[1],SIGUSR1);
         kill(pid_arr[2],SIGUSR1);
@@ -955,6 +1052,13 @@ int rbusConsumer(rbusGtest_t test, pid_t pid, int runtime)
         sleep(runtime);
         rbusObject_Release(inParams);
 
+        /*the call ran on the executor*/
+        rbusExecutorStats_t stats;
+        EXPECT_EQ(rbus_getExecutorStats(&stats), RBUS_ERROR_SUCCESS);
+        EXPECT_GE(stats.tasksRun, 1u);
+        EXPECT_EQ(stats.queueLength, 0u);
+        EXPECT_EQ(stats.tasksRejected, 0u);
+
       }
       break;
     case RBUS_GTEST_METHOD_ASYNC1:
@@ -992,6 +1096,53 @@ int rbusConsumer(rbusGtest_t test, pid_t pid, int runtime)
         rc = exec_rbus_set_test(handle, RBUS_ERROR_INVALID_INPUT, param, "unregister_row_fail");
       }
       break;
+    case RBUS_GTEST_ADD_ROWS:
+      {
+        const char *table = "Device.rbusProvider.Rows.";
+        char const* aliasNames[] = {"first", NULL, "third"};
+        char const* failNames[] = {"fourth", "fail"};
+        uint32_t instNums[3] = {0};
+        char names[3][RBUS_MAX_NAME_LENGTH];
+        char const* rowNames[3];
+        rbusRowName_t* rows = NULL;
+        rbusRowName_t* row;
+        int i, numRows = 0;
+
+        isElementPresent(handle, "Device.rbusProvider.Param2");
+
+        rc = rbusTable_addRows(handle, table, 3, aliasNames, instNums);
+        EXPECT_EQ(rc,RBUS_ERROR_SUCCESS);
+        if(RBUS_ERROR_SUCCESS != rc) break;
+        EXPECT_NE(instNums[0],instNums[1]);
+        EXPECT_NE(instNums[1],instNums[2]);
+
+        /*the provider fails the second row, so neither row of the batch is added*/
+        rc = rbusTable_addRows(handle, table, 2, failNames, NULL);
+        EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+
+        rc = rbusTable_getRowNames(handle, table, &rows);
+        EXPECT_EQ(rc,RBUS_ERROR_SUCCESS);
+        for(row = rows; row; row = row->next)
+          numRows++;
+        EXPECT_EQ(numRows,3);
+        rbusTable_freeRowNames(handle, rows);
+
+        for(i = 0; i < 3; ++i)
+        {
+          snprintf(names[i], RBUS_MAX_NAME_LENGTH, "%s%u", table, instNums[i]);
+          rowNames[i] = names[i];
+        }
+        rc = rbusTable_removeRows(handle, 3, rowNames);
+        EXPECT_EQ(rc,RBUS_ERROR_SUCCESS);
+
+        rows = NULL;
+        rc |= rbusTable_getRowNames(handle, table, &rows);
+        EXPECT_EQ(rows,(rbusRowName_t*)NULL);
+        rbusTable_freeRowNames(handle, rows);
+
+        rc |= exec_rbus_set_test(handle, RBUS_ERROR_SUCCESS, "Device.rbusProvider.Param2", "register_rows");
+      }
+      break;
   }
 
   rc |= rbus_close(handle);
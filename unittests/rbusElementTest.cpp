@@ -175,6 +175,65 @@ TEST(rbusElementTest, testElement2)
 
 }
 
+TEST(rbusElementTest, testElement3)
+{
+    elementNode* root = getEmptyElementNode();
+    char name[RBUS_MAX_NAME_LENGTH];
+    char alias[32];
+    int i;
+
+    root->name = strdup("root");
+    root->fullName = strdup("root");
+
+    //enough siblings and rows for their parents to index them by name
+    for(i = 1; i <= 20; i++)
+    {
+        snprintf(name, sizeof(name), "Device.Foo.Prop%d", i);
+        insertElem(root, name, RBUS_ELEMENT_TYPE_PROPERTY);
+    }
+    insertElem(root, "Device.Foo.Table1.{i}.", RBUS_ELEMENT_TYPE_TABLE);
+    insertElem(root, "Device.Foo.Table1.{i}.Prop1", RBUS_ELEMENT_TYPE_PROPERTY);
+    for(i = 1; i <= 20; i++)
+    {
+        snprintf(alias, sizeof(alias), "row%d", i);
+        addRow(root, "Device.Foo.Table1.", i, alias);
+    }
+    printRow(root);
+
+    EXPECT_EQ(testRetrieveElement(root, "Device.Foo.Prop1", "Device.Foo.Prop1"),1);
+    EXPECT_EQ(testRetrieveElement(root, "Device.Foo.Prop20", "Device.Foo.Prop20"),1);
+    EXPECT_EQ(testRetrieveElement(root, "Device.Foo.Prop21", NULL),1);
+    EXPECT_EQ(testRetrieveElement(root, "Device.Foo.Table1.15.Prop1", "Device.Foo.Table1.{i}.Prop1"),1);
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.15.Prop1", "Device.Foo.Table1.15.Prop1"),1);
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.[row15].Prop1", "Device.Foo.Table1.15.Prop1"),1);
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.[row21]", NULL),1);
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.*.Prop1", "Device.Foo.Table1.{i}.Prop1"),1);
+
+    for(i = 1; i <= 20; i += 2)
+    {
+        snprintf(name, sizeof(name), "Device.Foo.Table1.%d", i);
+        delRow(root, name);
+    }
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.15", NULL),1);
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.16.Prop1", "Device.Foo.Table1.16.Prop1"),1);
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.[row16]", "Device.Foo.Table1.16"),1);
+
+    //re-adding a deleted row must find it again
+    addRow(root, "Device.Foo.Table1.", 15, "row15");
+    EXPECT_EQ(testRetrieveInstanceElement(root, "Device.Foo.Table1.15.Prop1", "Device.Foo.Table1.15.Prop1"),1);
+
+    for(i = 1; i <= 20; i++)
+    {
+        snprintf(name, sizeof(name), "Device.Foo.Prop%d", i);
+        removeElem(root, name);
+    }
+    removeElem(root, "Device.Foo.Table1.{i}.Prop1");
+    removeElem(root, "Device.Foo.Table1.{i}.");
+    EXPECT_EQ(testRetrieveElement(root, "Device.Foo", NULL),1);
+
+    freeElementNode(root);
+}
+
 TEST(rbusElementTest, negtestElement1)
 {
     elementNode* root = getEmptyElementNode();
@@ -337,6 +337,11 @@ TEST(rbusApiGet, test31)
   exec_func_test(RBUS_GTEST_GET31);
 }
 
+TEST(rbusApiGet, testAsync1)
+{
+  exec_func_test(RBUS_GTEST_GET_ASYNC1);
+}
+
 TEST(rbusApiSet, test1)
 {
   exec_func_test(RBUS_GTEST_SET1);
@@ -392,6 +397,11 @@ TEST(rbusApiSet, test11)
   exec_func_test(RBUS_GTEST_SET11);
 }
 
+TEST(rbusApiSet, testAsync1)
+{
+  exec_func_test(RBUS_GTEST_SET_ASYNC1);
+}
+
 TEST(rbusApiSetMulti, test1)
 {
   exec_func_test(RBUS_GTEST_SET_MULTI1);
@@ -516,3 +526,8 @@ TEST(rbusUnRegRowTest, test)
 {
   exec_func_test(RBUS_GTEST_UNREG_ROW);
 }
+
+TEST(rbusAddRowsTest, test)
+{
+  exec_func_test(RBUS_GTEST_ADD_ROWS);
+}
@@ -581,3 +581,36 @@ TEST(rbusObjectTest, testGetByte)
   rbusObject_Release(obj);
   rbusProperty_Release(prop1);
 }
+
+TEST(rbusObjectTest, testGetPropertyIndexed)
+{
+  rbusObject_t obj;
+  rbusProperty_t prop;
+  char name[32];
+  int i;
+
+  rbusObject_Init(&obj, "MyObj");
+  for(i = 0; i < 100; ++i)
+  {
+    snprintf(name, sizeof(name), "prop%d", i);
+    rbusObject_SetPropertyInt32(obj, name, i);
+  }
+  EXPECT_EQ(rbusObject_GetPropertyInt32(obj, "prop42", &i), RBUS_VALUE_ERROR_SUCCESS);
+  EXPECT_EQ(i, 42);
+  EXPECT_EQ(rbusObject_GetProperty(obj, "prop100"), (rbusProperty_t)NULL);
+
+  /*appended, renamed and replaced properties are all found afterwards*/
+  rbusObject_SetPropertyInt32(obj, "prop100", 100);
+  EXPECT_EQ(rbusObject_GetPropertyInt32(obj, "prop100", &i), RBUS_VALUE_ERROR_SUCCESS);
+  EXPECT_EQ(i, 100);
+  rbusProperty_SetName(rbusObject_GetProperty(obj, "prop7"), "renamed");
+  EXPECT_EQ(rbusObject_GetProperty(obj, "prop7"), (rbusProperty_t)NULL);
+  EXPECT_NE(rbusObject_GetProperty(obj, "renamed"), (rbusProperty_t)NULL);
+  prop = rbusProperty_InitInt32("prop50", 500);
+  rbusObject_SetProperty(obj, prop);
+  rbusProperty_Release(prop);
+  EXPECT_EQ(rbusObject_GetPropertyInt32(obj, "prop50", &i), RBUS_VALUE_ERROR_SUCCESS);
+  EXPECT_EQ(i, 500);
+  EXPECT_EQ(rbusProperty_Count(rbusObject_GetProperties(obj)), 101);
+  rbusObject_Release(obj);
+}
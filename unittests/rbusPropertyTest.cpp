@@ -427,3 +427,27 @@ TEST(rbusPropertyTest, testGetByte)
   EXPECT_EQ(s, 130);
   rbusProperty_Release(prop1);
 }
+
+TEST(rbusPropertyTest, testAppendAfterRelink)
+{
+  rbusProperty_t head = rbusProperty_InitInt32("p0", 0);
+  rbusProperty_t second;
+  int i;
+
+  for(i = 1; i < 5; ++i)
+    rbusProperty_AppendInt32(head, "p", i);
+  EXPECT_EQ(rbusProperty_Count(head), 5);
+
+  /*cut the list after the second node; the next append must not go to the old tail*/
+  second = rbusProperty_GetNext(head);
+  rbusProperty_SetNext(second, NULL);
+  EXPECT_EQ(rbusProperty_Count(head), 2);
+  rbusProperty_AppendInt32(head, "p5", 5);
+  EXPECT_EQ(rbusProperty_Count(head), 3);
+  EXPECT_EQ(rbusProperty_GetInt32(rbusProperty_GetNext(second)), 5);
+
+  /*growing the list from its last node directly is still counted from the head*/
+  rbusProperty_AppendInt32(rbusProperty_GetNext(second), "p6", 6);
+  EXPECT_EQ(rbusProperty_Count(head), 4);
+  rbusProperty_Release(head);
+}
@@ -153,6 +153,23 @@ rbusError_t setHandler(rbusHandle_t handle, rbusProperty_t property, rbusSetHand
       rc = rbusTable_unregisterRow(handle, "Device.rbusProvider.PartialPath");
       EXPECT_EQ(rc,RBUS_ERROR_SUCCESS);
     }
+  } else if(strcmp(val,"register_rows") == 0) {
+    uint32_t instNums[] = {100, 101, 102};
+    char const* aliasNames[] = {"row100", NULL, "row102"};
+    char const* rowNames[] = {"Device.rbusProvider.Rows.100", "Device.rbusProvider.Rows.101", "Device.rbusProvider.Rows.102"};
+    uint32_t dupInstNums[] = {103, 103};
+
+    rc = rbusTable_registerRows(handle, "Device.rbusProvider.Rows.", 2, dupInstNums, NULL);
+    EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+    rc = rbusTable_registerRows(handle, "Device.rbusProvider.Rows.", 3, instNums, aliasNames);
+    EXPECT_EQ(rc,RBUS_ERROR_SUCCESS);
+    if(RBUS_ERROR_SUCCESS == rc)
+    {
+      rc = rbusTable_registerRows(handle, "Device.rbusProvider.Rows.", 1, instNums, NULL);
+      EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
+      rc = rbusTable_unregisterRows(handle, 3, rowNames);
+      EXPECT_EQ(rc,RBUS_ERROR_SUCCESS);
+    }
   } else if(strcmp(val,"unregister_row_fail") == 0) {
     rc = rbusTable_unregisterRow(handle, "Device.rbusProvider.PartialPath123");
     EXPECT_EQ(rc,RBUS_ERROR_INVALID_INPUT);
@@ -204,6 +221,25 @@ rbusError_t ppTableRemRowHandler(
   return RBUS_ERROR_SUCCESS;
 }
 
+rbusError_t rowsTableAddRowHandler(
+    rbusHandle_t handle,
+    char const* tableName,
+    char const* aliasName,
+    uint32_t* instNum)
+{
+  static uint32_t instanceNumber = 1;
+
+  (void)handle;
+  (void)tableName;
+
+  /*lets a consumer check that a failed batch adds no rows*/
+  if(aliasName && !strcmp(aliasName, "fail"))
+    return RBUS_ERROR_INVALID_INPUT;
+
+  *instNum = instanceNumber++;
+  return RBUS_ERROR_SUCCESS;
+}
+
 rbusError_t ppParamGetHandler(rbusHandle_t handle, rbusProperty_t property, rbusGetHandlerOptions_t* opts)
 {
   rbusValue_t value;
@@ -369,6 +405,8 @@ int rbusProvider(rbusGtest_t test, pid_t pid, int *consumer_status)
     {(char *)"Device.rbusProvider.PartialPath.{i}.", RBUS_ELEMENT_TYPE_TABLE, {ppTableGetHandler, NULL, ppTableAddRowHandler, ppTableRemRowHandler, NULL, NULL}},
     {(char *)"Device.rbusProvider.PartialPath.{i}.Param1", RBUS_ELEMENT_TYPE_PROPERTY, {ppParamGetHandler, setHandler, NULL, NULL, NULL, NULL}},
     {(char *)"Device.rbusProvider.PartialPath.{i}.Param2", RBUS_ELEMENT_TYPE_PROPERTY, {ppParamGetHandler, NULL, NULL, NULL, NULL, NULL}},
+    {(char *)"Device.rbusProvider.Rows.{i}.", RBUS_ELEMENT_TYPE_TABLE, {NULL, NULL, rowsTableAddRowHandler, ppTableRemRowHandler, NULL, NULL}},
+    {(char *)"Device.rbusProvider.Rows.{i}.Name", RBUS_ELEMENT_TYPE_PROPERTY, {ppParamGetHandler, NULL, NULL, NULL, NULL, NULL}},
     {(char *)"Device.rbusProvider.Method()", RBUS_ELEMENT_TYPE_METHOD, {NULL, NULL, NULL, NULL, NULL, methodHandler}},
     {(char *)"Device.rbusProvider.Method11()", RBUS_ELEMENT_TYPE_METHOD, {NULL, NULL, NULL, NULL, NULL, methodHandler}},
     {(char *)"Device.rbusProvider.Method123()", RBUS_ELEMENT_TYPE_METHOD, {NULL, NULL, NULL, NULL, NULL, methodHandler}},
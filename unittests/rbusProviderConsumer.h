@@ -59,6 +59,7 @@ typedef enum
   RBUS_GTEST_GET29,
   RBUS_GTEST_GET30,
   RBUS_GTEST_GET31,
+  RBUS_GTEST_GET_ASYNC1,
   RBUS_GTEST_GET_EXT1,
   RBUS_GTEST_GET_EXT2,
   RBUS_GTEST_SET1,
@@ -72,6 +73,7 @@ typedef enum
   RBUS_GTEST_SET9,
   RBUS_GTEST_SET10,
   RBUS_GTEST_SET11,
+  RBUS_GTEST_SET_ASYNC1,
   RBUS_GTEST_SET_MULTI1,
   RBUS_GTEST_SET_MULTI2,
   RBUS_GTEST_SET_MULTI3,
@@ -89,6 +91,7 @@ typedef enum
   RBUS_GTEST_METHOD_ASYNC1,
   RBUS_GTEST_REG_ROW,
   RBUS_GTEST_UNREG_ROW,
+  RBUS_GTEST_ADD_ROWS,
 } rbusGtest_t;
 
 int rbusConsumer(rbusGtest_t test, pid_t pid, int runtime);
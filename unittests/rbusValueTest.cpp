@@ -1127,3 +1127,98 @@ TEST(rbusValueEncDecTlv, enc_dec_tlv_string)
   sprintf(buffer,"%s","test string");
   exec_encode_decode_tlv_test(RBUS_STRING,buffer);
 }
+
+TEST(rbusValueEncDecTlv, enc_dec_tlv_long_string)
+{
+  rbusValue_t valIn, valOut;
+  rbusBuffer_t buff;
+  char* str = (char*)malloc(70000);
+
+  memset(str, 'a', 69999);
+  str[69999] = 0;
+  rbusValue_Init(&valIn);
+  rbusValue_SetString(valIn, str);
+
+  rbusBuffer_Create(&buff);
+  rbusValue_Encode(valIn, buff);
+  EXPECT_EQ(rbusValue_Decode(&valOut, buff), 70000);
+  EXPECT_EQ(buff->posRead, buff->posWrite);
+  rbusBuffer_Destroy(buff);
+
+  EXPECT_EQ(rbusValue_Compare(valIn, valOut), 0);
+
+  rbusValue_Release(valOut);
+  rbusValue_Release(valIn);
+  free(str);
+}
+
+TEST(rbusValueEncDecTlv, enc_dec_tlv_property)
+{
+  rbusValue_t valIn, valOut;
+  rbusProperty_t prop = NULL;
+  rbusBuffer_t buff;
+  int i;
+
+  for(i = 0; i < 100; ++i)
+  {
+    char name[32];
+    snprintf(name, sizeof(name), "Device.Test.Prop%d", i);
+    if(prop)
+      rbusProperty_AppendInt32(prop, name, i);
+    else
+    {
+      rbusProperty_Init(&prop, name, NULL);
+      rbusProperty_SetInt32(prop, i);
+    }
+  }
+  rbusValue_Init(&valIn);
+  rbusValue_SetProperty(valIn, prop);
+
+  rbusBuffer_Create(&buff);
+  rbusValue_Encode(valIn, buff);
+  EXPECT_EQ(rbusValue_Decode(&valOut, buff), 0);
+  rbusBuffer_Destroy(buff);
+
+  EXPECT_EQ(rbusValue_GetType(valOut), RBUS_PROPERTY);
+  EXPECT_EQ(rbusProperty_Count(rbusValue_GetProperty(valOut)), 100);
+  EXPECT_EQ(rbusValue_Compare(valIn, valOut), 0);
+
+  rbusValue_Release(valOut);
+  rbusValue_Release(valIn);
+  rbusProperty_Release(prop);
+}
+
+TEST(rbusValueEncDecTlv, enc_dec_tlv_object)
+{
+  rbusValue_t valIn, valOut;
+  rbusObject_t obj, child, table, outObj;
+  rbusBuffer_t buff;
+
+  rbusObject_Init(&obj, "Device.Test.");
+  rbusObject_SetPropertyString(obj, "name", "value");
+  rbusObject_SetPropertyUInt64(obj, "count", 12345678901ULL);
+  rbusObject_Init(&child, "Child.");
+  rbusObject_SetPropertyBoolean(child, "enabled", true);
+  rbusObject_InitMultiInstance(&table, "Table.");
+  rbusObject_SetNext(child, table);
+  rbusObject_SetChildren(obj, child);
+  rbusValue_Init(&valIn);
+  rbusValue_SetObject(valIn, obj);
+
+  rbusBuffer_Create(&buff);
+  rbusValue_Encode(valIn, buff);
+  EXPECT_EQ(rbusValue_Decode(&valOut, buff), 0);
+  rbusBuffer_Destroy(buff);
+
+  EXPECT_EQ(rbusValue_GetType(valOut), RBUS_OBJECT);
+  EXPECT_EQ(rbusValue_Compare(valIn, valOut), 0);
+  outObj = rbusValue_GetObject(valOut);
+  EXPECT_STREQ(rbusObject_GetName(rbusObject_GetChildren(outObj)), "Child.");
+  EXPECT_EQ(rbusObject_GetType(rbusObject_GetNext(rbusObject_GetChildren(outObj))), RBUS_OBJECT_MULTI_INSTANCE);
+
+  rbusValue_Release(valOut);
+  rbusValue_Release(valIn);
+  rbusObject_Release(table);
+  rbusObject_Release(child);
+  rbusObject_Release(obj);
+}
@@ -389,6 +389,33 @@ TEST_F(TestServer, rbus_unregisterObj_test3)
     return;
 }
 
+TEST_F(TestServer, rbus_addElements_test1)
+{
+    int counter = 1;
+    int failed_index = 0;
+    char obj_name[20] = "test_server_1.obj1";
+    const char* elements[] = {"test_server_1.e1", "test_server_1.e2", "test_server_1.e3"};
+    const char* duplicate[] = {"test_server_1.e4", "test_server_1.e2"};
+    rbusCoreError_t err = RBUSCORE_SUCCESS;
+
+    CREATE_RBUS_SERVER_REG_OBJECT(counter);
+    err = rbus_addElements(obj_name, elements, 3, &failed_index);
+    EXPECT_EQ(err, RBUSCORE_SUCCESS) << "rbus_addElements failed";
+    EXPECT_EQ(failed_index, -1);
+
+    /*The whole batch is rejected, including the element that wasn't a duplicate*/
+    err = rbus_addElements(obj_name, duplicate, 2, &failed_index);
+    EXPECT_EQ(err, RBUSCORE_ERROR_DUPLICATE_ENTRY) << "rbus_addElements failed";
+    EXPECT_EQ(failed_index, 1);
+    err = rbus_addElement(obj_name, duplicate[0]);
+    EXPECT_EQ(err, RBUSCORE_SUCCESS) << "rbus_addElement failed";
+
+    err = rbus_addElements(obj_name, NULL, 1, NULL);
+    EXPECT_EQ(err, RBUSCORE_ERROR_INVALID_PARAM) << "rbus_addElements failed";
+    RBUS_CLOSE_BROKER_CONNECTION(RBUSCORE_SUCCESS);
+    return;
+}
+
 TEST_F(TestServer, rbus_registerObjNameCheck_test1)
 {
     int counter = 1;
@@ -1153,6 +1180,307 @@ TEST_F(TestServer, rtmsg_rtConnection_SendResponse_test1)
   rtConnection_Destroy(con);
 }
 
+static void poolStatsCallback(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+  (void)hdr;
+  (void)buff;
+  (void)n;
+  (*(int*)closure)++;
+}
+
+TEST_F(TestServer, rtmsg_rtConnection_GetMessagePoolStats_test1)
+{
+  rtError err;
+  rtMessage msg;
+  rtConnection con;
+  rtConnectionMessagePoolStats stats;
+  int received = 0;
+  int i;
+  char big[20000];
+
+  err = rtConnection_GetMessagePoolStats(NULL, &stats);
+  EXPECT_NE(err, RT_OK);
+
+  rtConnection_Create(&con, "POOLTEST", "unix:///tmp/rtrouted");
+  rtConnection_AddListener(con, "A.PoolTest", poolStatsCallback, &received);
+
+  memset(big, 'x', sizeof(big) - 1);
+  big[sizeof(big) - 1] = 0;
+  /*one at a time so released buffers get reused*/
+  for(i = 0; i < 10; ++i)
+  {
+    int j;
+    rtMessage_Create(&msg);
+    rtMessage_SetString(msg, "field", (i % 2) ? big : "small");
+    rtConnection_SendMessage(con, msg, "A.PoolTest");
+    rtMessage_Release(msg);
+    for(j = 0; j < 50 && received <= i; ++j)
+      usleep(10000);
+  }
+  EXPECT_EQ(received, 10);
+  usleep(100000);
+
+  err = rtConnection_GetMessagePoolStats(con, &stats);
+  EXPECT_EQ(err, RT_OK);
+  uint64_t total = 0, reuses = 0;
+  for(i = 0; i < RTCONNECTION_MESSAGE_POOL_BUCKETS; ++i)
+  {
+    EXPECT_EQ(stats.buckets[i].in_use, 0u);
+    EXPECT_LE(stats.buckets[i].free, stats.buckets[i].allocs);
+    total += stats.buckets[i].allocs + stats.buckets[i].reuses;
+    reuses += stats.buckets[i].reuses;
+  }
+  EXPECT_EQ(stats.buckets[RTCONNECTION_MESSAGE_POOL_BUCKETS-1].capacity, 0u);
+  EXPECT_GE(total, 10u);
+  EXPECT_GT(reuses, 0u);
+
+  rtConnection_RemoveListener(con, "A.PoolTest");
+  rtConnection_Destroy(con);
+}
+
+typedef struct
+{
+  int received;
+  int last[8];
+  int outOfOrder;
+} callbackOrder;
+
+static void slowCallback(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+  (void)hdr;
+  (void)buff;
+  (void)n;
+  usleep(500000);
+  (*(int*)closure)++;
+}
+
+static void orderedCallback(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+  callbackOrder* order = (callbackOrder*)closure;
+  rtMessage msg;
+  int32_t seq = 0;
+  int32_t topic = 0;
+  (void)hdr;
+
+  rtMessage_FromBytes(&msg, buff, n);
+  rtMessage_GetInt32(msg, "seq", &seq);
+  rtMessage_GetInt32(msg, "topic", &topic);
+  rtMessage_Release(msg);
+  /*listeners may be dispatched concurrently but each one in order*/
+  if(seq != order->last[topic] + 1)
+    order->outOfOrder++;
+  order->last[topic] = seq;
+  __sync_fetch_and_add(&order->received, 1);
+}
+
+TEST_F(TestServer, rtmsg_rtConnection_CallbackThreads_test1)
+{
+  rtError err;
+  rtMessage config;
+  rtMessage msg;
+  rtConnection con;
+  rtConnectionCallbackStats stats;
+  callbackOrder order;
+  char topic[32];
+  int slow = 0;
+  int i;
+
+  memset(&order, 0, sizeof(order));
+  err = rtConnection_GetCallbackStats(NULL, &stats);
+  EXPECT_NE(err, RT_OK);
+
+  rtMessage_Create(&config);
+  rtMessage_SetString(config, "appname", "CALLBACKTEST");
+  rtMessage_SetString(config, "uri", "unix:///tmp/rtrouted");
+  rtMessage_SetInt32(config, "callback_threads", 4);
+  err = rtConnection_CreateWithConfig(&con, config);
+  rtMessage_Release(config);
+  ASSERT_EQ(err, RT_OK);
+
+  rtConnection_AddListener(con, "A.Slow", slowCallback, &slow);
+  for(i = 0; i < 8; ++i)
+  {
+    snprintf(topic, sizeof(topic), "A.Ordered.%d", i);
+    rtConnection_AddListener(con, topic, orderedCallback, &order);
+  }
+  err = rtConnection_GetListenerStats(con, "A.Missing", &stats);
+  EXPECT_NE(err, RT_OK);
+
+  /*the slow listener must not hold up listeners hashed to other workers*/
+  rtMessage_Create(&msg);
+  rtConnection_SendMessage(con, msg, "A.Slow");
+  rtConnection_SendMessage(con, msg, "A.Slow");
+  rtMessage_Release(msg);
+  for(i = 0; i < 80; ++i)
+  {
+    rtMessage_Create(&msg);
+    rtMessage_SetInt32(msg, "seq", i / 8 + 1);
+    rtMessage_SetInt32(msg, "topic", i % 8);
+    snprintf(topic, sizeof(topic), "A.Ordered.%d", i % 8);
+    rtConnection_SendMessage(con, msg, topic);
+    rtMessage_Release(msg);
+  }
+  usleep(200000);
+  EXPECT_GT(order.received, 0);
+  EXPECT_EQ(slow, 0);
+
+  err = rtConnection_GetListenerStats(con, "A.Slow", &stats);
+  EXPECT_EQ(err, RT_OK);
+  EXPECT_EQ(stats.queue_length, 2u);
+  EXPECT_EQ(stats.dispatched, 0u);
+
+  for(i = 0; i < 200 && (slow < 2 || order.received < 80); ++i)
+    usleep(10000);
+  EXPECT_EQ(slow, 2);
+  EXPECT_EQ(order.received, 80);
+  EXPECT_EQ(order.outOfOrder, 0);
+  usleep(100000);
+
+  for(i = 0; i < 8; ++i)
+  {
+    snprintf(topic, sizeof(topic), "A.Ordered.%d", i);
+    err = rtConnection_GetListenerStats(con, topic, &stats);
+    EXPECT_EQ(err, RT_OK);
+    EXPECT_EQ(stats.queue_length, 0u);
+    EXPECT_EQ(stats.dispatched, 10u);
+    EXPECT_GE(stats.high_water_mark, 1u);
+  }
+
+  err = rtConnection_GetCallbackStats(con, &stats);
+  EXPECT_EQ(err, RT_OK);
+  EXPECT_EQ(stats.workers, 4u);
+  EXPECT_EQ(stats.queue_length, 0u);
+  EXPECT_GE(stats.dispatched, 82u);
+  EXPECT_GE(stats.high_water_mark, 2u);
+
+  rtConnection_RemoveListener(con, "A.Slow");
+  for(i = 0; i < 8; ++i)
+  {
+    snprintf(topic, sizeof(topic), "A.Ordered.%d", i);
+    rtConnection_RemoveListener(con, topic);
+  }
+  rtConnection_Destroy(con);
+}
+
+static void multicastCallback(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+  if(n == 6 && memcmp(buff, "hello", 6) == 0 && strcmp(hdr->reply_topic, "A.MulticastSender") == 0)
+    (*(int*)closure)++;
+}
+
+TEST_F(TestServer, rtmsg_rtConnection_SendBinaryMulticast_test1)
+{
+  rtError err;
+  rtConnection con1, con2, sender;
+  int received1 = 0, received2 = 0;
+  char const* listeners[] = { "A.Multicast1", "A.Multicast2" };
+  int i;
+
+  err = rtConnection_SendBinaryMulticast(NULL, (uint8_t const*)"hello", 6, listeners, 2, "A.MulticastSender");
+  EXPECT_NE(err, RT_OK);
+
+  rtConnection_Create(&con1, "MULTICAST1", "unix:///tmp/rtrouted");
+  rtConnection_Create(&con2, "MULTICAST2", "unix:///tmp/rtrouted");
+  rtConnection_Create(&sender, "MULTICASTSENDER", "unix:///tmp/rtrouted");
+  rtConnection_AddListener(con1, "A.Multicast1", multicastCallback, &received1);
+  rtConnection_AddListener(con2, "A.Multicast2", multicastCallback, &received2);
+  /*subscriptions travel on other connections than the send, give the router a moment to add them*/
+  usleep(100000);
+
+  err = rtConnection_SendBinaryMulticast(sender, (uint8_t const*)"hello", 6, listeners, 0, "A.MulticastSender");
+  EXPECT_NE(err, RT_OK);
+  err = rtConnection_SendBinaryMulticast(sender, (uint8_t const*)"hello", 6, listeners, 2, "A.MulticastSender");
+  EXPECT_EQ(err, RT_OK);
+  for(i = 0; i < 100 && (received1 < 1 || received2 < 1); ++i)
+    usleep(10000);
+  EXPECT_EQ(received1, 1);
+  EXPECT_EQ(received2, 1);
+
+  rtConnection_RemoveListener(con1, "A.Multicast1");
+  rtConnection_RemoveListener(con2, "A.Multicast2");
+  rtConnection_Destroy(sender);
+  rtConnection_Destroy(con2);
+  rtConnection_Destroy(con1);
+}
+
+static void echoRequestCallback(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+  rtConnection_SendBinaryResponse((rtConnection)closure, hdr, buff, n, 1000);
+}
+
+TEST_F(TestServer, rtmsg_rtConnection_SendBinaryRequests_test1)
+{
+  rtError err;
+  rtConnection responder, requester;
+  uint8_t const* reqs[] = { (uint8_t const*)"one", (uint8_t const*)"two", (uint8_t const*)"three" };
+  uint32_t reqLengths[] = { 4, 4, 6 };
+  char const* topics[] = { "A.Requests1", "A.Requests2", "A.RequestsNone" };
+  uint8_t* rsps[3];
+  uint32_t rspLengths[3];
+  rtError errs[3];
+
+  err = rtConnection_SendBinaryRequests(NULL, 3, reqs, reqLengths, topics, rsps, rspLengths, errs, 1000);
+  EXPECT_NE(err, RT_OK);
+
+  rtConnection_Create(&responder, "REQUESTS_RESPONDER", "unix:///tmp/rtrouted");
+  rtConnection_Create(&requester, "REQUESTS_REQUESTER", "unix:///tmp/rtrouted");
+  rtConnection_AddListener(responder, "A.Requests1", echoRequestCallback, responder);
+  rtConnection_AddListener(responder, "A.Requests2", echoRequestCallback, responder);
+
+  err = rtConnection_SendBinaryRequests(requester, 3, reqs, reqLengths, topics, rsps, rspLengths, errs, 1000);
+  EXPECT_EQ(err, RT_OK);
+  EXPECT_EQ(errs[0], RT_OK);
+  EXPECT_EQ(errs[1], RT_OK);
+  EXPECT_EQ(errs[2], RT_OBJECT_NO_LONGER_AVAILABLE);
+  ASSERT_EQ(rspLengths[0], 4u);
+  EXPECT_STREQ((char*)rsps[0], "one");
+  ASSERT_EQ(rspLengths[1], 4u);
+  EXPECT_STREQ((char*)rsps[1], "two");
+  EXPECT_EQ(rsps[2], (uint8_t*)NULL);
+  rtMessage_FreeByteArray(rsps[0]);
+  rtMessage_FreeByteArray(rsps[1]);
+
+  rtConnection_RemoveListener(responder, "A.Requests1");
+  rtConnection_RemoveListener(responder, "A.Requests2");
+  rtConnection_Destroy(requester);
+  rtConnection_Destroy(responder);
+}
+
+static void slowEchoRequestCallback(rtMessageHeader const* hdr, uint8_t const* buff, uint32_t n, void* closure)
+{
+  if(0 == strcmp((char const*)buff, "slow"))
+    usleep(300000);
+  rtConnection_SendBinaryResponse((rtConnection)closure, hdr, buff, n, 1000);
+}
+
+TEST_F(TestServer, rtmsg_rtConnection_SendBinaryRequest_test1)
+{
+  rtError err;
+  rtConnection responder, requester;
+  uint8_t* rsp = NULL;
+  uint32_t rspLength = 0;
+
+  rtConnection_Create(&responder, "REQUEST_RESPONDER", "unix:///tmp/rtrouted");
+  rtConnection_Create(&requester, "REQUEST_REQUESTER", "unix:///tmp/rtrouted");
+  rtConnection_AddListener(responder, "A.SlowEcho", slowEchoRequestCallback, responder);
+
+  err = rtConnection_SendBinaryRequest(requester, (uint8_t const*)"slow", 5, "A.SlowEcho", &rsp, &rspLength, 100);
+  EXPECT_EQ(err, RT_ERROR_TIMEOUT);
+  EXPECT_EQ(rsp, (uint8_t*)NULL);
+
+  /*the late response to the timed out request must not be taken for this one*/
+  usleep(300000);
+  err = rtConnection_SendBinaryRequest(requester, (uint8_t const*)"fast", 5, "A.SlowEcho", &rsp, &rspLength, 1000);
+  EXPECT_EQ(err, RT_OK);
+  ASSERT_EQ(rspLength, 5u);
+  EXPECT_STREQ((char*)rsp, "fast");
+  rtMessage_FreeByteArray(rsp);
+
+  rtConnection_RemoveListener(responder, "A.SlowEcho");
+  rtConnection_Destroy(requester);
+  rtConnection_Destroy(responder);
+}
+
 TEST_F(TestServer, rtmsg_rtMessage_SetBool_test1)
 {
   rtError       err;
@@ -1349,6 +1677,78 @@ TEST_F(TestServer, rtmsg_rtMessage_toByteArray_test1)
     rtMessage_Release(item);
 }
 
+TEST_F(TestServer, rtmsg_rtMessage_BinaryEncoding_test1)
+{
+    rtError err;
+    rtMessage req, item, out, sub;
+    uint8_t* binbuf = NULL;
+    uint8_t* jsonbuf = NULL;
+    uint32_t binsize = 0, jsonsize = 0;
+    char* s1 = NULL;
+    char* s2 = NULL;
+    uint32_t n = 0;
+    int32_t i32 = 0, len = 0;
+    double d = 0;
+    bool b = false;
+    char const* str = NULL;
+    uint8_t junk[] = { 0xB5, 0x01, 0x07, 0x05, 0x7F };
+
+    rtMessage_Create(&req);
+    rtMessage_SetString(req, "method", "rtsend");
+    rtMessage_SetInt32(req, "neg", -123456);
+    rtMessage_SetDouble(req, "pi", 3.14159);
+    rtMessage_SetBool(req, "flag", true);
+    rtMessage_AddString(req, "names", "one");
+    rtMessage_AddString(req, "names", "two");
+    rtMessage_Create(&item);
+    rtMessage_SetString(item, "name", "ITEM");
+    rtMessage_SetInt32(item, "count", 42);
+    rtMessage_SetMessage(req, "params", item);
+    rtMessage_AddMessage(req, "items", item);
+
+    err = rtMessage_ToByteArrayWithEncoding(req, rtMessageEncoding_Binary, &binbuf, &binsize);
+    EXPECT_EQ(err, RT_OK) << "rtMessage_ToByteArrayWithEncoding failed";
+    err = rtMessage_ToByteArray(req, &jsonbuf, &jsonsize);
+    EXPECT_EQ(err, RT_OK);
+    EXPECT_LT(binsize, jsonsize);
+
+    err = rtMessage_FromBytes(&out, binbuf, binsize);
+    EXPECT_EQ(err, RT_OK) << "rtMessage_FromBytes failed on binary input";
+    rtMessage_ToString(req, &s1, &n);
+    rtMessage_ToString(out, &s2, &n);
+    EXPECT_STREQ(s1, s2);
+    EXPECT_EQ(rtMessage_GetInt32(out, "neg", &i32), RT_OK);
+    EXPECT_EQ(i32, -123456);
+    EXPECT_EQ(rtMessage_GetDouble(out, "pi", &d), RT_OK);
+    EXPECT_DOUBLE_EQ(d, 3.14159);
+    EXPECT_EQ(rtMessage_GetBool(out, "flag", &b), RT_OK);
+    EXPECT_TRUE(b);
+    EXPECT_EQ(rtMessage_GetArrayLength(out, "names", &len), RT_OK);
+    EXPECT_EQ(len, 2);
+    EXPECT_EQ(rtMessage_GetStringItem(out, "names", 1, &str), RT_OK);
+    EXPECT_STREQ(str, "two");
+    EXPECT_EQ(rtMessage_GetMessage(out, "params", &sub), RT_OK);
+    EXPECT_EQ(rtMessage_GetInt32(sub, "count", &i32), RT_OK);
+    EXPECT_EQ(i32, 42);
+    rtMessage_Release(sub);
+    rtMessage_Release(out);
+
+    //Neg test truncated and corrupt input
+    out = NULL;
+    err = rtMessage_FromBytes(&out, binbuf, binsize - 1);
+    EXPECT_NE(err, RT_OK);
+    out = NULL;
+    err = rtMessage_FromBytes(&out, junk, sizeof(junk));
+    EXPECT_NE(err, RT_OK);
+
+    free(s1);
+    free(s2);
+    rtMessage_FreeByteArray(binbuf);
+    rtMessage_FreeByteArray(jsonbuf);
+    rtMessage_Release(req);
+    rtMessage_Release(item);
+}
+
 TEST_F(TestServer, rtmsg_rtError_test1)
 {
   rtError err = RT_OK;